@@ -32,6 +32,16 @@ cdef extern from "input_output/FGPropertyManager.h" namespace "JSBSim":
     cdef cppclass c_FGPropertyManager "JSBSim::FGPropertyManager":
         c_FGPropertyManager()
         bool HasNode(string path) except +convertJSBSimToPyExc
+        int GetHandle(string path, bool create) except +convertJSBSimToPyExc
+        size_t GetNumHandles()
+        double GetValue(int handle)
+        void SetValue(int handle, double value)
+        void GetValues(const vector[int]& h, vector[double]& values) except +convertJSBSimToPyExc
+        void SetValues(const vector[int]& h, const vector[double]& values) except +convertJSBSimToPyExc
+        void Watch(int handle) except +convertJSBSimToPyExc
+        void Unwatch(int handle)
+        const vector[int]& GetChanges()
+        unsigned int GetJournalFrame()
 
 cdef extern from "math/FGColumnVector3.h" namespace "JSBSim":
     cdef cppclass c_FGColumnVector3 "JSBSim::FGColumnVector3":
@@ -156,6 +166,8 @@ cdef extern from "FGFDMExec.h" namespace "JSBSim":
         void Resume()
         bool Holding()
         void ResetToInitialConditions(int mode)
+        string SaveState() except +convertJSBSimToPyExc
+        void RestoreState(const string& blob) except +convertJSBSimToPyExc
         void SetDebugLevel(int level)
         string QueryPropertyCatalog(string check)
         void PrintPropertyCatalog()
@@ -26,6 +26,48 @@ cdef convertToNumpyMat(const c_FGMatrix33& m):
 cdef convertToNumpyVec(const c_FGColumnVector3& v):
     return numpy.mat([v.Entry(1), v.Entry(2), v.Entry(3)]).T
 
+def read_binary_output(filename):
+    """Reads a file written by an output of type BINARY.
+
+    Returns a tuple (names, units, rate, data) where names and units are the
+    lists of the column names and units, rate is the output rate in Hz and
+    data is a 2D numpy array with one row per output step. The first column
+    is the simulation time."""
+    with open(filename, 'rb') as f:
+        content = f.read()
+
+    if content[:8] != b'JSBSIMBF':
+        raise IOError("%s is not a JSBSim binary output file" % filename)
+
+    header = numpy.frombuffer(content, dtype='<u4', count=4, offset=8)
+    header_size, version, value_size, ncols = (int(x) for x in header)
+    if version != 1:
+        raise IOError("Unsupported version %d of the binary output file %s"
+                      % (version, filename))
+    rate = float(numpy.frombuffer(content, dtype='<f8', count=1, offset=24)[0])
+
+    def read_string(offset):
+        length = int(numpy.frombuffer(content, dtype='<u2', count=1,
+                                      offset=offset)[0])
+        offset += 2
+        return content[offset:offset+length].decode('utf-8'), offset+length
+
+    names = []
+    units = []
+    offset = 32
+    for i in range(ncols):
+        name, offset = read_string(offset)
+        unit, offset = read_string(offset)
+        names.append(name)
+        units.append(unit)
+
+    dtype = '<f4' if value_size == 4 else '<f8'
+    nrows = (len(content) - header_size) // (value_size * ncols)
+    data = numpy.frombuffer(content, dtype=dtype, count=nrows*ncols,
+                            offset=header_size).reshape(nrows, ncols)
+
+    return names, units, rate, data
+
 cdef class FGPropagate:
 
     cdef c_FGPropagate *thisptr
@@ -66,6 +108,77 @@ cdef class FGPropertyManager:
      def hasNode(self, path):
          return self.thisptr.HasNode(path.encode())
 
+     def get_handle(self, path, create=False):
+         """
+         Resolves a property path into a handle. The path is only looked up
+         in the property tree the first time it is requested.
+         @param path the property path
+         @param create True to create the property if it does not exist
+         @result the handle or -1 if the property does not exist
+         """
+         return self.thisptr.GetHandle(path.encode(), create)
+
+     def get_value(self, handle):
+         """
+         Retrieves the value of a property from its handle.
+         """
+         if handle < 0 or handle >= self.thisptr.GetNumHandles():
+             raise IndexError("Invalid property handle {}".format(handle))
+         return self.thisptr.GetValue(handle)
+
+     def set_value(self, handle, value):
+         """
+         Sets the value of a property from its handle.
+         """
+         if handle < 0 or handle >= self.thisptr.GetNumHandles():
+             raise IndexError("Invalid property handle {}".format(handle))
+         self.thisptr.SetValue(handle, value)
+
+     def get_values(self, handles):
+         """
+         Retrieves the values of several properties from their handles.
+         @param handles a sequence of handles
+         @result the list of the values in the order of the handles
+         """
+         cdef vector[double] values
+         self.thisptr.GetValues(handles, values)
+         return values
+
+     def set_values(self, handles, values):
+         """
+         Sets the values of several properties from their handles.
+         @param handles a sequence of handles
+         @param values a sequence of values in the order of the handles
+         """
+         self.thisptr.SetValues(handles, values)
+
+     def watch(self, handle):
+         """
+         Records the changes of a property in the journal of the changes.
+         @param handle the handle of the property
+         """
+         self.thisptr.Watch(handle)
+
+     def unwatch(self, handle):
+         """
+         Stops recording the changes of a property.
+         """
+         self.thisptr.Unwatch(handle)
+
+     def get_changes(self):
+         """
+         Retrieves the handles of the watched properties that changed during
+         the last frame.
+         @result the list of the handles in increasing order
+         """
+         return self.thisptr.GetChanges()
+
+     def get_journal_frame(self):
+         """
+         Retrieves the number of frames recorded in the journal.
+         """
+         return self.thisptr.GetJournalFrame()
+
 cdef class FGGroundReactions:
 
     cdef c_FGGroundReactions *thisptr
@@ -251,10 +364,11 @@ cdef class FGFDMExec:
 
     def __getitem__(self, key):
         _key = key.strip()
-        pm = self.get_property_manager()
-        if not pm.hasNode(_key):
+        cdef c_FGPropertyManager* pm = self.thisptr.GetPropertyManager()
+        cdef int handle = pm.GetHandle(_key.encode(), False)
+        if handle < 0:
             raise KeyError("No property named {}".format(_key))
-        return self.get_property_value(_key)
+        return pm.GetValue(handle)
 
     def __setitem__(self, key, value):
         self.set_property_value(key.strip(), value)
@@ -547,6 +661,21 @@ cdef class FGFDMExec:
         """
         self.thisptr.ResetToInitialConditions(mode)
 
+    def save_state(self):
+        """
+        Saves the state of the simulation into a binary blob.
+        @return the blob as bytes.
+        """
+        return self.thisptr.SaveState()
+
+    def restore_state(self, blob):
+        """
+        Restores a state saved by save_state(). The simulation continues
+        exactly as it did after the state was saved.
+        @param blob the bytes returned by save_state().
+        """
+        self.thisptr.RestoreState(blob)
+
     def set_debug_level(self, level):
         """
         Sets the debug level.
@@ -0,0 +1,346 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGBatchRunner.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+ Purpose:      Runs a set of simulations in parallel
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/2026   Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+COMMENTS, REFERENCES,  and NOTES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Each worker thread owns a queue of run indices. A worker pops the runs from the
+front of its own queue and, once it is empty, steals the runs from the back of
+the queues of the other workers. All the runs are queued before the workers
+are started so a worker can exit as soon as all the queues are found empty.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <deque>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "FGBatchRunner.h"
+#include "FGFDMExec.h"
+#include "initialization/FGInitialCondition.h"
+#include "initialization/FGTrim.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGBatchRunner::WorkQueues
+{
+public:
+  WorkQueues(unsigned int nworkers, unsigned int ncases)
+    : queues(nworkers), locks(nworkers)
+  {
+    // Contiguous blocks of runs so that a worker only steals at the end.
+    for (unsigned int i=0; i<ncases; i++)
+      queues[(i * nworkers) / ncases].push_back(i);
+  }
+
+  bool Pop(unsigned int id, unsigned int& index) {
+    {
+      lock_guard<mutex> guard(locks[id]);
+      if (!queues[id].empty()) {
+        index = queues[id].front();
+        queues[id].pop_front();
+        return true;
+      }
+    }
+
+    for (unsigned int i=1; i<queues.size(); i++) {
+      unsigned int victim = (id + i) % queues.size();
+      lock_guard<mutex> guard(locks[victim]);
+      if (!queues[victim].empty()) {
+        index = queues[victim].back();
+        queues[victim].pop_back();
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+private:
+  vector<deque<unsigned int> > queues;
+  vector<mutex> locks;
+};
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGBatchRunner::FGBatchRunner(const SGPath& rootDir)
+  : RootDir(rootDir), EndTime(1E99), DeltaT(0.0), NumThreads(0),
+    DebugLevel(0), RandomSeed(0)
+{
+  Debug(0);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGBatchRunner::~FGBatchRunner()
+{
+  Debug(1);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBatchRunner::SetScript(const SGPath& script, const SGPath& initfile)
+{
+  ScriptName = script;
+  InitFile = initfile;
+  AircraftName.clear();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBatchRunner::SetAircraft(const string& aircraft, const SGPath& initfile)
+{
+  ScriptName = SGPath();
+  AircraftName = aircraft;
+  InitFile = initfile;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGBatchRunner::AddCase(const Case& run)
+{
+  Cases.push_back(run);
+  return Cases.size() - 1;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+const vector<FGBatchRunner::Result>& FGBatchRunner::Run(void)
+{
+  Results.assign(Cases.size(), Result());
+  if (Cases.empty()) return Results;
+
+  unsigned int nthreads = NumThreads;
+  if (nthreads == 0) nthreads = thread::hardware_concurrency();
+  if (nthreads == 0) nthreads = 1;
+  if (nthreads > Cases.size()) nthreads = Cases.size();
+
+  WorkQueues queues(nthreads, Cases.size());
+  vector<thread> workers;
+
+  for (unsigned int i=0; i<nthreads; i++)
+    workers.push_back(thread(&FGBatchRunner::Worker, this, i, ref(queues)));
+
+  for (auto& worker: workers)
+    worker.join();
+
+  return Results;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBatchRunner::Worker(unsigned int id, WorkQueues& queues)
+{
+  unique_ptr<FGFDMExec> fdmex;
+  string state;
+  unsigned int index;
+
+  // debug_lvl is local to each thread.
+  debug_lvl = DebugLevel;
+
+  while (queues.Pop(id, index)) {
+    Result& result = Results[index];
+
+    try {
+      if (!fdmex) {
+        fdmex.reset(CreateExec(index));
+        // Some properties only get their type when the models are
+        // initialized so the state is saved after a first reset, which
+        // creates the same properties as the resets of the runs.
+        fdmex->ResetToInitialConditions(0);
+        state = fdmex->SaveState();
+      }
+      Execute(fdmex.get(), state, index);
+      if (Callback) Callback(index, *fdmex);
+      result.success = true;
+    } catch (const string& msg) {
+      result.error = msg;
+    } catch (const exception& e) {
+      result.error = e.what();
+    } catch (...) {
+      result.error = "Unknown exception";
+    }
+
+    // Start afresh after a failure: the state of the instance is unknown. The
+    // aircraft is also reloaded when dispersions are on to draw new values.
+    if (!result.success || (fdmex &&
+        fdmex->GetPropertyValue("simulation/disperse") != 0.0))
+      fdmex.reset();
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGFDMExec* FGBatchRunner::CreateExec(unsigned int index) const
+{
+  unique_ptr<FGFDMExec> fdmex(new FGFDMExec());
+
+  fdmex->SetDebugLevel(DebugLevel);
+  fdmex->SetRootDir(RootDir);
+  fdmex->SetAircraftPath(SGPath("aircraft"));
+  fdmex->SetEnginePath(SGPath("engine"));
+  fdmex->SetSystemsPath(SGPath("systems"));
+  if (DeltaT > 0.0) fdmex->Setdt(DeltaT);
+  // The dispersions are drawn while the aircraft is loaded.
+  fdmex->SetPropertyValue("simulation/randomseed", RandomSeed);
+  fdmex->SetRunIndex(index);
+
+  if (!ScriptName.isNull()) {
+    if (!fdmex->LoadScript(ScriptName, DeltaT, InitFile))
+      throw string("Script file " + ScriptName.utf8Str()
+                   + " was not successfully loaded");
+  } else {
+    if (!fdmex->LoadModel(SGPath("aircraft"), SGPath("engine"),
+                          SGPath("systems"), AircraftName))
+      throw string("Aircraft " + AircraftName
+                   + " was not successfully loaded");
+    if (!fdmex->GetIC()->Load(InitFile))
+      throw string("Initialization file " + InitFile.utf8Str()
+                   + " was not successfully loaded");
+  }
+
+  fdmex->DisableOutput();
+
+  return fdmex.release();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBatchRunner::Execute(FGFDMExec* fdmex, const string& state,
+                            unsigned int index)
+{
+  FGPropertyManager* PropertyManager = fdmex->GetPropertyManager();
+  const Case& run = Cases[index];
+  Result& result = Results[index];
+  vector<FGPropertyNode*> nodes;
+
+  // Go back to the state of the instance as it was loaded: the properties set
+  // by the previous run, its script events and its systems are not reset by
+  // ResetToInitialConditions().
+  fdmex->RestoreState(state);
+
+  for (auto& property: run.properties) {
+    FGPropertyNode* node = PropertyManager->GetNode(property.first);
+    if (!node)
+      throw string("No property by the name " + property.first);
+    nodes.push_back(node);
+  }
+
+  for (unsigned int i=0; i<nodes.size(); i++) {
+    if (run.properties[i].first.compare(0, 3, "ic/") == 0)
+      nodes[i]->setDoubleValue(run.properties[i].second);
+  }
+
+  // Restart the random sequences so that the run does not depend on the runs
+  // previously executed by the same instance.
+  fdmex->SetRunIndex(index);
+  fdmex->SetPropertyValue("simulation/terminate", 0.0);
+  fdmex->ResetToInitialConditions(0);
+
+  TrimMode trimMode = (TrimMode)fdmex->GetIC()->TrimRequested();
+  if (trimMode != TrimMode::tNone) {
+    FGTrim trimmer(fdmex, trimMode);
+    trimmer.DoTrim();
+  }
+
+  for (unsigned int i=0; i<nodes.size(); i++) {
+    if (run.properties[i].first.compare(0, 3, "ic/") != 0)
+      nodes[i]->setDoubleValue(run.properties[i].second);
+  }
+
+  bool running = fdmex->Run();
+  while (running && fdmex->GetSimTime() <= EndTime)
+    running = fdmex->Run();
+
+  result.sim_time = fdmex->GetSimTime();
+  result.values.clear();
+  for (auto& property: OutputProperties) {
+    FGPropertyNode* node = PropertyManager->GetNode(property);
+    if (!node)
+      throw string("No property by the name " + property);
+    result.values.push_back(node->getDoubleValue());
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//    The bitmasked value choices are as follows:
+//    unset: In this case (the default) JSBSim would only print
+//       out the normally expected messages, essentially echoing
+//       the config files as they are read. If the environment
+//       variable is not set, debug_lvl is set to 1 internally
+//    0: This requests JSBSim not to output any messages
+//       whatsoever.
+//    1: This value explicity requests the normal JSBSim
+//       startup messages
+//    2: This value asks for a message to be printed out when
+//       a class is instantiated
+//    4: When this value is set, a message is displayed when a
+//       FGModel object executes its Run() method
+//    8: When this value is set, various runtime state variables
+//       are printed out periodically
+//    16: When set various parameters are sanity checked and
+//       a message is printed out when they go out of bounds
+
+void FGBatchRunner::Debug(int from)
+{
+  if (debug_lvl <= 0) return;
+
+  if (debug_lvl & 1) { // Standard console startup message output
+    if (from == 0) { // Constructor
+    }
+  }
+  if (debug_lvl & 2 ) { // Instantiation/Destruction notification
+    if (from == 0) cout << "Instantiated: FGBatchRunner" << endl;
+    if (from == 1) cout << "Destroyed:    FGBatchRunner" << endl;
+  }
+  if (debug_lvl & 4 ) { // Run() method entry print for FGModel-derived objects
+  }
+  if (debug_lvl & 8 ) { // Runtime state variables
+  }
+  if (debug_lvl & 16) { // Sanity checking
+  }
+  if (debug_lvl & 64) {
+    if (from == 0) { // Constructor
+    }
+  }
+}
+}
@@ -0,0 +1,217 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGBatchRunner.h
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/2026   Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGBATCHRUNNER_H
+#define FGBATCHRUNNER_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "FGJSBBase.h"
+#include "simgear/misc/sg_path.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGFDMExec;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Runs a set of simulations of the same aircraft in parallel.
+    The batch runner executes a list of runs (or cases) that all share the same
+    script - or the same aircraft and initialization file - and only differ by
+    a set of property values. The runs are distributed over a pool of worker
+    threads; each worker owns a single FGFDMExec instance which loads the
+    aircraft once. Its state is saved with FGFDMExec::SaveState() after
+    loading and restored at the start of each run, so that a run does not
+    depend on the runs previously executed by the same instance. Idle
+    workers steal runs from the queues of the busy ones so that the load stays
+    balanced even when the run durations are very different.
+
+    The properties of a run are applied as follows:
+    - the properties which name starts with <tt>ic/</tt> override the initial
+      conditions and are set before the simulation is initialized.
+    - the other properties are set once the simulation is initialized, just
+      before the first time step.
+
+    Each run is executed with its index as simulation/run-index so that its
+    random sequences (sensor noise, turbulence, dispersions, etc.) only depend
+    on the random seed and on the run index: a run can be reproduced on its own
+    whatever the number of threads. When dispersions are enabled (see the
+    JSBSIM_DISPERSE environment variable) the aircraft is reloaded for each run
+    so that each run draws its own dispersed values.
+
+    The data logging of the aircraft and script is disabled in batch mode: the
+    results are collected by reading the properties registered with
+    AddOutputProperty() at the end of each run.
+
+    Usage:
+    @code
+    FGBatchRunner batch(SGPath("/path/to/jsbsim"));
+    batch.SetScript(SGPath("scripts/c1723.xml"));
+    batch.AddOutputProperty("position/h-sl-ft");
+    for (double alt=3000.; alt < 9000.; alt += 500.) {
+      FGBatchRunner::Case run;
+      run.properties.push_back(std::make_pair("ic/h-sl-ft", alt));
+      batch.AddCase(run);
+    }
+    const std::vector<FGBatchRunner::Result>& results = batch.Run();
+    @endcode
+
+    @author The JSBSim team
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGBatchRunner : public FGJSBBase
+{
+public:
+  /// The settings that are specific to one run.
+  struct Case {
+    /// Property names and values set for this run.
+    std::vector<std::pair<std::string, double> > properties;
+  };
+
+  /// The outcome of one run.
+  struct Result {
+    Result(void) : success(false), sim_time(0.0) {}
+    /// false if the run could not be initialized or has thrown an exception.
+    bool success;
+    /// Simulation time at the end of the run.
+    double sim_time;
+    /// Final values of the output properties in the order of their addition.
+    std::vector<double> values;
+    /// Error message when the run has failed.
+    std::string error;
+  };
+
+  /** Callback invoked by a worker thread at the end of each successful run.
+      It is called concurrently by the workers and must therefore be thread
+      safe. The first argument is the index of the run. */
+  typedef std::function<void(unsigned int, FGFDMExec&)> RunCallback;
+
+  /** Constructor.
+      @param rootDir the JSBSim root directory (where aircraft/, engine/, etc.
+                     reside) */
+  explicit FGBatchRunner(const SGPath& rootDir);
+  ~FGBatchRunner();
+
+  /** Sets the script executed by each run.
+      @param script path of the script, relative to the root directory.
+      @param initfile optional initialization file overriding the one
+                      specified by the script. */
+  void SetScript(const SGPath& script, const SGPath& initfile=SGPath());
+
+  /** Sets the aircraft and initialization file executed by each run when no
+      script is used. The runs then end at the time given by SetEndTime(). */
+  void SetAircraft(const std::string& aircraft, const SGPath& initfile);
+
+  /// Sets the time at which the runs are stopped (default: no limit).
+  void SetEndTime(double time) { EndTime = time; }
+
+  /** Sets the integration time step of the runs. A value of zero (the
+      default) keeps the time step of the script. */
+  void SetDeltaT(double dt) { DeltaT = dt; }
+
+  /** Sets the number of worker threads. A value of zero (the default) uses
+      as many threads as the hardware supports. */
+  void SetNumThreads(unsigned int n) { NumThreads = n; }
+
+  /// Sets the random seed (simulation/randomseed) shared by all the runs.
+  void SetRandomSeed(int seed) { RandomSeed = seed; }
+
+  /// Sets the debug level of the FGFDMExec instances owned by the workers.
+  void SetDebugLevel(int level) { DebugLevel = level; }
+
+  /// Sets a callback invoked at the end of each successful run.
+  void SetRunCallback(const RunCallback& callback) { Callback = callback; }
+
+  /// Adds a property which value is collected at the end of each run.
+  void AddOutputProperty(const std::string& property)
+  { OutputProperties.push_back(property); }
+
+  /// Returns the properties collected at the end of each run.
+  const std::vector<std::string>& GetOutputProperties(void) const
+  { return OutputProperties; }
+
+  /// Adds a run to the batch. Returns the index of the run.
+  unsigned int AddCase(const Case& run);
+
+  /// Returns the number of runs in the batch.
+  size_t GetNumCases(void) const { return Cases.size(); }
+
+  /** Executes all the runs of the batch.
+      @return the results of the runs, in the order of AddCase(). */
+  const std::vector<Result>& Run(void);
+
+  /// Returns the results of the last call to Run().
+  const std::vector<Result>& GetResults(void) const { return Results; }
+
+private:
+  class WorkQueues;
+
+  SGPath RootDir;
+  SGPath ScriptName;
+  SGPath InitFile;
+  std::string AircraftName;
+  double EndTime;
+  double DeltaT;
+  unsigned int NumThreads;
+  int DebugLevel;
+  int RandomSeed;
+  RunCallback Callback;
+  std::vector<std::string> OutputProperties;
+  std::vector<Case> Cases;
+  std::vector<Result> Results;
+
+  void Worker(unsigned int id, WorkQueues& queues);
+  FGFDMExec* CreateExec(unsigned int index) const;
+  void Execute(FGFDMExec* fdmex, const std::string& state, unsigned int index);
+  void Debug(int from);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
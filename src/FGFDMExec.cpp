@@ -66,7 +66,7 @@ INCLUDES
 #include "models/FGOutput.h"
 #include "initialization/FGTrim.h"
 #include "input_output/FGScript.h"
-#include "input_output/FGXMLFileRead.h"
+#include "input_output/FGXMLDocumentCache.h"
 
 using namespace std;
 
@@ -97,7 +97,14 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, unsigned int* fdmctr) : Root(root)
   StandAlone = false;
   ResetMode = 0;
   RandomSeed = 0;
+  RunIndex = 0;
+  CompileFunctions = true;
   HoldDown = false;
+  messageId = 0;
+
+  RandomGenerator = std::make_shared<RandomNumberGenerator>();
+  DocumentCache = FGXMLDocumentCache::GetShared();
+  ScriptDeltaT = 0.0;
 
   IncrementThenHolding = false;  // increment then hold is off by default
   TimeStepsUntilHold = -1;
@@ -133,9 +140,16 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, unsigned int* fdmctr) : Root(root)
   // Prepare FDMctr for the next child FDM id
   (*FDMctr)++;       // instance. "child" instances are loaded last.
 
+  SeedRandomGenerators();
+
   FGPropertyNode* instanceRoot = Root->GetNode("/fdm/jsbsim",IdFDM,true);
   instance = new FGPropertyManager(instanceRoot);
 
+  Profiler = new FGProfiler(instance);
+  char* profile = getenv("JSBSIM_PROFILE");
+  if (profile && atoi(profile) != 0)
+    Profiler->SetEnabled(true);
+
   try {
     char* num = getenv("JSBSIM_DISPERSE");
     if (num) {
@@ -146,6 +160,10 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, unsigned int* fdmctr) : Root(root)
     std::cerr << "Could not process JSBSIM_DISPERSIONS environment variable: Assumed NO dispersions." << endl;
   }
 
+  char* interpreter = getenv("JSBSIM_FUNCTION_INTERPRETER");
+  if (interpreter && atoi(interpreter) != 0)
+    CompileFunctions = false;  // evaluate the functions with the tree
+
   Debug(0);
   // this is to catch errors in binding member functions to the property tree.
   try {
@@ -165,6 +183,7 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, unsigned int* fdmctr) : Root(root)
   instance->Tie("simulation/reset", this, (iPMF)0, &FGFDMExec::ResetToInitialConditions, false);
   instance->Tie("simulation/disperse", this, &FGFDMExec::GetDisperse);
   instance->Tie("simulation/randomseed", this, (iPMF)&FGFDMExec::SRand, &FGFDMExec::SRand, false);
+  instance->Tie("simulation/run-index", this, &FGFDMExec::GetRunIndex, &FGFDMExec::SetRunIndex, false);
   instance->Tie("simulation/terminate", (int *)&Terminate);
   instance->Tie("simulation/pause", (int *)&holding);
   instance->Tie("simulation/sim-time-sec", this, &FGFDMExec::GetSimTime);
@@ -185,6 +204,7 @@ FGFDMExec::~FGFDMExec()
     Unbind();
     DeAllocate();
 
+    delete Profiler;
     delete instance;
 
     if (IdFDM == 0) { // Meaning this is no child FDM
@@ -207,7 +227,8 @@ FGFDMExec::~FGFDMExec()
 
   PropertyCatalog.clear();
 
-  /* SetGroundCallback(0); */
+  // Do not leave a dangling generator in the current thread.
+  Element::SetDispersionGenerator(nullptr);
 
   if (FDMctr != 0) (*FDMctr)--;
 
@@ -265,6 +286,18 @@ bool FGFDMExec::Allocate(void)
   Accelerations = (FGAccelerations*)Models[eAccelerations];
   Output = (FGOutput*)Models[eOutput];
 
+  // The names of the timers follow the order of the eModels enum.
+  static const char* ModelNames[eNumStandardModels] = {
+    "propagate", "input", "inertial", "atmosphere", "winds", "systems",
+    "mass-balance", "auxiliary", "propulsion", "aerodynamics",
+    "ground-reactions", "external-reactions", "buoyant-forces", "aircraft",
+    "accelerations", "output" };
+
+  FrameTimer = Profiler->AddTimer("frame");
+  ModelTimers.resize(eNumStandardModels);
+  for (unsigned int i = 0; i < eNumStandardModels; i++)
+    ModelTimers[i] = Profiler->AddTimer(string("models/") + ModelNames[i]);
+
   // Initialize planet (environment) constants
   LoadPlanetConstants();
 
@@ -308,6 +341,7 @@ bool FGFDMExec::DeAllocate(void)
 bool FGFDMExec::Run(void)
 {
   bool success=true;
+  FGProfiler::Sample frameSample(*Profiler, FrameTimer);
 
   Debug(2);
 
@@ -323,6 +357,7 @@ bool FGFDMExec::Run(void)
 
   for (unsigned int i = 0; i < Models.size(); i++) {
     LoadInputs(i);
+    FGProfiler::Sample sample(*Profiler, ModelTimers[i]);
     Models[i]->Run(holding);
   }
 
@@ -333,6 +368,8 @@ bool FGFDMExec::Run(void)
     ResetToInitialConditions(mode);
   }
 
+  instance->UpdateJournal();
+
   if (Terminate) success = false;
 
   return success;
@@ -615,6 +652,204 @@ void FGFDMExec::ResetToInitialConditions(int mode)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+string FGFDMExec::SaveState(void)
+{
+  FGStateArchive archive;
+
+  SerializeState(archive);
+  return archive.GetBlob();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::RestoreState(const string& blob)
+{
+  FGStateArchive archive(blob);
+
+  SerializeState(archive);
+  archive.Finish();
+
+  GetGroundCallback()->SetTime(sim_time);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The state of the executive is followed by the initial conditions, the state
+// of its child FDMs, of its models, of the script and finally by the values of
+// the properties.
+
+void FGFDMExec::SerializeState(FGStateArchive& archive)
+{
+  const uint32_t version = 2;
+  uint32_t saved_version = version;
+  archive.Sync(saved_version);
+  if (saved_version != version)
+    throw string("The state blob was not saved by this version of JSBSim");
+
+  archive.Sync(Frame, Terminate, dT, saved_dT, sim_time, holding,
+               IncrementThenHolding, TimeStepsUntilHold, trim_status,
+               trim_completed, HoldDown);
+  archive.Sync(*RandomGenerator);
+  IC->SerializeState(archive);
+
+  archive.SyncCount(ChildFDMList.size(), "child FDMs");
+  for (auto child: ChildFDMList)
+    child->exec->SerializeState(archive);
+
+  for (auto model: Models)
+    model->SerializeState(archive);
+
+  bool hasScript = Script != nullptr;
+  archive.Sync(hasScript);
+  if (hasScript != (Script != nullptr))
+    throw string("The state blob does not match the simulation: the script"
+                 " differs");
+  if (Script) Script->SerializeState(archive);
+
+  SerializeProperties(archive);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The properties which are tied to a model are saved with the model. Only the
+// numeric properties which hold their own value are saved here: the inputs
+// set by the scripts and the applications, the outputs of the FCS components
+// and the local properties of the systems.
+
+void FGFDMExec::SerializeProperties(FGStateArchive& archive)
+{
+  vector<SGPropertyNode*> nodes;
+  vector<SGPropertyNode*> stack(1, instance->GetNode());
+
+  while (!stack.empty()) {
+    SGPropertyNode* node = stack.back();
+    stack.pop_back();
+
+    for (int i=node->nChildren()-1; i>=0; i--)
+      stack.push_back(node->getChild(i));
+
+    if (node->isTied() || !node->getAttribute(SGPropertyNode::WRITE))
+      continue;
+
+    switch (node->getType()) {
+    case simgear::props::BOOL:
+    case simgear::props::INT:
+    case simgear::props::LONG:
+    case simgear::props::FLOAT:
+    case simgear::props::DOUBLE:
+      nodes.push_back(node);
+      break;
+    default:
+      break;
+    }
+  }
+
+  archive.SyncCount(nodes.size(), "properties");
+  for (auto node: nodes) {
+    double value = node->getDoubleValue();
+    archive.Sync(value);
+    if (!archive.IsSaving()) node->setDoubleValue(value);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The clone loads the same model as this executive, from the documents of the
+// shared cache, but does not run the initial conditions: its outputs would
+// open the files and the sockets of this executive. Its state is copied
+// instead.
+
+FGFDMExec* FGFDMExec::Clone(void)
+{
+  if (!modelLoaded)
+    throw string("FGFDMExec::Clone: no model is loaded");
+
+  FGFDMExec* clone = new FGFDMExec();
+
+  try {
+    clone->DocumentCache = DocumentCache;
+    clone->RootDir = RootDir;
+    clone->AircraftPath = AircraftPath;
+    clone->EnginePath = EnginePath;
+    clone->SystemsPath = SystemsPath;
+    clone->RandomSeed = RandomSeed;
+    clone->RunIndex = RunIndex;
+    clone->CompileFunctions = CompileFunctions;
+    clone->disperse = disperse;
+
+    for (auto& directives: OutputDirectives)
+      if (!directives.second && !clone->SetOutputDirectives(directives.first))
+        throw string("FGFDMExec::Clone: the output directives cannot be set");
+
+    bool loaded;
+    if (Script)
+      loaded = clone->LoadScript(ScriptFile, ScriptDeltaT, ScriptInitFile);
+    else
+      loaded = clone->LoadModel(modelName, FullAircraftPath != AircraftPath);
+    if (!loaded)
+      throw string("FGFDMExec::Clone: the model cannot be loaded");
+
+    for (auto& directives: OutputDirectives)
+      if (directives.second && !clone->SetOutputDirectives(directives.first))
+        throw string("FGFDMExec::Clone: the output directives cannot be set");
+
+    clone->DisableOutput();
+    clone->GetInput()->Disable();
+
+    // Copy the properties created by the application, then copy their values
+    // again after the state is restored in case the clone created them in a
+    // different order.
+    CopyProperties(instance->GetNode(), clone->instance->GetNode());
+
+    FGGroundCallback* callback = clone->GetGroundCallback();
+    const FGLocation& location = Propagate->GetLocation();
+    callback->SetTerrainGeoCentRadius(GroundCallback->GetTerrainGeoCentRadius(location));
+    callback->SetSeaLevelRadius(GroundCallback->GetSeaLevelRadius(location));
+
+    clone->RestoreState(SaveState());
+    CopyProperties(instance->GetNode(), clone->instance->GetNode());
+  } catch (...) {
+    delete clone;
+    Element::SetDispersionGenerator(&DispersionGenerator);
+    throw;
+  }
+
+  // The clone has made its generator the current one.
+  Element::SetDispersionGenerator(&DispersionGenerator);
+
+  return clone;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Copies the values of the numeric properties which are not tied, creating
+// them if needed, so that the properties saved by SerializeProperties() match.
+
+void FGFDMExec::CopyProperties(const SGPropertyNode* from, SGPropertyNode* to)
+{
+  for (int i=0; i<from->nChildren(); i++) {
+    const SGPropertyNode* child = from->getChild(i);
+    SGPropertyNode* copy = to->getChild(child->getNameString(),
+                                        child->getIndex(), true);
+
+    CopyProperties(child, copy);
+
+    if (child->isTied() || !child->getAttribute(SGPropertyNode::WRITE))
+      continue;
+
+    switch (child->getType()) {
+    case simgear::props::BOOL:
+    case simgear::props::INT:
+    case simgear::props::LONG:
+    case simgear::props::FLOAT:
+    case simgear::props::DOUBLE:
+      if (!copy->isTied() && copy->getAttribute(SGPropertyNode::WRITE))
+        copy->setDoubleValue(child->getDoubleValue());
+      break;
+    default:
+      break;
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFDMExec::SetHoldDown(bool hd)
 {
   HoldDown = hd;
@@ -649,8 +884,14 @@ bool FGFDMExec::LoadScript(const SGPath& script, double deltaT,
 {
   bool result;
 
+  Element::SetDispersionGenerator(&DispersionGenerator);
+
+  ScriptFile = GetFullPath(script);
+  ScriptDeltaT = deltaT;
+  ScriptInitFile = initfile;
+
   Script = new FGScript(this);
-  result = Script->LoadScript(GetFullPath(script), deltaT, initfile);
+  result = Script->LoadScript(ScriptFile, deltaT, initfile);
 
   return result;
 }
@@ -690,11 +931,17 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
   if (modelLoaded) {
     DeAllocate();
     Allocate();
+    OutputDirectives.clear();
   }
 
+  FunctionStats = FunctionStatistics();
+
+  // The dispersions drawn while loading only depend on the seed and run index.
+  SeedRandomGenerators();
+  Element::SetDispersionGenerator(&DispersionGenerator);
+
   int saved_debug_lvl = debug_lvl;
-  FGXMLFileRead XMLFileRead;
-  Element *document = XMLFileRead.LoadXMLDocument(aircraftCfgFileName); // "document" is a class member
+  Element_ptr document = DocumentCache->Load(aircraftCfgFileName);
 
   if (document) {
     if (IsChild) debug_lvl = 0;
@@ -865,6 +1112,7 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
     LoadModelConstants();
 
     modelLoaded = true;
+    Debug(4);
 
     if (IsChild) debug_lvl = saved_debug_lvl;
 
@@ -888,6 +1136,17 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGFDMExec::SetOutputDirectives(const SGPath& fname)
+{
+  SGPath path = GetFullPath(fname);
+  bool result = Output->SetDirectivesFile(path);
+
+  if (result) OutputDirectives.push_back(make_pair(path, modelLoaded));
+  return result;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 string FGFDMExec::GetPropulsionTankReport()
 {
   return ((FGPropulsion*)Models[ePropulsion])->GetPropulsionTankReport();
@@ -1056,6 +1315,9 @@ bool FGFDMExec::ReadChild(Element* el)
 
   child->exec = new FGFDMExec(Root, FDMctr);
   child->exec->SetChild(true);
+  child->exec->RandomSeed = RandomSeed;
+  child->exec->RunIndex = RunIndex;
+  child->exec->CompileFunctions = CompileFunctions;
 
   string childAircraft = el->GetAttributeValue("name");
   string sMated = el->GetAttributeValue("mated");
@@ -1067,6 +1329,8 @@ bool FGFDMExec::ReadChild(Element* el)
   child->exec->SetEnginePath( EnginePath );
   child->exec->SetSystemsPath( SystemsPath );
   child->exec->LoadModel(childAircraft);
+  // Restore the generator of this FDM that the child has replaced.
+  Element::SetDispersionGenerator(&DispersionGenerator);
 
   Element* location = el->FindElement("location");
   if (location) {
@@ -1151,11 +1415,139 @@ void FGFDMExec::DoTrim(int mode)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFDMExec::PutMessage(const Message& msg)
+{
+  Messages.push(msg);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::PutMessage(const string& text)
+{
+  Message msg;
+  msg.text = text;
+  msg.messageId = messageId++;
+  msg.subsystem = "FDM";
+  msg.type = Message::eText;
+  Messages.push(msg);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::PutMessage(const string& text, bool bVal)
+{
+  Message msg;
+  msg.text = text;
+  msg.messageId = messageId++;
+  msg.subsystem = "FDM";
+  msg.type = Message::eBool;
+  msg.bVal = bVal;
+  Messages.push(msg);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::PutMessage(const string& text, int iVal)
+{
+  Message msg;
+  msg.text = text;
+  msg.messageId = messageId++;
+  msg.subsystem = "FDM";
+  msg.type = Message::eInteger;
+  msg.iVal = iVal;
+  Messages.push(msg);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::PutMessage(const string& text, double dVal)
+{
+  Message msg;
+  msg.text = text;
+  msg.messageId = messageId++;
+  msg.subsystem = "FDM";
+  msg.type = Message::eDouble;
+  msg.dVal = dVal;
+  Messages.push(msg);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::ProcessMessage(void)
+{
+  if (Messages.empty()) return;
+  localMsg = Messages.front();
+
+  while (SomeMessages()) {
+      switch (localMsg.type) {
+      case JSBSim::FGJSBBase::Message::eText:
+        cout << localMsg.messageId << ": " << localMsg.text << endl;
+        break;
+      case JSBSim::FGJSBBase::Message::eBool:
+        cout << localMsg.messageId << ": " << localMsg.text << " " << localMsg.bVal << endl;
+        break;
+      case JSBSim::FGJSBBase::Message::eInteger:
+        cout << localMsg.messageId << ": " << localMsg.text << " " << localMsg.iVal << endl;
+        break;
+      case JSBSim::FGJSBBase::Message::eDouble:
+        cout << localMsg.messageId << ": " << localMsg.text << " " << localMsg.dVal << endl;
+        break;
+      default:
+        cerr << "Unrecognized message type." << endl;
+        break;
+      }
+      Messages.pop();
+      if (SomeMessages()) localMsg = Messages.front();
+      else break;
+  }
+
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGJSBBase::Message* FGFDMExec::ProcessNextMessage(void)
+{
+  if (Messages.empty()) return NULL;
+  localMsg = Messages.front();
+
+  Messages.pop();
+  return &localMsg;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFDMExec::SRand(int sr)
 {
   RandomSeed = sr;
-  gaussian_random_number_phase = 0;
-  srand(RandomSeed);
+  SeedRandomGenerators();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::SetRunIndex(int index)
+{
+  RunIndex = index;
+  SeedRandomGenerators();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::SeedRandomGenerators(void)
+{
+  // Each FDM draws from two streams: one for the models executed at run time
+  // and one for the dispersions applied while the model is loaded. The child
+  // FDMs get their own streams thanks to their ID.
+  uint64_t stream = ((uint64_t)(unsigned int)RunIndex << 32) | (IdFDM << 1);
+
+  RandomGenerator->seed(RandomSeed, stream);
+  DispersionGenerator.seed(RandomSeed, stream | 1);
+
+  for (unsigned int i=0; i<ChildFDMList.size(); i++) {
+    FGFDMExec* child = ChildFDMList[i]->exec;
+    child->RandomSeed = RandomSeed;
+    child->RunIndex = RunIndex;
+    child->SeedRandomGenerators();
+  }
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -1206,6 +1598,14 @@ void FGFDMExec::Debug(int from)
   }
   if (debug_lvl & 16) { // Sanity checking
   }
+  if (debug_lvl & 32) { // Simplification of the functions
+    if (from == 4) {
+      cout << endl << "Functions of " << modelName << ": "
+           << FunctionStats.nodes << " nodes loaded, " << FunctionStats.folded
+           << " folded into constants, " << FunctionStats.eliminated
+           << " nodes removed" << endl;
+    }
+  }
   if (debug_lvl & 64) {
     if (from == 0) { // Constructor
     }
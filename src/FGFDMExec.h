@@ -43,8 +43,12 @@ INCLUDES
 
 #include <vector>
 #include <string>
+#include <queue>
+#include <memory>
+#include <utility>
 
 #include "FGJSBBase.h"
+#include "FGProfiler.h"
 #include "input_output/FGPropertyManager.h"
 #include "models/FGPropagate.h"
 #include "math/FGColumnVector3.h"
@@ -58,6 +62,7 @@ FORWARD DECLARATIONS
 namespace JSBSim {
 
 class FGScript;
+class FGXMLDocumentCache;
 class FGTrim;
 class FGAerodynamics;
 class FGAircraft;
@@ -164,6 +169,9 @@ CLASS DOCUMENTATION
        are printed out periodically
     - <b>16</b>: When set various parameters are sanity checked and
        a message is printed out when they go out of bounds
+    - <b>32</b>: When set, the number of function nodes that have been
+       simplified (folded into constants or removed as dead code) is
+       printed out once the model is loaded
 
     <h3>Properties</h3>
     @property simulator/do_trim (write only) Can be set to the integer equivalent to one of
@@ -246,7 +254,8 @@ public:
   /** Unbind all tied JSBSim properties. */
   void Unbind(void) {instance->Unbind();}
 
-  /** This function executes each scheduled model in succession.
+  /** This function executes each scheduled model in succession then updates
+      the journal of the property changes (see FGPropertyManager::Watch).
       @return true if successful, false if sim should be ended  */
   bool Run(void);
 
@@ -262,7 +271,7 @@ public:
       @param gc A pointer to a ground callback object
       @see FGGroundCallback
    */
-  void SetGroundCallback(FGGroundCallback* gc) { FGLocation::SetGroundCallback(gc); }
+  void SetGroundCallback(FGGroundCallback* gc) { GroundCallback = gc; }
 
   /** Loads an aircraft model.
       @param AircraftPath path to the aircraft/ directory. For instance:
@@ -372,15 +381,104 @@ public:
       @return A pointer to the current ground callback object.
       @see FGGroundCallback
    */
-  FGGroundCallback* GetGroundCallback(void) {return FGLocation::GetGroundCallback();}
+  FGGroundCallback* GetGroundCallback(void) {return GroundCallback;}
+  /** Get the smart pointer which holds the ground callback. The locations of
+      the models are bound to it so that each executive uses its own ground
+      callback and that the locations follow a change of the ground callback.
+      @see FGLocation::SetGroundCallback
+   */
+  const FGGroundCallback_ptr* GetGroundCallbackPtr(void) const
+  { return &GroundCallback; }
   /// Retrieves the script object
   FGScript* GetScript(void) {return Script;}
   /// Returns a pointer to the FGInitialCondition object
   FGInitialCondition* GetIC(void)      {return IC;}
   /// Returns a pointer to the FGTrim object
   FGTrim* GetTrim(void);
+  /// Returns the random number generator of this simulation.
+  std::shared_ptr<RandomNumberGenerator> GetRandomGenerator(void) const
+  { return RandomGenerator; }
+  /** Sets the index of the run (property simulation/run-index). The random
+      sequences of the simulation are keyed by the random seed and the run
+      index so that any run of a Monte Carlo study can be reproduced on its
+      own. Changing the run index restarts the random sequences.
+      @param index the run index. */
+  void SetRunIndex(int index);
+  /// Returns the index of the run.
+  int GetRunIndex(void) const {return RunIndex;}
+  /// Returns the profiler which times the frames of this simulation.
+  FGProfiler& GetProfiler(void) {return *Profiler;}
+  /** Enables or disables the timing of the frames, of the models, of the FCS
+      channels and of the engines (see FGProfiler). The profiling can also be
+      enabled by setting the environment variable JSBSIM_PROFILE to a non zero
+      value.
+      @param enable true to enable the profiling. */
+  void SetProfiling(bool enable) {Profiler->SetEnabled(enable);}
+  /** Selects how the functions are evaluated. By default, the functions are
+      compiled into a flat program when they are loaded (see
+      FGFunctionProgram). The tree interpreter can be used instead for
+      debugging purposes, either by calling this method before the model is
+      loaded or by setting the environment variable
+      JSBSIM_FUNCTION_INTERPRETER to a non zero value.
+      @param compile false to evaluate the functions loaded afterwards with
+                     the tree interpreter. */
+  void SetCompileFunctions(bool compile) {CompileFunctions = compile;}
+  /// Returns true if the functions are compiled when they are loaded.
+  bool GetCompileFunctions(void) const {return CompileFunctions;}
+
+  /// Statistics of the simplification of the functions of the model.
+  struct FunctionStatistics {
+    FunctionStatistics(void) : nodes(0), folded(0), eliminated(0) {}
+    /// Number of nodes (operations, values, properties and tables) loaded.
+    unsigned int nodes;
+    /// Number of operations and properties replaced by a constant.
+    unsigned int folded;
+    /// Number of nodes removed by the folding and the dead code elimination.
+    unsigned int eliminated;
+  };
+  /** Returns the statistics of the simplification of the functions loaded by
+      the last call to LoadModel(). They are reported when the bit 32 of the
+      debug level is set. */
+  FunctionStatistics& GetFunctionStatistics(void) {return FunctionStats;}
   ///@}
 
+  ///@name JSBSim Messaging functions
+  //@{
+  /** Places a Message structure on the Message queue.
+      @param msg pointer to a Message structure
+      @return pointer to a Message structure */
+  void PutMessage(const Message& msg);
+  /** Creates a message with the given text and places it on the queue.
+      @param text message text
+      @return pointer to a Message structure */
+  void PutMessage(const std::string& text);
+  /** Creates a message with the given text and boolean value and places it on the queue.
+      @param text message text
+      @param bVal boolean value associated with the message
+      @return pointer to a Message structure */
+  void PutMessage(const std::string& text, bool bVal);
+  /** Creates a message with the given text and integer value and places it on the queue.
+      @param text message text
+      @param iVal integer value associated with the message
+      @return pointer to a Message structure */
+  void PutMessage(const std::string& text, int iVal);
+  /** Creates a message with the given text and double value and places it on the queue.
+      @param text message text
+      @param dVal double value associated with the message
+      @return pointer to a Message structure */
+  void PutMessage(const std::string& text, double dVal);
+  /** Reads the message on the queue (but does not delete it).
+      @return 1 if some messages */
+  int SomeMessages(void) const { return !Messages.empty(); }
+  /** Reads the message on the queue and removes it from the queue.
+      This function also prints out the message.*/
+  void ProcessMessage(void);
+  /** Reads the next message on the queue and removes it from the queue.
+      This function also prints out the message.
+      @return a pointer to the message, or NULL if there are no messages.*/
+  Message* ProcessNextMessage(void);
+  //@}
+
   /// Retrieves the engine path.
   const SGPath& GetEnginePath(void)    {return EnginePath;}
   /// Retrieves the aircraft path.
@@ -393,14 +491,17 @@ public:
   /** Retrieves the value of a property.
       @param property the name of the property
       @result the value of the specified property */
-  inline double GetPropertyValue(const std::string& property)
-  { return instance->GetNode()->GetDouble(property); }
+  inline double GetPropertyValue(const std::string& property) {
+    int handle = instance->GetHandle(property);
+    return handle < 0 ? 0.0 : instance->GetValue(handle);
+  }
 
   /** Sets a property value.
       @param property the property to be set
       @param value the value to set the property to */
   inline void SetPropertyValue(const std::string& property, double value) {
-    instance->GetNode()->SetDouble(property, value);
+    int handle = instance->GetHandle(property, true);
+    if (handle >= 0) instance->SetValue(handle, value);
   }
 
   /// Returns the model name.
@@ -432,8 +533,7 @@ public:
       be logged.
       @param fname the filename of an output directives file.
     */
-  bool SetOutputDirectives(const SGPath& fname)
-  { return Output->SetDirectivesFile(GetFullPath(fname)); }
+  bool SetOutputDirectives(const SGPath& fname);
 
   /** Forces the specified output object to print its items once */
   void ForceOutput(int idx=0) { Output->ForceOutput(idx); }
@@ -484,6 +584,47 @@ public:
       different name.
       @param mode Sets the reset mode.*/
   void ResetToInitialConditions(int mode);
+
+  /** Saves the state of the simulation into a binary blob.
+      The blob holds the time, the state of all the models (including the
+      past values used by the integrators and the filters, the engines, the
+      tanks and the gear), the status of the script events, the random
+      number generator, the child FDMs and the values of the properties that
+      are not tied to a model. Restoring it with RestoreState() makes the
+      simulation continue exactly as it would have from the time it was
+      saved, without running the initialization of the models again.
+      The output files and sockets are not part of the state.
+      @return the blob.
+      @see FGStateArchive */
+  std::string SaveState(void);
+
+  /** Restores a state saved by SaveState(). The blob can be restored any
+      number of times, in the simulation which saved it or in a simulation
+      with the same aircraft, script and properties.
+      @param blob the blob returned by SaveState().
+      @throw std::string if the blob does not match the simulation. The
+             simulation is then left in an undefined state. */
+  void RestoreState(const std::string& blob);
+
+  /** Creates a copy of this simulation, with the same model in the same state.
+      The copy loads its model from the XML documents read by this simulation,
+      which are kept in memory, instead of reading and parsing the files
+      again. Its state is then copied with SaveState() and RestoreState(),
+      so that both simulations continue identically.
+      The outputs and the inputs of the copy are disabled so that it does not
+      write to the files and the sockets of this simulation. The ground
+      callback of the copy is a default ground callback with the radii of the
+      ground callback of this simulation: a custom ground callback must be set
+      again on the copy.
+      @return the copy, which is owned by the caller.
+      @throw std::string if no model is loaded or if it cannot be copied. */
+  FGFDMExec* Clone(void);
+
+  /** Returns the cache of the XML documents read by this simulation. By
+      default, it is the cache shared by all the simulations of the process.
+      @see FGXMLDocumentCache::GetShared */
+  std::shared_ptr<FGXMLDocumentCache> GetDocumentCache(void) const
+  { return DocumentCache; }
   /// Sets the debug level.
   void SetDebugLevel(int level) {debug_lvl = level;}
 
@@ -606,6 +747,9 @@ private:
   bool IncrementThenHolding;
   int TimeStepsUntilHold;
   int RandomSeed;
+  int RunIndex;
+  bool CompileFunctions;
+  FunctionStatistics FunctionStats;
   bool Constructing;
   bool modelLoaded;
   bool IsChild;
@@ -617,6 +761,12 @@ private:
   std::string CFGVersion;
   std::string Release;
   SGPath RootDir;
+  SGPath ScriptFile;
+  double ScriptDeltaT;
+  SGPath ScriptInitFile;
+  // The output directives files and whether they were set after the model was
+  // loaded, so that a clone adds its outputs in the same order.
+  std::vector<std::pair<SGPath, bool>> OutputDirectives;
 
   // Standard Model pointers - shortcuts for internal executive use only.
   FGPropagate* Propagate;
@@ -648,6 +798,19 @@ private:
   bool StandAlone;
   FGPropertyManager* instance;
 
+  FGProfiler* Profiler;
+  unsigned int FrameTimer;
+  std::vector<unsigned int> ModelTimers;
+
+  FGGroundCallback_ptr GroundCallback;
+  std::shared_ptr<RandomNumberGenerator> RandomGenerator;
+  RandomNumberGenerator DispersionGenerator;
+  std::shared_ptr<FGXMLDocumentCache> DocumentCache;
+
+  std::queue <Message> Messages;
+  Message localMsg;
+  unsigned int messageId;
+
   bool HoldDown;
 
   // The FDM counter is used to give each child FDM an unique ID. The root FDM has the ID 0
@@ -662,7 +825,11 @@ private:
   bool ReadPrologue(Element*);
   void SRand(int sr);
   int  SRand(void) const {return RandomSeed;}
+  void SeedRandomGenerators(void);
   void LoadInputs(unsigned int idx);
+  void SerializeState(FGStateArchive& archive);
+  void SerializeProperties(FGStateArchive& archive);
+  void CopyProperties(const SGPropertyNode* from, SGPropertyNode* to);
   void LoadPlanetConstants(void);
   void LoadModelConstants(void);
   bool Allocate(void);
@@ -40,7 +40,6 @@ INCLUDES
 #include "FGJSBBase.h"
 #include <iostream>
 #include <sstream>
-#include <cstdlib>
 #include "models/FGAtmosphere.h"
 
 using namespace std;
@@ -104,114 +103,7 @@ const double FGJSBBase::kgtoslug = 0.06852168;
 const string FGJSBBase::needed_cfg_version = "2.0";
 const string FGJSBBase::JSBSim_version = JSBSIM_VERSION " " __DATE__ " " __TIME__ ;
 
-queue <FGJSBBase::Message> FGJSBBase::Messages;
-FGJSBBase::Message FGJSBBase::localMsg;
-unsigned int FGJSBBase::messageId = 0;
-
-int FGJSBBase::gaussian_random_number_phase = 0;
-
-short FGJSBBase::debug_lvl  = 1;
-
-//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-
-void FGJSBBase::PutMessage(const Message& msg)
-{
-  Messages.push(msg);
-}
-
-//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-
-void FGJSBBase::PutMessage(const string& text)
-{
-  Message msg;
-  msg.text = text;
-  msg.messageId = messageId++;
-  msg.subsystem = "FDM";
-  msg.type = Message::eText;
-  Messages.push(msg);
-}
-
-//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-
-void FGJSBBase::PutMessage(const string& text, bool bVal)
-{
-  Message msg;
-  msg.text = text;
-  msg.messageId = messageId++;
-  msg.subsystem = "FDM";
-  msg.type = Message::eBool;
-  msg.bVal = bVal;
-  Messages.push(msg);
-}
-
-//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-
-void FGJSBBase::PutMessage(const string& text, int iVal)
-{
-  Message msg;
-  msg.text = text;
-  msg.messageId = messageId++;
-  msg.subsystem = "FDM";
-  msg.type = Message::eInteger;
-  msg.iVal = iVal;
-  Messages.push(msg);
-}
-
-//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-
-void FGJSBBase::PutMessage(const string& text, double dVal)
-{
-  Message msg;
-  msg.text = text;
-  msg.messageId = messageId++;
-  msg.subsystem = "FDM";
-  msg.type = Message::eDouble;
-  msg.dVal = dVal;
-  Messages.push(msg);
-}
-
-//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-
-void FGJSBBase::ProcessMessage(void)
-{
-  if (Messages.empty()) return;
-  localMsg = Messages.front();
-
-  while (SomeMessages()) {
-      switch (localMsg.type) {
-      case JSBSim::FGJSBBase::Message::eText:
-        cout << localMsg.messageId << ": " << localMsg.text << endl;
-        break;
-      case JSBSim::FGJSBBase::Message::eBool:
-        cout << localMsg.messageId << ": " << localMsg.text << " " << localMsg.bVal << endl;
-        break;
-      case JSBSim::FGJSBBase::Message::eInteger:
-        cout << localMsg.messageId << ": " << localMsg.text << " " << localMsg.iVal << endl;
-        break;
-      case JSBSim::FGJSBBase::Message::eDouble:
-        cout << localMsg.messageId << ": " << localMsg.text << " " << localMsg.dVal << endl;
-        break;
-      default:
-        cerr << "Unrecognized message type." << endl;
-        break;
-      }
-      Messages.pop();
-      if (SomeMessages()) localMsg = Messages.front();
-      else break;
-  }
-
-}
-
-//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-
-FGJSBBase::Message* FGJSBBase::ProcessNextMessage(void)
-{
-  if (Messages.empty()) return NULL;
-  localMsg = Messages.front();
-
-  Messages.pop();
-  return &localMsg;
-}
+thread_local short FGJSBBase::debug_lvl  = 1;
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
@@ -241,34 +133,6 @@ string FGJSBBase::CreateIndexedPropertyName(const string& Property, int index)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-double FGJSBBase::GaussianRandomNumber(void)
-{
-  static double V1, V2, S;
-  double X;
-
-  if (gaussian_random_number_phase == 0) {
-    V1 = V2 = S = X = 0.0;
-
-    do {
-      double U1 = (double)rand() / RAND_MAX;
-      double U2 = (double)rand() / RAND_MAX;
-
-      V1 = 2 * U1 - 1;
-      V2 = 2 * U2 - 1;
-      S = V1 * V1 + V2 * V2;
-    } while(S >= 1 || S == 0);
-
-    X = V1 * sqrt(-2 * log(S) / S);
-  } else
-    X = V2 * sqrt(-2 * log(S) / S);
-
-  gaussian_random_number_phase = 1 - gaussian_random_number_phase;
-
-  return X;
-}
-
-//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-
 double FGJSBBase::PitotTotalPressure(double mach, double p)
 {
   if (mach < 0) return p;
@@ -39,9 +39,9 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include <float.h>
-#include <queue>
 #include <string>
 #include <cmath>
+#include <cstdint>
 
 #include "input_output/string_utilities.h"
 
@@ -59,9 +59,74 @@ namespace JSBSim {
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+/** Random number generator.
+    Each FGFDMExec instance owns its own generator so that the random sequences
+    of independent simulations neither interfere nor race with each other. The
+    models that need random numbers (sensors, turbulence, functions) get it
+    from FGFDMExec::GetRandomGenerator().
+
+    The generator is counter based: the n-th number of a sequence is a hash of
+    n and of a key computed from the seed and the stream index. Any draw of any
+    run can therefore be reproduced from the seed, the stream and the counter
+    without replaying the sequence, and streams with different indices are
+    statistically independent. The hash is the SplitMix64 finalizer.
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class RandomNumberGenerator {
+public:
+  /** Constructor.
+      @param value the seed of the random sequence
+      @param stream the index of the sequence for this seed */
+  explicit RandomNumberGenerator(unsigned int value=0, uint64_t stream=0)
+  { seed(value, stream); }
+
+  /// Restarts the random sequence from the supplied seed and stream.
+  void seed(unsigned int value, uint64_t stream=0) {
+    key = Hash(Hash(value) ^ Hash(stream + 0x632BE59BD9B4E019ULL));
+    counter = 0;
+  }
+
+  /// Returns the number of draws made since the generator was seeded.
+  uint64_t GetCounter(void) const { return counter; }
+  /// Moves the sequence to the supplied draw index.
+  void SetCounter(uint64_t value) { counter = value; }
+
+  /// Returns a uniformly distributed random number between -1 and +1.
+  double GetUniformRandomNumber(void) { return 2.0*Uniform() - 1.0; }
+  /** Returns a normally distributed random number (mean 0, std deviation 1).
+      The Box-Muller transform consumes two draws per number. */
+  double GetNormalRandomNumber(void) {
+    double r = sqrt(-2.0*log(1.0 - Uniform()));
+    return r*cos(2.0*M_PI*Uniform());
+  }
+
+private:
+  uint64_t key;
+  uint64_t counter;
+
+  static uint64_t Hash(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+  // Uniformly distributed in [0, 1) with a 53 bits resolution.
+  double Uniform(void) {
+    uint64_t z = Hash(key + (++counter) * 0x9E3779B97F4A7C15ULL);
+    return (z >> 11) * (1.0 / 9007199254740992.0);
+  }
+};
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
 /** JSBSim Base class.
-*   This class provides universal constants, utility functions, messaging
-*   functions, and enumerated constants to JSBSim.
+*   This class provides universal constants, utility functions and enumerated
+*   constants to JSBSim.
     @author Jon S. Berndt
 */
 
@@ -137,43 +202,6 @@ public:
   static char fgdef[6];
   //@}
 
-  ///@name JSBSim Messaging functions
-  //@{
-  /** Places a Message structure on the Message queue.
-      @param msg pointer to a Message structure
-      @return pointer to a Message structure */
-  void PutMessage(const Message& msg);
-  /** Creates a message with the given text and places it on the queue.
-      @param text message text
-      @return pointer to a Message structure */
-  void PutMessage(const std::string& text);
-  /** Creates a message with the given text and boolean value and places it on the queue.
-      @param text message text
-      @param bVal boolean value associated with the message
-      @return pointer to a Message structure */
-  void PutMessage(const std::string& text, bool bVal);
-  /** Creates a message with the given text and integer value and places it on the queue.
-      @param text message text
-      @param iVal integer value associated with the message
-      @return pointer to a Message structure */
-  void PutMessage(const std::string& text, int iVal);
-  /** Creates a message with the given text and double value and places it on the queue.
-      @param text message text
-      @param dVal double value associated with the message
-      @return pointer to a Message structure */
-  void PutMessage(const std::string& text, double dVal);
-  /** Reads the message on the queue (but does not delete it).
-      @return 1 if some messages */
-  int SomeMessages(void) { return !Messages.empty(); }
-  /** Reads the message on the queue and removes it from the queue.
-      This function also prints out the message.*/
-  void ProcessMessage(void);
-  /** Reads the next message on the queue and removes it from the queue.
-      This function also prints out the message.
-      @return a pointer to the message, or NULL if there are no messages.*/
-  Message* ProcessNextMessage(void);
-  //@}
-
   /** Returns the version number of JSBSim.
   *   @return The version number of JSBSim. */
   std::string GetVersion(void) {return JSBSim_version;}
@@ -181,7 +209,11 @@ public:
   /// Disables highlighting in the console output.
   void disableHighLighting(void);
 
-  static short debug_lvl;
+  /** The debug level. It is stored per thread so that independent
+      FGFDMExec instances running concurrently on different threads do not
+      race on it. Each FGFDMExec instance sets it from the JSBSIM_DEBUG
+      environment variable in the thread that constructs it. */
+  static thread_local short debug_lvl;
 
   /** Converts from degrees Kelvin to degrees Fahrenheit.
   *   @param kelvin The temperature in degrees Kelvin.
@@ -330,17 +362,9 @@ public:
   
   static double sign(double num) {return num>=0.0?1.0:-1.0;}
 
-  static double GaussianRandomNumber(void);
-
 protected:
-  static Message localMsg;
-
-  static std::queue <Message> Messages;
-
   void Debug(int) {};
 
-  static unsigned int messageId;
-
   static const double radtodeg;
   static const double degtorad;
   static const double hptoftlbssec;
@@ -362,8 +386,6 @@ protected:
 
   static std::string CreateIndexedPropertyName(const std::string& Property, int index);
 
-  static int gaussian_random_number_phase;
-
 public:
 /// Moments L, M, N
 enum {eL     = 1, eM,     eN    };
@@ -0,0 +1,176 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGProfiler.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+ Purpose:      Measures the wall time spent in the parts of a frame
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+#include "FGProfiler.h"
+#include "input_output/FGPropertyManager.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGProfiler::FGProfiler(FGPropertyManager* pm)
+  : PropertyManager(pm), enabled(false)
+{
+  PropertyManager->Tie("profile/enabled", this, &FGProfiler::GetEnabled,
+                       &FGProfiler::SetEnabled);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGProfiler::AddTimer(const string& name)
+{
+  for (unsigned int i=0; i<Timers.size(); i++)
+    if (Timers[i].name == name) return i;
+
+  int idx = Timers.size();
+  Timers.push_back(Timer(name));
+  Timers.back().window.reserve(WindowSize);
+
+  string base = "profile/" + name;
+  PropertyManager->Tie(base + "/last-us", this, idx, &FGProfiler::GetLast);
+  PropertyManager->Tie(base + "/mean-us", this, idx, &FGProfiler::GetMean);
+  PropertyManager->Tie(base + "/p99-us", this, idx, &FGProfiler::GetP99);
+
+  return idx;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGProfiler::SetEnabled(bool enable)
+{
+  if (enable && !enabled) Reset();
+  enabled = enable;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGProfiler::Reset(void)
+{
+  for (auto& timer: Timers) {
+    timer.window.clear();
+    timer.next = 0;
+    timer.count = 0;
+    timer.last = timer.sum = timer.total = timer.max = 0.0;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The window is a ring buffer: once it is full, each new sample replaces the
+// oldest one and the sum of the window is updated accordingly.
+
+void FGProfiler::Record(unsigned int idx, Clock::duration elapsed)
+{
+  Timer& timer = Timers[idx];
+  double us = chrono::duration<double, micro>(elapsed).count();
+
+  if (timer.window.size() < WindowSize)
+    timer.window.push_back(us);
+  else {
+    timer.sum -= timer.window[timer.next];
+    timer.window[timer.next] = us;
+    timer.next = (timer.next + 1) % WindowSize;
+  }
+
+  timer.sum += us;
+  timer.last = us;
+  timer.total += us;
+  timer.max = max(timer.max, us);
+  timer.count++;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGProfiler::GetMean(int idx) const
+{
+  const Timer& timer = Timers[idx];
+  if (timer.window.empty()) return 0.0;
+
+  return timer.sum / timer.window.size();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The percentile is only computed when it is requested so that recording a
+// sample stays cheap.
+
+double FGProfiler::GetP99(int idx) const
+{
+  const Timer& timer = Timers[idx];
+  if (timer.window.empty()) return 0.0;
+
+  vector<double> samples(timer.window);
+  size_t rank = (99 * samples.size() + 99) / 100 - 1;
+  nth_element(samples.begin(), samples.begin() + rank, samples.end());
+
+  return samples[rank];
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGProfiler::PrintSummary(ostream& out) const
+{
+  ios::fmtflags flags = out.flags();
+  streamsize precision = out.precision();
+  double frameTotal = 0.0;
+
+  for (auto& timer: Timers)
+    if (timer.name == "frame") frameTotal = timer.total;
+
+  out << endl << highint << "Profile of the simulation (microseconds)"
+      << reset << endl
+      << left << setw(40) << "  Timer" << right << setw(10) << "Calls"
+      << setw(10) << "Mean" << setw(10) << "P99" << setw(10) << "Max"
+      << setw(9) << "Frame" << endl;
+
+  for (unsigned int i=0; i<Timers.size(); i++) {
+    const Timer& timer = Timers[i];
+    if (timer.count == 0) continue;
+
+    out << "  " << left << setw(38) << timer.name << right << setw(10)
+        << timer.count << fixed << setprecision(2) << setw(10)
+        << timer.total / timer.count << setw(10) << GetP99(i) << setw(10)
+        << timer.max;
+    if (frameTotal > 0.0)
+      out << setprecision(1) << setw(8) << 100.0 * timer.total / frameTotal
+          << "%";
+    out << endl;
+  }
+
+  out.flags(flags);
+  out.precision(precision);
+}
+}
@@ -0,0 +1,178 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGProfiler.h
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/2026   Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGPROFILER_H
+#define FGPROFILER_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <chrono>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "FGJSBBase.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGPropertyManager;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Measures the wall time spent in the parts of a simulation frame.
+    Each FGFDMExec instance owns a profiler which times the whole frame, each
+    model, each channel of the flight control systems and each engine. The
+    profiler is disabled by default: it then costs a single test per timed
+    section. It can be enabled with FGFDMExec::SetProfiling(), with the
+    property <tt>profile/enabled</tt> or by setting the environment variable
+    JSBSIM_PROFILE to a non zero value.
+
+    The statistics of each timer are computed over a rolling window of the
+    last 1024 samples and are exposed as read-only properties (in
+    microseconds):
+    - <tt>profile/<i>timer</i>/last-us</tt>: the last sample,
+    - <tt>profile/<i>timer</i>/mean-us</tt>: the mean over the window,
+    - <tt>profile/<i>timer</i>/p99-us</tt>: the 99th percentile over the
+      window.
+
+    The timers are named <tt>frame</tt>, <tt>models/<i>model</i></tt> (e.g.
+    <tt>models/aerodynamics</tt>), <tt>fcs/<i>channel</i></tt> and
+    <tt>propulsion/engine[<i>n</i>]</tt>. PrintSummary() reports the number
+    of samples, the mean and the maximum since the profiler was enabled along
+    with the 99th percentile of the window.
+
+    Usage:
+    @code
+    unsigned int timer = profiler.AddTimer("models/aerodynamics");
+    {
+      FGProfiler::Sample sample(profiler, timer);
+      // timed code
+    }
+    @endcode
+
+    @author The JSBSim team
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGProfiler : public FGJSBBase
+{
+public:
+  typedef std::chrono::steady_clock Clock;
+
+  /** Times a section of code from its construction to its destruction. Nothing
+      is measured when the profiler is disabled. */
+  class Sample {
+  public:
+    Sample(FGProfiler& profiler, unsigned int timer)
+      : Profiler(profiler.enabled ? &profiler : nullptr), Index(timer)
+    { if (Profiler) Start = Clock::now(); }
+    ~Sample() { if (Profiler) Profiler->Record(Index, Clock::now() - Start); }
+
+  private:
+    FGProfiler* Profiler;
+    unsigned int Index;
+    Clock::time_point Start;
+  };
+
+  /** Constructor.
+      @param pm the property manager where the statistics are published. */
+  explicit FGProfiler(FGPropertyManager* pm);
+
+  /** Returns the index of the timer with the given name. The timer is created
+      and its properties are tied if it does not exist yet. */
+  unsigned int AddTimer(const std::string& name);
+
+  /// Returns the number of timers.
+  size_t GetNumTimers(void) const { return Timers.size(); }
+
+  /// Returns the name of a timer.
+  const std::string& GetTimerName(unsigned int timer) const
+  { return Timers[timer].name; }
+
+  /** Enables or disables the profiler. The statistics are cleared when the
+      profiler is enabled. */
+  void SetEnabled(bool enable);
+  bool GetEnabled(void) const { return enabled; }
+
+  /// Clears the statistics of all the timers.
+  void Reset(void);
+
+  /// Adds a sample to a timer.
+  void Record(unsigned int timer, Clock::duration elapsed);
+
+  /// Returns the number of samples of a timer since the last reset.
+  unsigned long GetCount(unsigned int timer) const
+  { return Timers[timer].count; }
+  /// Returns the last sample of a timer in microseconds.
+  double GetLast(int timer) const { return Timers[timer].last; }
+  /// Returns the mean of a timer over the rolling window in microseconds.
+  double GetMean(int timer) const;
+  /// Returns the 99th percentile of a timer over the rolling window.
+  double GetP99(int timer) const;
+
+  /** Prints the statistics of all the timers since the last reset, including
+      the share of the frame time of each timer. */
+  void PrintSummary(std::ostream& out) const;
+
+private:
+  struct Timer {
+    explicit Timer(const std::string& n)
+      : name(n), next(0), count(0), last(0.0), sum(0.0), total(0.0),
+        max(0.0) {}
+    std::string name;
+    std::vector<double> window; // The last samples, in microseconds.
+    size_t next;
+    unsigned long count;
+    double last, sum, total, max;
+  };
+
+  static const size_t WindowSize = 1024;
+
+  FGPropertyManager* PropertyManager;
+  std::vector<Timer> Timers;
+  bool enabled;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -41,7 +41,10 @@ INCLUDES
 
 #include "initialization/FGTrim.h"
 #include "FGFDMExec.h"
+#include "FGBatchRunner.h"
 #include "input_output/FGXMLFileRead.h"
+#include "input_output/FGXMLDocumentCache.h"
+#include "simgear/io/iostreams/sgstream.hxx"
 
 #if !defined(__GNUC__) && !defined(sgi) && !defined(_MSC_VER)
 #  include <time>
@@ -67,6 +70,7 @@ INCLUDES
 #endif
 
 #include <iostream>
+#include <sstream>
 #include <cstdlib>
 
 using namespace std;
@@ -85,6 +89,11 @@ vector <string> LogOutputName;
 vector <SGPath> LogDirectiveName;
 vector <string> CommandLineProperties;
 vector <double> CommandLinePropertyValues;
+SGPath BatchName;
+SGPath CacheName;
+SGPath BatchResultsName;
+vector <string> BatchOutputProperties;
+unsigned int batch_threads = 0;
 JSBSim::FGFDMExec* FDMExec;
 JSBSim::FGTrim* trimmer;
 
@@ -93,6 +102,7 @@ bool play_nice;
 bool suspend;
 bool catalog;
 bool nohighlight;
+bool profile;
 
 double end_time = 1e99;
 double simulation_rate = 1./120.;
@@ -105,6 +115,7 @@ FORWARD DECLARATIONS
 
 bool options(int, char**);
 int real_main(int argc, char* argv[]);
+int run_batch(void);
 void PrintHelp(void);
 
 #if defined(__BORLANDC__) || defined(_MSC_VER) || defined(__MINGW32__)
@@ -331,6 +342,7 @@ int real_main(int argc, char* argv[])
   suspend = false;
   catalog = false;
   nohighlight = false;
+  profile = false;
 
   // *** PARSE OPTIONS PASSED INTO THIS SPECIFIC APPLICATION: JSBSim *** //
   success = options(argc, argv);
@@ -339,6 +351,12 @@ int real_main(int argc, char* argv[])
     exit(-1);
   }
 
+  // *** RUN A BATCH OF SIMULATIONS IN PARALLEL *** //
+  if (!BatchName.isNull()) {
+    if (run_batch() != 0) exit(-1);
+    return 0;
+  }
+
   // *** SET UP JSBSIM *** //
   FDMExec = new JSBSim::FGFDMExec();
   FDMExec->SetRootDir(RootDir);
@@ -368,6 +386,10 @@ int real_main(int argc, char* argv[])
     }
   }
 
+  // Use the documents of the aircraft cache whose files have not changed.
+  if (!CacheName.isNull() && !FDMExec->GetDocumentCache()->ReadFile(CacheName))
+    cout << "Aircraft cache " << CacheName << " is missing or not valid." << endl;
+
   // *** OPTION A: LOAD A SCRIPT, WHICH LOADS EVERYTHING ELSE *** //
   if (!ScriptName.isNull()) {
 
@@ -423,6 +445,20 @@ int real_main(int argc, char* argv[])
     }
   }
 
+  // Write the aircraft cache again if some files had to be parsed.
+  if (!CacheName.isNull()) {
+    std::shared_ptr<JSBSim::FGXMLDocumentCache> cache = FDMExec->GetDocumentCache();
+    size_t nparsed = cache->GetNumParsed();
+
+    if (nparsed == 0)
+      cout << "Aircraft cache " << CacheName << " is up to date." << endl;
+    else if (cache->WriteFile(CacheName))
+      cout << "Aircraft cache " << CacheName << " written (" << nparsed
+           << " of " << cache->GetNumDocuments() << " files parsed)." << endl;
+    else
+      cerr << "Aircraft cache " << CacheName << " could not be written." << endl;
+  }
+
   // OVERRIDE OUTPUT FILE NAME. THIS IS USEFUL FOR CASES WHERE MULTIPLE
   // RUNS ARE BEING MADE (SUCH AS IN A MONTE CARLO STUDY) AND THE OUTPUT FILE
   // NAME MUST BE SET EACH TIME TO AVOID THE PREVIOUS RUN DATA FROM BEING OVER-
@@ -480,6 +516,9 @@ int real_main(int argc, char* argv[])
        << "---- JSBSim Execution beginning ... --------------------------------------------"
        << JSBSim::FGFDMExec::reset << endl << endl;
 
+  // The initialization and the trim are not profiled.
+  if (profile) FDMExec->SetProfiling(true);
+
   result = FDMExec->Run();  // MAKE AN INITIAL RUN
 
   if (suspend) FDMExec->Hold();
@@ -557,12 +596,118 @@ int real_main(int argc, char* argv[])
   strftime(s, 99, "%A %B %d %Y %X", localtime(&tod));
   cout << "End: " << s << " (HH:MM:SS)" << endl;
 
+  if (FDMExec->GetProfiler().GetEnabled())
+    FDMExec->GetProfiler().PrintSummary(cout);
+
   // CLEAN UP
   delete FDMExec;
 
   return 0;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Runs the cases listed in the batch file. Each line of the file describes a
+// run as a list of property assignments separated by blanks, for instance
+//
+//   ic/h-sl-ft=5000 ic/vc-kts=110 fcs/throttle-cmd-norm=0.8
+//
+// Empty lines and the text following a '#' are ignored. The properties given
+// with --property are applied to all the runs.
+
+int run_batch(void)
+{
+  JSBSim::FGBatchRunner batch(RootDir);
+
+  if (!ScriptName.isNull())
+    batch.SetScript(ScriptName, ResetName);
+  else
+    batch.SetAircraft(AircraftName, ResetName);
+
+  batch.SetEndTime(end_time);
+  batch.SetNumThreads(batch_threads);
+  if (override_sim_rate)
+    batch.SetDeltaT(simulation_rate < 1.0 ? simulation_rate : 1.0/simulation_rate);
+
+  for (unsigned int i=0; i<BatchOutputProperties.size(); i++)
+    batch.AddOutputProperty(BatchOutputProperties[i]);
+
+  for (unsigned int i=0; i<CommandLineProperties.size(); i++) {
+    if (CommandLineProperties[i] == "simulation/randomseed")
+      batch.SetRandomSeed((int)CommandLinePropertyValues[i]);
+  }
+
+  sg_ifstream batchFile(BatchName, ios::in);
+  if (!batchFile.is_open()) {
+    cerr << "Could not open the batch file " << BatchName << endl;
+    return 1;
+  }
+
+  string line;
+  unsigned int lineNumber = 0;
+  while (getline(batchFile, line)) {
+    lineNumber++;
+    line = line.substr(0, line.find('#'));
+
+    JSBSim::FGBatchRunner::Case run;
+    for (unsigned int i=0; i<CommandLineProperties.size(); i++)
+      run.properties.push_back(make_pair(CommandLineProperties[i],
+                                         CommandLinePropertyValues[i]));
+
+    istringstream tokens(line);
+    string token;
+    unsigned int count = 0;
+    while (tokens >> token) {
+      string::size_type n = token.find("=");
+      if (n == string::npos || n == 0) {
+        cerr << BatchName << ":" << lineNumber << ": \"" << token
+             << "\" is not a property assignment" << endl;
+        return 1;
+      }
+      run.properties.push_back(make_pair(token.substr(0, n),
+                                         atof(token.substr(n+1).c_str())));
+      count++;
+    }
+
+    if (count > 0) batch.AddCase(run);
+  }
+
+  cout << "Running " << batch.GetNumCases() << " cases from " << BatchName
+       << endl;
+
+  const vector<JSBSim::FGBatchRunner::Result>& results = batch.Run();
+
+  sg_ofstream resultsFile;
+  if (!BatchResultsName.isNull()) {
+    resultsFile.open(BatchResultsName, ios::out);
+    if (!resultsFile.is_open()) {
+      cerr << "Could not open the results file " << BatchResultsName << endl;
+      return 1;
+    }
+  }
+  ostream& out = BatchResultsName.isNull() ? cout : resultsFile;
+
+  out << "run,success,sim-time";
+  for (unsigned int i=0; i<BatchOutputProperties.size(); i++)
+    out << "," << BatchOutputProperties[i];
+  out << endl;
+
+  int failures = 0;
+  out.precision(10);
+  for (unsigned int i=0; i<results.size(); i++) {
+    out << i << "," << results[i].success << "," << results[i].sim_time;
+    for (unsigned int j=0; j<results[i].values.size(); j++)
+      out << "," << results[i].values[j];
+    out << endl;
+
+    if (!results[i].success) {
+      cerr << "Run " << i << " failed: " << results[i].error << endl;
+      failures++;
+    }
+  }
+
+  return failures ? 1 : 0;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 #define gripe cerr << "Option '" << keyword     \
@@ -616,6 +761,8 @@ bool options(int count, char **arg)
       suspend = true;
     } else if (keyword == "--nohighlight") {
         nohighlight = true;
+    } else if (keyword == "--profile") {
+      profile = true;
     } else if (keyword == "--outputlogfile") {
       if (n != string::npos) {
         LogOutputName.push_back(value);
@@ -695,6 +842,46 @@ bool options(int count, char **arg)
         exit(1);
       }
 
+    } else if (keyword == "--cache") {
+      if (n != string::npos) {
+        CacheName = SGPath::fromLocal8Bit(value.c_str());
+      } else {
+        gripe;
+        exit(1);
+      }
+
+    } else if (keyword == "--batch") {
+      if (n != string::npos) {
+        BatchName = SGPath::fromLocal8Bit(value.c_str());
+      } else {
+        gripe;
+        exit(1);
+      }
+
+    } else if (keyword == "--batch-output") {
+      if (n != string::npos) {
+        BatchOutputProperties.push_back(value);
+      } else {
+        gripe;
+        exit(1);
+      }
+
+    } else if (keyword == "--batch-results") {
+      if (n != string::npos) {
+        BatchResultsName = SGPath::fromLocal8Bit(value.c_str());
+      } else {
+        gripe;
+        exit(1);
+      }
+
+    } else if (keyword == "--threads") {
+      if (n != string::npos) {
+        batch_threads = atoi(value.c_str());
+      } else {
+        gripe;
+        exit(1);
+      }
+
     } else if (keyword == "--catalog") {
         catalog = true;
         if (value.size() > 0) AircraftName=value;
@@ -738,6 +925,14 @@ bool options(int count, char **arg)
     cerr << "You cannot specify an aircraft file with a script." << endl;
     result = false;
   }
+  if (!BatchName.isNull() && ScriptName.isNull() && AircraftName.empty()) {
+    cerr << "A batch requires a script or an aircraft and an initialization file." << endl;
+    result = false;
+  }
+  if (!BatchName.isNull() && (realtime || suspend || catalog)) {
+    cerr << "Batch runs cannot be executed in real time, suspended or cataloged." << endl;
+    result = false;
+  }
 
   return result;
 
@@ -762,6 +957,7 @@ void PrintHelp(void)
     cout << "    --nice  specifies to run at lower CPU usage" << endl;
     cout << "    --nohighlight  specifies that console output should be pure text only (no color)" << endl;
     cout << "    --suspend  specifies to suspend the simulation after initialization" << endl;
+    cout << "    --profile  times the models, FCS channels and engines and prints a summary at the end" << endl;
     cout << "    --initfile=<filename>  specifies an initilization file" << endl;
     cout << "    --catalog specifies that all properties for this aircraft model should be printed" << endl;
     cout << "              (catalog=aircraftname is an optional format)" << endl;
@@ -769,7 +965,17 @@ void PrintHelp(void)
     cout << "    --simulation-rate=<rate (double)> specifies the sim dT time or frequency" << endl;
     cout << "                      If rate specified is less than 1, it is interpreted as" << endl;
     cout << "                      a time step size, otherwise it is assumed to be a rate in Hertz." << endl;
-    cout << "    --end=<time (double)> specifies the sim end time" << endl << endl;
+    cout << "    --end=<time (double)> specifies the sim end time" << endl;
+    cout << "    --cache=<filename>  loads the aircraft files from a binary cache when they did not" << endl;
+    cout << "                        change, and builds or updates the cache otherwise" << endl;
+    cout << "    --batch=<filename>  runs in parallel the cases listed in the file, one case per" << endl;
+    cout << "                        line given as property assignments (e.g. ic/h-sl-ft=5000)" << endl;
+    cout << "    --batch-output=<property>  specifies a property which value is reported at the" << endl;
+    cout << "                               end of each batch case (can appear multiple times)" << endl;
+    cout << "    --batch-results=<filename>  specifies the CSV file where the batch results are" << endl;
+    cout << "                                written (default: console)" << endl;
+    cout << "    --threads=<n>  specifies the number of threads running the batch cases" << endl;
+    cout << "                   (default: number of hardware threads)" << endl << endl;
 
     cout << "  NOTE: There can be no spaces around the = sign when" << endl;
     cout << "        an option is followed by a filename" << endl << endl;
@@ -52,7 +52,8 @@ INCLUDES
 #include "models/FGAtmosphere.h"
 #include "models/FGAircraft.h"
 #include "models/FGAccelerations.h"
-#include "input_output/FGXMLFileRead.h"
+#include "input_output/FGXMLDocumentCache.h"
+#include "input_output/FGStateArchive.h"
 #include "FGTrim.h"
 
 using namespace std;
@@ -131,6 +132,7 @@ void FGInitialCondition::InitializeIC(void)
   e2 = 1.0 - ec*ec;
 
   position.SetEllipse(a, b);
+  position.SetGroundCallback(fdmex->GetGroundCallbackPtr());
 
   position.SetPositionGeodetic(0.0, 0.0, 0.0);
   position.SetEarthPositionAngle(fdmex->GetPropagate()->GetEarthPositionAngle());
@@ -878,8 +880,7 @@ bool FGInitialCondition::Load(const SGPath& rstfile, bool useStoredPath)
     init_file_name = rstfile;
   }
 
-  FGXMLFileRead XMLFileRead;
-  Element* document = XMLFileRead.LoadXMLDocument(init_file_name);
+  Element_ptr document = fdmex->GetDocumentCache()->Load(init_file_name);
 
   // Make sure that the document is valid
   if (!document) {
@@ -1511,6 +1512,15 @@ void FGInitialCondition::bind(FGPropertyManager* PropertyManager)
                        true);
 }
 
+//******************************************************************************
+
+void FGInitialCondition::SerializeState(FGStateArchive& archive)
+{
+  archive.Sync(vUVW_NED, vPQR_body, position, orientation, vt, targetNlfIC,
+               Tw2b, Tb2w, alpha, beta, a, e2, lastSpeedSet, lastAltitudeSet,
+               lastLatitudeSet, enginesRunning, trimRequested);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
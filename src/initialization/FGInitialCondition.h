@@ -64,6 +64,7 @@ class FGAtmosphere;
 class FGAircraft;
 class FGPropertyManager;
 class Element;
+class FGStateArchive;
 
 typedef enum { setvt, setvc, setve, setmach, setuvw, setned, setvg } speedset;
 typedef enum { setasl, setagl } altitudeset;
@@ -684,6 +685,10 @@ public:
 
   void bind(FGPropertyManager* pm);
 
+  /** Saves or restores the initial conditions.
+      @see FGFDMExec::SaveState, FGFDMExec::RestoreState */
+  void SerializeState(FGStateArchive& archive);
+
 private:
   FGColumnVector3 vUVW_NED;
   FGColumnVector3 vPQR_body;
@@ -98,7 +98,8 @@ FGSimplexTrim::FGSimplexTrim(FGFDMExec * fdm, TrimMode mode)
 
     solver = new FGNelderMead(trimmer,initialGuess,
         lowerBound, upperBound, initialStepSize,iterMax,rtol,
-        abstol,speed,random,showConvergence,showSimplex,pause,&callback);
+        abstol,speed,random,showConvergence,showSimplex,pause,&callback,
+        fdm->GetRandomGenerator());
     while(solver->status()==1) solver->update();
     time_trimDone = std::clock();
 
@@ -0,0 +1,340 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGCompressedLog.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+ Purpose:      Encoder and decoder of the compressed logs
+ Called by:    FGOutputCompressedFile, decode_log
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+This module only depends on the standard C++ library so that the utilities can
+be compiled with it without linking the JSBSim library.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+
+#include "FGCompressedLog.h"
+#include "FGByteOrder.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+namespace {
+
+// Sizes of the fixed parts of the file, in bytes.
+const size_t HeaderSize = 24;
+const size_t ChunkHeaderSize = 28;
+const size_t EntrySize = 28;
+const size_t TrailerSize = 20;
+
+void PutVarint(vector<char>& buffer, uint64_t value)
+{
+  while (value >= 0x80) {
+    buffer.push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  buffer.push_back(static_cast<char>(value));
+}
+
+// Returns false if the integer overruns the end of the buffer.
+bool GetVarint(const char*& ptr, const char* end, uint64_t& value)
+{
+  value = 0;
+  for (unsigned int shift=0; ptr < end && shift < 64; shift += 7) {
+    uint8_t byte = static_cast<uint8_t>(*ptr++);
+    value |= uint64_t(byte & 0x7f) << shift;
+    if (!(byte & 0x80)) return true;
+  }
+  return false;
+}
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+const char FGCompressedLogWriter::Magic[8] = {'J','S','B','S','I','M','C','L'};
+const char FGCompressedLogWriter::ChunkMagic[4] = {'C','H','N','K'};
+const char FGCompressedLogWriter::IndexMagic[8] = {'J','S','B','S','I','M','C','I'};
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGCompressedLogWriter::FGCompressedLogWriter(void)
+  : Out(nullptr), NumValues(0), ChunkFrames(0), Frames(0), StartTime(0.0),
+    EndTime(0.0)
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGCompressedLogWriter::Start(ostream& out, const vector<string>& names,
+                                  unsigned int chunkFrames)
+{
+  Out = &out;
+  NumValues = names.size();
+  ChunkFrames = max(chunkFrames, 1U);
+  Frames = 0;
+  Previous.assign(NumValues, 0);
+  Buffer.clear();
+  Index.clear();
+
+  vector<char> header(Magic, Magic + sizeof(Magic));
+  PutLittleEndian(header, uint32_t(0)); // Header size, filled below.
+  PutLittleEndian(header, uint32_t(1));
+  PutLittleEndian(header, static_cast<uint32_t>(NumValues));
+  PutLittleEndian(header, static_cast<uint32_t>(ChunkFrames));
+  for (auto& name: names) {
+    PutLittleEndian(header, static_cast<uint16_t>(name.size()));
+    header.insert(header.end(), name.begin(), name.end());
+  }
+
+  vector<char> size;
+  PutLittleEndian(size, static_cast<uint32_t>(header.size()));
+  copy(size.begin(), size.end(), header.begin() + sizeof(Magic));
+
+  Out->write(header.data(), header.size());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGCompressedLogWriter::AddFrame(const double* values)
+{
+  for (size_t i=0; i<NumValues; ++i) {
+    uint64_t bits;
+    memcpy(&bits, &values[i], sizeof(bits));
+    PutVarint(Buffer, bits ^ Previous[i]);
+    Previous[i] = bits;
+  }
+
+  if (NumValues > 0) {
+    if (Frames == 0) StartTime = values[0];
+    EndTime = values[0];
+  }
+
+  if (++Frames == ChunkFrames) WriteChunk();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGCompressedLogWriter::WriteChunk(void)
+{
+  Entry entry;
+  entry.offset = static_cast<uint64_t>(Out->tellp());
+  entry.frames = Frames;
+  entry.start = StartTime;
+  entry.end = EndTime;
+  Index.push_back(entry);
+
+  vector<char> header(ChunkMagic, ChunkMagic + sizeof(ChunkMagic));
+  PutLittleEndian(header, static_cast<uint32_t>(Frames));
+  PutLittleEndian(header, static_cast<uint32_t>(Buffer.size()));
+  PutLittleEndian(header, StartTime);
+  PutLittleEndian(header, EndTime);
+
+  Out->write(header.data(), header.size());
+  Out->write(Buffer.data(), Buffer.size());
+
+  // The chunks are decoded independently of each other.
+  Buffer.clear();
+  Previous.assign(NumValues, 0);
+  Frames = 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGCompressedLogWriter::Finish(void)
+{
+  if (!Out) return;
+
+  if (Frames > 0) WriteChunk();
+
+  vector<char> index;
+  for (auto& entry: Index) {
+    PutLittleEndian(index, entry.offset);
+    PutLittleEndian(index, entry.frames);
+    PutLittleEndian(index, entry.start);
+    PutLittleEndian(index, entry.end);
+  }
+  PutLittleEndian(index, static_cast<uint64_t>(Out->tellp()));
+  PutLittleEndian(index, static_cast<uint32_t>(Index.size()));
+  index.insert(index.end(), IndexMagic, IndexMagic + sizeof(IndexMagic));
+
+  Out->write(index.data(), index.size());
+  Out->flush();
+  Out = nullptr;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGCompressedLogReader::Open(istream& in)
+{
+  In = &in;
+  Names.clear();
+  Chunks.clear();
+  Finished = false;
+
+  char header[HeaderSize];
+  in.seekg(0);
+  if (!in.read(header, HeaderSize)
+      || memcmp(header, FGCompressedLogWriter::Magic, 8) != 0
+      || GetLittleEndian<uint32_t>(header + 12) != 1)
+    return false;
+
+  uint32_t header_size = GetLittleEndian<uint32_t>(header + 8);
+  uint32_t num_columns = GetLittleEndian<uint32_t>(header + 16);
+
+  for (uint32_t i=0; i<num_columns; ++i) {
+    char length[2];
+    if (!in.read(length, 2)) return false;
+    string name(GetLittleEndian<uint16_t>(length), '\0');
+    if (!in.read(&name[0], name.size())) return false;
+    Names.push_back(name);
+  }
+  if (static_cast<uint64_t>(in.tellg()) != header_size) return false;
+
+  if (!ReadIndex(header_size))
+    RebuildIndex(header_size);
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGCompressedLogReader::ReadIndex(uint64_t start)
+{
+  In->seekg(0, ios::end);
+  uint64_t size = In->tellg();
+  if (size < start + TrailerSize) return false;
+
+  char trailer[TrailerSize];
+  In->seekg(size - TrailerSize);
+  if (!In->read(trailer, TrailerSize)
+      || memcmp(trailer + 12, FGCompressedLogWriter::IndexMagic, 8) != 0)
+    return false;
+
+  uint64_t offset = GetLittleEndian<uint64_t>(trailer);
+  uint32_t count = GetLittleEndian<uint32_t>(trailer + 8);
+  if (offset < start || offset + count*EntrySize + TrailerSize != size)
+    return false;
+
+  Buffer.resize(count*EntrySize);
+  In->seekg(offset);
+  if (!In->read(Buffer.data(), Buffer.size())) return false;
+
+  for (uint32_t i=0; i<count; ++i) {
+    const char* entry = Buffer.data() + i*EntrySize;
+    Chunk chunk;
+    chunk.Offset = GetLittleEndian<uint64_t>(entry);
+    chunk.Frames = GetLittleEndian<uint32_t>(entry + 8);
+    chunk.StartTime = GetLittleEndian<double>(entry + 12);
+    chunk.EndTime = GetLittleEndian<double>(entry + 20);
+    Chunks.push_back(chunk);
+  }
+
+  Finished = true;
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGCompressedLogReader::RebuildIndex(uint64_t start)
+{
+  In->clear();
+  In->seekg(0, ios::end);
+  uint64_t size = In->tellg();
+  uint64_t offset = start;
+  char header[ChunkHeaderSize];
+
+  // A truncated chunk at the end of the file is ignored.
+  while (offset + ChunkHeaderSize <= size) {
+    In->seekg(offset);
+    if (!In->read(header, ChunkHeaderSize)
+        || memcmp(header, FGCompressedLogWriter::ChunkMagic, 4) != 0)
+      break;
+
+    uint32_t payload = GetLittleEndian<uint32_t>(header + 8);
+    if (offset + ChunkHeaderSize + payload > size) break;
+
+    Chunk chunk;
+    chunk.Offset = offset;
+    chunk.Frames = GetLittleEndian<uint32_t>(header + 4);
+    chunk.StartTime = GetLittleEndian<double>(header + 12);
+    chunk.EndTime = GetLittleEndian<double>(header + 20);
+    Chunks.push_back(chunk);
+    offset += ChunkHeaderSize + payload;
+  }
+
+  In->clear();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGCompressedLogReader::FindChunk(double time) const
+{
+  auto it = upper_bound(Chunks.begin(), Chunks.end(), time,
+                        [](double t, const Chunk& c) { return t < c.StartTime; });
+  return it == Chunks.begin() ? 0 : it - Chunks.begin() - 1;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGCompressedLogReader::ReadChunk(size_t i, vector<double>& values)
+{
+  values.clear();
+  if (i >= Chunks.size()) return false;
+
+  char header[ChunkHeaderSize];
+  In->clear();
+  In->seekg(Chunks[i].Offset);
+  if (!In->read(header, ChunkHeaderSize)
+      || memcmp(header, FGCompressedLogWriter::ChunkMagic, 4) != 0)
+    return false;
+
+  uint32_t frames = GetLittleEndian<uint32_t>(header + 4);
+  Buffer.resize(GetLittleEndian<uint32_t>(header + 8));
+  if (!In->read(Buffer.data(), Buffer.size())) return false;
+
+  const char* ptr = Buffer.data();
+  const char* end = ptr + Buffer.size();
+  size_t num_values = Names.size();
+  vector<uint64_t> previous(num_values, 0);
+
+  values.resize(size_t(frames) * num_values);
+  for (size_t n=0; n<values.size(); ++n) {
+    uint64_t bits;
+    if (!GetVarint(ptr, end, bits)) {
+      values.clear();
+      return false;
+    }
+    uint64_t& prev = previous[n % num_values];
+    prev ^= bits;
+    memcpy(&values[n], &prev, sizeof(double));
+  }
+
+  return true;
+}
+}
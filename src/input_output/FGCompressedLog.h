@@ -0,0 +1,213 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGCompressedLog.h
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/2026   Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGCOMPRESSEDLOG_H
+#define FGCOMPRESSEDLOG_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Writes a compressed log: a stream of frames of double values which are
+    grouped in chunks that can be decoded independently of each other.
+
+    Each value is stored as the exclusive or of its IEEE-754 representation
+    with the one of the same column in the previous frame of the chunk, encoded
+    as a variable length integer (7 bits per byte, least significant first).
+    The sign, the exponent and the most significant bits of the mantissa of a
+    slowly varying value do not change from a frame to the next, so the
+    exclusive or is a small integer that takes a few bytes, and a constant
+    value takes a single byte. The encoding is lossless.
+
+    All the integers and the floating point numbers of the file are
+    little-endian. The file begins with a header:
+
+    | Size    | Content                                                  |
+    |---------|----------------------------------------------------------|
+    | 8       | The magic string "JSBSIMCL"                              |
+    | 4       | uint32: size of the whole header in bytes                |
+    | 4       | uint32: version of the format (1)                        |
+    | 4       | uint32: number of columns N                              |
+    | 4       | uint32: maximum number of frames per chunk               |
+    | N times | uint16: length of the name, name (UTF-8)                 |
+
+    It is followed by the chunks:
+
+    | Size    | Content                                                  |
+    |---------|----------------------------------------------------------|
+    | 4       | The magic string "CHNK"                                  |
+    | 4       | uint32: number of frames F                               |
+    | 4       | uint32: size of the encoded frames in bytes              |
+    | 8       | float64: value of the first column in the first frame    |
+    | 8       | float64: value of the first column in the last frame     |
+    |         | The F encoded frames                                     |
+
+    The first column is normally the simulation time so a chunk can be found
+    from a time without decoding the chunks. When the log is finished, an
+    index of the chunks is appended to the file:
+
+    | Size    | Content                                                  |
+    |---------|----------------------------------------------------------|
+    | C times | uint64: offset of the chunk from the beginning of the    |
+    |         | file, uint32: number of frames, float64: time of the     |
+    |         | first frame, float64: time of the last frame             |
+    | 8       | uint64: offset of the index                              |
+    | 4       | uint32: number of chunks C                               |
+    | 8       | The magic string "JSBSIMCI"                              |
+
+    A log which has not been finished (after a crash for instance) has no
+    index: FGCompressedLogReader then rebuilds it by reading the headers of
+    the chunks.
+
+    @author The JSBSim team
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGCompressedLogWriter
+{
+public:
+  /// Constructor
+  FGCompressedLogWriter(void);
+
+  /** Writes the header of a log.
+      @param out the stream where the log is written. It must be opened in
+                 binary mode and must outlive the log.
+      @param names the names of the columns.
+      @param chunkFrames the maximum number of frames per chunk. */
+  void Start(std::ostream& out, const std::vector<std::string>& names,
+             unsigned int chunkFrames);
+  /** Adds a frame to the current chunk. The chunk is written when it is full.
+      @param values the values of the frame, one per column. */
+  void AddFrame(const double* values);
+  /// Writes the current chunk and the index. The log is then finished.
+  void Finish(void);
+  /// Returns true if a log has been started and is not yet finished.
+  bool IsStarted(void) const { return Out != nullptr; }
+
+  /// The magic string at the beginning of the files.
+  static const char Magic[8];
+  /// The magic string at the beginning of the chunks.
+  static const char ChunkMagic[4];
+  /// The magic string at the end of the finished files.
+  static const char IndexMagic[8];
+
+private:
+  struct Entry {
+    uint64_t offset;
+    uint32_t frames;
+    double start, end;
+  };
+
+  std::ostream* Out;
+  size_t NumValues;
+  unsigned int ChunkFrames;
+  unsigned int Frames;
+  double StartTime, EndTime;
+  std::vector<uint64_t> Previous;
+  std::vector<char> Buffer;
+  std::vector<Entry> Index;
+
+  void WriteChunk(void);
+};
+
+/** Reads a log written by FGCompressedLogWriter. */
+
+class FGCompressedLogReader
+{
+public:
+  /// The location and the time span of a chunk.
+  struct Chunk {
+    uint64_t Offset;
+    uint32_t Frames;
+    double StartTime;
+    double EndTime;
+  };
+
+  /// Constructor
+  FGCompressedLogReader(void) : In(nullptr), Finished(false) {}
+
+  /** Reads the header and the index of a log.
+      @param in the stream where the log is read. It must be opened in binary
+                mode and must outlive the reader.
+      @return false if the stream does not contain a log. */
+  bool Open(std::istream& in);
+
+  /// Returns the names of the columns.
+  const std::vector<std::string>& GetNames(void) const { return Names; }
+  /// Returns the chunks of the log.
+  const std::vector<Chunk>& GetChunks(void) const { return Chunks; }
+  /// Returns true if the index was read from the file rather than rebuilt.
+  bool IsFinished(void) const { return Finished; }
+  /** Returns the index of the chunk which contains a time, i.e. the last
+      chunk that starts at or before that time (0 if the time precedes the
+      first chunk). */
+  size_t FindChunk(double time) const;
+  /** Decodes a chunk.
+      @param i the index of the chunk.
+      @param values receives the values of the frames of the chunk, frame by
+                    frame.
+      @return false if the chunk could not be read. */
+  bool ReadChunk(size_t i, std::vector<double>& values);
+
+private:
+  std::istream* In;
+  std::vector<std::string> Names;
+  std::vector<Chunk> Chunks;
+  std::vector<char> Buffer;
+  bool Finished;
+
+  bool ReadIndex(uint64_t start);
+  void RebuildIndex(uint64_t start);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -0,0 +1,132 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGInputSharedMemory.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+ Purpose:      Manage input of sim parameters from a shared memory segment
+ Called by:    FGInput
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <sstream>
+
+#include "FGInputSharedMemory.h"
+#include "FGFDMExec.h"
+#include "input_output/FGXMLElement.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGInputSharedMemory::FGInputSharedMemory(FGFDMExec* fdmex) :
+  FGInputType(fdmex), LastSequence(0), Frames(0)
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGInputSharedMemory::Load(Element* el)
+{
+  if (!FGInputType::Load(el))
+    return false;
+
+  Name = el->GetAttributeValue("name");
+  if (Name.empty()) {
+    cerr << el->ReadFrom() << fgred
+         << "No name assigned to the shared memory input." << reset << endl;
+    return false;
+  }
+
+  if (el->HasAttribute("rate")) {
+    double rate = el->GetAttributeValueAsNumber("rate");
+    if (rate > 0.0) SetRate(0.5 + 1.0/(FDMExec->GetDeltaT()*rate));
+  }
+
+  Element *property_element = el->FindElement("property");
+
+  while (property_element) {
+    string property_str = property_element->GetDataLine();
+    FGPropertyNode* node = PropertyManager->GetNode(property_str);
+    if (!node) {
+      cerr << fgred << highint << endl << "  No property by the name "
+           << property_str << " can be found." << reset << endl;
+    } else {
+      InputProperties.push_back(node);
+      InputNames.push_back(node->GetFullyQualifiedName());
+    }
+    property_element = el->FindNextElement("property");
+  }
+
+  ostringstream buf;
+  buf << "simulation/input[" << InputIdx << "]/frames";
+  PropertyManager->Tie(buf.str(), &Frames);
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGInputSharedMemory::InitModel(void)
+{
+  if (!FGInputType::InitModel()) return false;
+
+  // The segment is kept when the initial conditions are run again.
+  if (Segment.IsOpen()) return true;
+
+  if (!Segment.Create(Name, InputNames)) {
+    cerr << fgred << highint << "       => Input from this segment is disabled."
+         << reset << endl;
+    Disable();
+    return false;
+  }
+
+  Values.resize(InputNames.size());
+  LastSequence = 0;
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputSharedMemory::Read(bool Holding)
+{
+  if (!Segment.IsOpen()) return;
+
+  // Nothing to do if no frame has been published since the last call.
+  if (Segment.GetSequence() == LastSequence) return;
+
+  uint64_t sequence;
+  if (!Segment.Read(Values.data(), sequence)) return;
+
+  LastSequence = sequence;
+  Frames++;
+
+  for (unsigned int i=0; i<InputProperties.size(); i++)
+    InputProperties[i]->setDoubleValue(Values[i]);
+}
+}
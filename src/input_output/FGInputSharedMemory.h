@@ -0,0 +1,109 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGInputSharedMemory.h
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/2026   Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGINPUTSHAREDMEMORY_H
+#define FGINPUTSHAREDMEMORY_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <string>
+#include <vector>
+
+#include "FGInputType.h"
+#include "FGSharedMemory.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Implements the input from a shared memory segment. JSBSim creates the
+    segment and a process running on the same host maps it (see
+    FGSharedMemory) to write the values of the properties listed in the input
+    directives, in the order in which they are listed:
+    @code
+    <input name="jsbsim-controls" type="SHARED_MEMORY" rate="60">
+      <property> fcs/elevator-cmd-norm </property>
+      <property> fcs/aileron-cmd-norm </property>
+    </input>
+    @endcode
+    The properties are only updated when the writer has published a new frame
+    since the last time the segment has been read. The number of frames that
+    have been read is available in the property
+    <tt>simulation/input[n]/frames</tt>.
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGInputSharedMemory : public FGInputType
+{
+public:
+  /// Constructor
+  FGInputSharedMemory(FGFDMExec* fdmex);
+
+  /** Reads the property names from an XML file.
+      @param element The root XML Element of the input file.
+  */
+  bool Load(Element* el);
+
+  /** Initializes the instance. This method creates the shared memory segment.
+      @result true if the execution succeeded.
+   */
+  bool InitModel(void);
+
+  /// Reads the segment and updates properties accordingly.
+  void Read(bool Holding);
+
+  /// Returns the shared memory segment.
+  const FGSharedMemory& GetSegment(void) const { return Segment; }
+
+private:
+  FGSharedMemory Segment;
+  std::vector<FGPropertyNode_ptr> InputProperties;
+  std::vector<std::string> InputNames;
+  std::vector<double> Values;
+  uint64_t LastSequence;
+  int Frames;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
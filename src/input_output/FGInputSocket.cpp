@@ -58,7 +58,7 @@ CLASS IMPLEMENTATION
 
 FGInputSocket::FGInputSocket(FGFDMExec* fdmex) :
   FGInputType(fdmex), socket(0), SockProtocol(FGfdmSocket::ptTCP),
-  BlockingInput(false)
+  BlockingInput(false), Binary(false)
 {
 }
 
@@ -87,6 +87,9 @@ bool FGInputSocket::Load(Element* el)
   if (to_upper(action) == "BLOCKING_INPUT")
     BlockingInput = true;
 
+  string format = el->GetAttributeValue("format");
+  Binary = to_upper(format) == "BINARY";
+
   return true;
 }
 
@@ -101,6 +104,9 @@ bool FGInputSocket::InitModel(void)
     if (socket == 0) return false;
     if (!socket->GetConnectStatus()) return false;
 
+    socket->SetBinary(Binary);
+    data.clear();
+
     return true;
   }
 
@@ -119,6 +125,11 @@ void FGInputSocket::Read(bool Holding)
   if (socket == 0) return;
   if (!socket->GetConnectStatus()) return;
 
+  if (Binary) {
+    ReadBinary(Holding);
+    return;
+  }
+
   if (BlockingInput)
     socket->WaitUntilReadable(); // block until a transmission is received
   data = socket->Receive(); // read data
@@ -154,7 +165,8 @@ void FGInputSocket::Read(bool Holding)
           break;
         }
         try {
-          node = PropertyManager->GetNode(argument);
+          int handle = PropertyManager->GetHandle(argument);
+          node = handle < 0 ? 0 : PropertyManager->GetHandleNode(handle);
         } catch(...) {
           socket->Reply("Badly formed property query\n");
           break;
@@ -179,7 +191,8 @@ void FGInputSocket::Read(bool Holding)
           break;
         }
         try {
-          node = PropertyManager->GetNode(argument);
+          int handle = PropertyManager->GetHandle(argument);
+          node = handle < 0 ? 0 : PropertyManager->GetHandleNode(handle);
         } catch(...) {
           socket->Reply("Badly formed property query\n");
           break;
@@ -266,4 +279,165 @@ void FGInputSocket::Read(bool Holding)
 
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputSocket::ReadBinary(bool Holding)
+{
+  if (BlockingInput)
+    socket->WaitUntilReadable();
+
+  // A message may be split over several reads, so the bytes of an incomplete
+  // message are kept until the rest of it is received.
+  data += socket->Receive();
+
+  FGSocketMessageReader message;
+  FGSocketMessageWriter reply;
+  string replies;
+  size_t pos = 0;
+
+  while (message.Next(data, pos)) {
+    if (ProcessMessage(message, reply))
+      replies += reply.Finish();
+  }
+
+  if (message.IsInvalid()) {
+    // The stream is out of sync: nothing can be trusted past this point.
+    reply.Start(FGSocketMessage::mtError);
+    reply.PutString("Invalid message length");
+    replies += reply.Finish();
+    pos = data.size();
+  }
+
+  data.erase(0, pos);
+
+  if (!replies.empty()) socket->Reply(replies);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGInputSocket::ProcessMessage(FGSocketMessageReader& message,
+                                   FGSocketMessageWriter& reply)
+{
+  string error;
+
+  switch (message.GetType()) {
+  case FGSocketMessage::mtRegister:
+  {
+    uint16_t count = message.GetShort();
+    vector<uint32_t> ids;
+
+    for (uint16_t i=0; i<count && !message.HasFailed(); ++i) {
+      string name = message.GetString();
+      int handle = -1;
+      try {
+        handle = PropertyManager->GetHandle(name);
+      } catch(...) {
+      }
+
+      uint32_t id = FGSocketMessage::InvalidId;
+      if (handle >= 0 && PropertyManager->GetHandleNode(handle)->hasValue())
+        id = static_cast<uint32_t>(handle);
+      ids.push_back(id);
+    }
+
+    if (message.HasFailed()) break;
+
+    reply.Start(FGSocketMessage::mtIds);
+    reply.PutShort(count);
+    for (uint32_t id: ids)
+      reply.PutInt(id);
+    return true;
+  }
+  case FGSocketMessage::mtSet:
+  {
+    uint16_t count = message.GetShort();
+
+    for (uint16_t i=0; i<count; ++i) {
+      uint32_t id = message.GetInt();
+      FGSocketMessage::ValueType type;
+      double value = message.GetValue(type);
+      if (message.HasFailed()) break;
+
+      if (id >= PropertyManager->GetNumHandles()) {
+        error = "Unknown property id";
+        continue;
+      }
+
+      FGPropertyNode* node = PropertyManager->GetHandleNode(id);
+      switch (type) {
+      case FGSocketMessage::vtBool:
+        node->setBoolValue(value != 0.0);
+        break;
+      case FGSocketMessage::vtInt:
+        node->setIntValue(static_cast<int>(value));
+        break;
+      default:
+        node->setDoubleValue(value);
+        break;
+      }
+    }
+    break;
+  }
+  case FGSocketMessage::mtGet:
+  {
+    uint16_t count = message.GetShort();
+
+    reply.Start(FGSocketMessage::mtValues);
+    reply.PutShort(count);
+    for (uint16_t i=0; i<count; ++i) {
+      uint32_t id = message.GetInt();
+      if (message.HasFailed()) break;
+
+      if (id >= PropertyManager->GetNumHandles()) {
+        error = "Unknown property id";
+        break;
+      }
+
+      FGPropertyNode* node = PropertyManager->GetHandleNode(id);
+      switch (node->getType()) {
+      case simgear::props::BOOL:
+        reply.PutValue(FGSocketMessage::vtBool, node->getBoolValue());
+        break;
+      case simgear::props::INT:
+        reply.PutValue(FGSocketMessage::vtInt, node->getIntValue());
+        break;
+      default:
+        reply.PutValue(FGSocketMessage::vtDouble, node->getDoubleValue());
+        break;
+      }
+    }
+
+    if (!message.HasFailed() && error.empty()) return true;
+    break;
+  }
+  case FGSocketMessage::mtHold:
+    FDMExec->Hold();
+    break;
+  case FGSocketMessage::mtResume:
+    FDMExec->Resume();
+    break;
+  case FGSocketMessage::mtIterate:
+  {
+    uint32_t steps = message.GetInt();
+    if (message.HasFailed()) break;
+    if (steps == 0) {
+      error = "The number of iterations must be positive";
+      break;
+    }
+    FDMExec->EnableIncrementThenHold(steps);
+    FDMExec->Resume();
+    break;
+  }
+  default:
+    error = "Unknown message type";
+    break;
+  }
+
+  if (message.HasFailed()) error = "Truncated message";
+  if (error.empty()) return false;
+
+  reply.Start(FGSocketMessage::mtError);
+  reply.PutString(error);
+  return true;
+}
 }
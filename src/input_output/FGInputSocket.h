@@ -40,6 +40,7 @@ INCLUDES
 
 #include "FGInputType.h"
 #include "input_output/FGfdmSocket.h"
+#include "input_output/FGSocketMessage.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -53,6 +54,13 @@ CLASS DOCUMENTATION
 
 /** Implements the input from a socket. This class inputs data from a telnet
     session. This is a leaf class.
+
+    With the attribute format="BINARY", the commands are read as framed binary
+    messages instead of text lines (see FGSocketMessage). A controller then
+    registers the properties it needs once, and sets or gets hundreds of them
+    per message by their ids. The ids are the handles of the property manager
+    (see FGPropertyManager::GetHandle) so they stay valid for the whole
+    simulation and registering a property again returns the same id.
  */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -89,6 +97,11 @@ protected:
   FGfdmSocket::ProtocolType SockProtocol;
   std::string data;
   bool BlockingInput;
+  bool Binary;
+
+  void ReadBinary(bool Holding);
+  bool ProcessMessage(FGSocketMessageReader& message,
+                      FGSocketMessageWriter& reply);
 };
 }
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
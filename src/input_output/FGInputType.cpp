@@ -84,7 +84,7 @@ bool FGInputType::Load(Element* element)
   // no common attributes yet (see FGOutputType for example
 
   // FIXME : PostLoad should be called in the most derived class ?
-  PostLoad(element, PropertyManager);
+  PostLoad(element, FDMExec);
 
   return true;
 }
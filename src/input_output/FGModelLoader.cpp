@@ -39,8 +39,9 @@ INCLUDES
 
 #include "FGJSBBase.h"
 #include "FGModelLoader.h"
-#include "FGXMLFileRead.h"
+#include "FGXMLDocumentCache.h"
 #include "models/FGModel.h"
+#include "FGFDMExec.h"
 
 using namespace std;
 
@@ -56,7 +57,6 @@ Element_ptr FGModelLoader::Open(Element *el)
   string fname = el->GetAttributeValue("file");
 
   if (!fname.empty()) {
-    FGXMLFileRead XMLFileRead;
     SGPath path(SGPath::fromLocal8Bit(fname.c_str()));
 
     if (path.isRelative())
@@ -65,7 +65,7 @@ Element_ptr FGModelLoader::Open(Element *el)
     if (CachedFiles.find(path.utf8Str()) != CachedFiles.end())
       document = CachedFiles[path.utf8Str()];
     else {
-      document = XMLFileRead.LoadXMLDocument(path);
+      document = model->GetExec()->GetDocumentCache()->Load(path);
       if (document == 0L) {
         cerr << endl << el->ReadFrom()
              << "Could not open file: " << fname << endl;
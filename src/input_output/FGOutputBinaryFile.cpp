@@ -0,0 +1,192 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGOutputBinaryFile.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+ Purpose:      Manage output of sim parameters to a binary file
+ Called by:    FGOutput
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+The columns are the same as the ones of FGOutputTextFile. The values of the
+subsystems that are only available as delimited strings (aerodynamic functions,
+FCS components, ground reactions and propulsion) are parsed back to numbers.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdint>
+#include <cstdlib>
+
+#include "FGOutputBinaryFile.h"
+#include "FGByteOrder.h"
+#include "FGFDMExec.h"
+#include "input_output/FGXMLElement.h"
+#include "input_output/string_utilities.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+namespace {
+
+// The unit of a caption is the text between the trailing parentheses.
+string GetUnit(const string& name)
+{
+  if (name.empty() || name.back() != ')') return string();
+
+  size_t open = name.rfind('(');
+  if (open == string::npos) return string();
+
+  return name.substr(open + 1, name.size() - open - 2);
+}
+
+void AppendString(vector<char>& buffer, const string& str)
+{
+  PutLittleEndian(buffer, static_cast<uint16_t>(str.size()));
+  buffer.insert(buffer.end(), str.begin(), str.end());
+}
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+const char FGOutputBinaryFile::Magic[8] = {'J','S','B','S','I','M','B','F'};
+
+// Offset of the rate in the header: magic string followed by 4 integers.
+const streamoff FGOutputBinaryFile::RateOffset = sizeof(Magic) + 16;
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputBinaryFile::Load(Element* el)
+{
+  if(!FGOutputFile::Load(el))
+    return false;
+
+  string precision = el->GetAttributeValue("precision");
+  to_lower(precision);
+  if (precision == "single")
+    SinglePrecision = true;
+  else if (precision.empty() || precision == "double")
+    SinglePrecision = false;
+  else {
+    cerr << el->ReadFrom() << fgred << "Unknown precision " << precision
+         << " for the binary output. The values will be output as doubles."
+         << reset << endl;
+    SinglePrecision = false;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputBinaryFile::OpenFile(void)
+{
+  // The file is still open when the initial conditions are run again without
+  // starting a new output (FGFDMExec::ResetToInitialConditions(0)): the output
+  // then carries on in the same file.
+  if (datafile.is_open()) return true;
+
+  datafile.clear();
+  datafile.open(Filename, ios::out | ios::binary);
+  if (!datafile) {
+    cerr << endl << fgred << highint << "ERROR: unable to open the file "
+         << reset << Filename.c_str() << endl
+         << fgred << highint << "       => Output to this file is disabled."
+         << reset << endl << endl;
+    Disable();
+    return false;
+  }
+
+  vector<string> names = Plan.GetNames();
+
+  vector<char> header(Magic, Magic + sizeof(Magic));
+  PutLittleEndian(header, uint32_t(0)); // Header size, filled below.
+  PutLittleEndian(header, uint32_t(1));
+  PutLittleEndian(header,
+                  uint32_t(SinglePrecision ? sizeof(float) : sizeof(double)));
+  PutLittleEndian(header, static_cast<uint32_t>(names.size()));
+  // The rate is unknown while the initial conditions are run: see Collect().
+  RateHz = FDMExec->IntegrationSuspended() ? 0.0 : GetRateHz();
+  RateWritten = RateHz != 0.0;
+  PutLittleEndian(header, RateHz.load());
+  for (auto& name: names) {
+    AppendString(header, name);
+    AppendString(header, GetUnit(name));
+  }
+
+  vector<char> size;
+  PutLittleEndian(size, static_cast<uint32_t>(header.size()));
+  copy(size.begin(), size.end(), header.begin() + sizeof(Magic));
+
+  datafile.write(header.data(), header.size());
+  datafile.flush();
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputBinaryFile::Collect(FGOutputRecord& record)
+{
+  if (!datafile.is_open()) return false;
+
+  if (!CollectValues(record)) return false;
+
+  // The integration is suspended while the initial conditions are run so the
+  // rate is unknown at that time: it is then written to the header by the
+  // first call which follows the resumption of the integration.
+  if (RateHz == 0.0 && !FDMExec->IntegrationSuspended())
+    RateHz = GetRateHz();
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputBinaryFile::Emit(const FGOutputRecord& record)
+{
+  Record.clear();
+  if (SinglePrecision) {
+    for (double value: record.values)
+      PutLittleEndian(Record, static_cast<float>(value));
+  } else {
+    for (double value: record.values)
+      PutLittleEndian(Record, value);
+  }
+
+  datafile.write(Record.data(), Record.size());
+
+  if (!RateWritten && RateHz != 0.0) {
+    RateWritten = true;
+    Record.clear();
+    PutLittleEndian(Record, RateHz.load());
+    streampos end = datafile.tellp();
+    datafile.seekp(RateOffset);
+    datafile.write(Record.data(), Record.size());
+    datafile.seekp(end);
+  }
+}
+}
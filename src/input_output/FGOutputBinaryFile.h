@@ -0,0 +1,134 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGOutputBinaryFile.h
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/2026   Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGOUTPUTBINARYFILE_H
+#define FGOUTPUTBINARYFILE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "FGOutputFile.h"
+#include "simgear/io/iostreams/sgstream.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Implements the output to a binary file. The file contains the same columns
+    as the CSV output but the values are stored as raw IEEE-754 numbers, which
+    saves the cost of formatting them as text at each output step.
+
+    The output is selected with <tt>type="BINARY"</tt>. The optional attribute
+    <tt>precision="single"</tt> stores the values as 32 bits floats instead of
+    64 bits doubles:
+    @code
+    <output name="output.bin" type="BINARY" precision="single" rate="100">
+      <property> velocities/vc-kts </property>
+    </output>
+    @endcode
+
+    The file begins with a self describing header. All the integers and the
+    floating point numbers are little-endian:
+
+    | Size    | Content                                                  |
+    |---------|----------------------------------------------------------|
+    | 8       | The magic string "JSBSIMBF"                              |
+    | 4       | uint32: size of the whole header in bytes                |
+    | 4       | uint32: version of the format (1)                        |
+    | 4       | uint32: size of each value in bytes (4 or 8)             |
+    | 4       | uint32: number of columns N                              |
+    | 8       | float64: output rate in Hz (0 if it is unknown)          |
+    | N times | uint16: length of the name, name (UTF-8),                |
+    |         | uint16: length of the unit, unit (UTF-8)                 |
+
+    The names are the captions of the CSV header (e.g. "Altitude ASL (ft)").
+    The unit is the text between the parentheses at the end of the caption and
+    is empty when the caption has none. The header is followed by one record
+    of N values per output step, the first column being the simulation time.
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGOutputBinaryFile : public FGOutputFile
+{
+public:
+  /// Constructor
+  FGOutputBinaryFile(FGFDMExec* fdmex)
+    : FGOutputFile(fdmex), SinglePrecision(false), RateHz(0.0),
+      RateWritten(false) {}
+
+  /** Selects the size of the values written to the file.
+      @param single true to write 32 bits floats, false to write 64 bits
+                    doubles. */
+  void SetSinglePrecision(bool single) { SinglePrecision = single; }
+
+  /** Init the output directives from an XML file.
+      @param element XML Element that is pointing to the output directives
+  */
+  virtual bool Load(Element* el);
+
+  /// The magic string at the beginning of the binary files.
+  static const char Magic[8];
+
+protected:
+  sg_ofstream datafile;
+  bool SinglePrecision;
+
+  virtual bool OpenFile(void);
+  virtual void CloseFile(void) { if (datafile.is_open()) datafile.close(); }
+  virtual bool Collect(FGOutputRecord& record);
+  virtual void Emit(const FGOutputRecord& record);
+
+private:
+  static const std::streamoff RateOffset;
+
+  std::atomic<double> RateHz;
+  bool RateWritten;
+  std::vector<char> Record;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
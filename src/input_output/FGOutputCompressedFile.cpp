@@ -0,0 +1,127 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGOutputCompressedFile.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+ Purpose:      Manage output of sim parameters to a compressed log
+ Called by:    FGOutput
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGOutputCompressedFile.h"
+#include "FGFDMExec.h"
+#include "input_output/FGXMLElement.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGOutputCompressedFile::~FGOutputCompressedFile()
+{
+  // The destructor of FGOutputFile cannot call the CloseFile() method of this
+  // class so the index is written here.
+  Flush();
+  CloseFile();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputCompressedFile::Load(Element* el)
+{
+  if(!FGOutputFile::Load(el))
+    return false;
+
+  if (el->HasAttribute("chunk")) {
+    double frames = el->GetAttributeValueAsNumber("chunk");
+    if (frames < 1.0) {
+      cerr << el->ReadFrom() << fgred << "The chunk size must be at least 1."
+           << " The default of 1024 output steps will be used." << reset
+           << endl;
+    } else
+      ChunkFrames = static_cast<unsigned int>(frames);
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputCompressedFile::OpenFile(void)
+{
+  // The file is still open when the initial conditions are run again without
+  // starting a new output (FGFDMExec::ResetToInitialConditions(0)): the output
+  // then carries on in the same file.
+  if (datafile.is_open()) return true;
+
+  datafile.clear();
+  datafile.open(Filename, ios::out | ios::binary);
+  if (!datafile) {
+    cerr << endl << fgred << highint << "ERROR: unable to open the file "
+         << reset << Filename.c_str() << endl
+         << fgred << highint << "       => Output to this file is disabled."
+         << reset << endl << endl;
+    Disable();
+    return false;
+  }
+
+  vector<string> names = Plan.GetNames();
+  NumColumns = names.size();
+  Log.Start(datafile, names, ChunkFrames);
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputCompressedFile::CloseFile(void)
+{
+  if (datafile.is_open()) {
+    Log.Finish();
+    datafile.close();
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputCompressedFile::Collect(FGOutputRecord& record)
+{
+  if (!datafile.is_open()) return false;
+
+  if (!CollectValues(record)) return false;
+
+  // The number of columns is fixed by the header of the file.
+  return record.values.size() == NumColumns;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputCompressedFile::Emit(const FGOutputRecord& record)
+{
+  Log.AddFrame(record.values.data());
+}
+}
@@ -0,0 +1,113 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGOutputCompressedFile.h
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/2026   Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGOUTPUTCOMPRESSEDFILE_H
+#define FGOUTPUTCOMPRESSEDFILE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGOutputFile.h"
+#include "FGCompressedLog.h"
+#include "simgear/io/iostreams/sgstream.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Implements the output to a compressed log. The file contains the same
+    columns as the CSV output, compressed without loss in chunks of frames
+    (see FGCompressedLogWriter for the format). The chunks are indexed by time
+    so that a tool can decode a time span without decoding the whole file. The
+    utility decode_log converts the file back to CSV.
+
+    The output is selected with <tt>type="COMPRESSED"</tt>. The optional
+    attribute <tt>chunk</tt> sets the number of output steps per chunk (1024
+    by default):
+    @code
+    <output name="soak.jsl" type="COMPRESSED" chunk="4096" rate="100">
+      <property> velocities/vc-kts </property>
+    </output>
+    @endcode
+
+    The index is written when the file is closed. A file that has not been
+    closed can still be decoded up to its last complete chunk.
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGOutputCompressedFile : public FGOutputFile
+{
+public:
+  /// Constructor
+  FGOutputCompressedFile(FGFDMExec* fdmex)
+    : FGOutputFile(fdmex), ChunkFrames(1024), NumColumns(0) {}
+
+  /// Destructor : writes the index and closes the file.
+  ~FGOutputCompressedFile();
+
+  /** Sets the number of output steps per chunk. It is taken into account when
+      the next file is opened.
+      @param frames the number of output steps per chunk. */
+  void SetChunkFrames(unsigned int frames) { ChunkFrames = frames; }
+
+  /** Init the output directives from an XML file.
+      @param element XML Element that is pointing to the output directives
+  */
+  virtual bool Load(Element* el);
+
+protected:
+  sg_ofstream datafile;
+  FGCompressedLogWriter Log;
+  unsigned int ChunkFrames;
+
+  virtual bool OpenFile(void);
+  virtual void CloseFile(void);
+  virtual bool Collect(FGOutputRecord& record);
+  virtual void Emit(const FGOutputRecord& record);
+
+private:
+  size_t NumColumns;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -338,14 +338,23 @@ void FGOutputFG::SocketDataFill(FGNetFDM* net)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-void FGOutputFG::Print(void)
+bool FGOutputFG::Collect(FGOutputRecord& record)
 {
-  int length = sizeof(fgSockBuf);
-
-  if (socket == 0) return;
-  if (!socket->GetConnectStatus()) return;
+  if (socket == 0) return false;
+  if (!socket->GetConnectStatus()) return false;
 
+  // The packet is already in network byte order: it is stored as is.
   SocketDataFill(&fgSockBuf);
-  socket->Send((char *)&fgSockBuf, length);
+  record.AddText(string((char *)&fgSockBuf, sizeof(fgSockBuf)));
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputFG::Emit(const FGOutputRecord& record)
+{
+  const string& packet = record.texts.front();
+  socket->Send(packet.data(), packet.size());
 }
 }
@@ -66,10 +66,12 @@ public:
   /// Constructor
   FGOutputFG(FGFDMExec* fdmex);
 
-  virtual void Print(void);
-
 protected:
+  // The FlightGear packet has a fixed layout so it does not need any column.
+  virtual void BuildPlan(void) {}
   virtual void PrintHeaders(void) {};
+  virtual bool Collect(FGOutputRecord& record);
+  virtual void Emit(const FGOutputRecord& record);
 
 private:
   FGNetFDM fgSockBuf;
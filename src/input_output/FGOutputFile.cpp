@@ -66,6 +66,7 @@ bool FGOutputFile::InitModel(void)
       Filename = SGPath(Name);
       runID_postfix = 0;
     }
+    Flush();
     return OpenFile();
   }
 
@@ -87,6 +88,7 @@ void FGOutputFile::SetStartNewOutput(void)
     Filename = SGPath(buf.str());
   }
 
+  Flush();
   CloseFile();
 }
 
@@ -59,8 +59,8 @@ CLASS DOCUMENTATION
     including the sequence in which the file should be opened then closed. The
     logic of SetStartNewOutput() is also managed in this class. Derived class
     should normally not need to reimplement this method. In most cases, derived
-    classes only need to implement the methods OpenFile(), CloseFile() and
-    Print().
+    classes only need to implement the methods OpenFile(), CloseFile(),
+    Collect() and Emit().
  */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -104,11 +104,6 @@ public:
     runID_postfix = -1;
     Filename = SGPath();
   }
-  /** Generate the output. This is a pure method so it must be implemented by
-      the classes that inherits from FGOutputFile.
-   */
-  void Print(void) = 0;
-
 protected:
   SGPath Filename;
 
@@ -0,0 +1,165 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGOutputPlan.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+ Purpose:      List of the pre-resolved columns of an output
+ Called by:    FGOutputType
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGOutputPlan.h"
+#include "input_output/string_utilities.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+void FGOutputPlan::Clear(void)
+{
+  Columns.clear();
+  ValueColumns.clear();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputPlan::AddValue(const string& caption, function<double(void)> getter,
+                            int precision, int width)
+{
+  Column column;
+  column.Caption = caption;
+  column.Vector = nullptr;
+  column.Index = 0;
+  column.Scale = 1.0;
+  column.Getter = getter;
+  column.Precision = precision;
+  column.Width = width;
+
+  ValueColumns.push_back(Columns.size());
+  Columns.push_back(column);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputPlan::AddVector(const string (&captions)[3],
+                             const FGColumnVector3& v, double scale,
+                             int precision)
+{
+  for (unsigned int i=1; i<=3; ++i) {
+    Column column;
+    column.Caption = captions[i-1];
+    column.Vector = &v;
+    column.Index = i;
+    column.Scale = scale;
+    column.Precision = precision;
+    column.Width = 0;
+
+    ValueColumns.push_back(Columns.size());
+    Columns.push_back(column);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputPlan::AddText(const string& captions, function<string(void)> text,
+                           function<void(vector<double>&)> values,
+                           const string& delimiter)
+{
+  Column column;
+  column.Caption = captions;
+  column.Vector = nullptr;
+  column.Index = 0;
+  column.Scale = 1.0;
+  column.Text = text;
+  column.Values = values;
+  column.Delimiter = delimiter;
+  column.Precision = 0;
+  column.Width = 0;
+
+  if (!captions.empty()) {
+    size_t start = 0;
+    for (;;) {
+      size_t end = captions.find(delimiter, start);
+      string name = captions.substr(start, end == string::npos ? end : end - start);
+      column.Names.push_back(trim(name));
+      if (end == string::npos) break;
+      start = end + delimiter.size();
+    }
+  }
+
+  Columns.push_back(column);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputPlan::Collect(FGOutputRecord& record) const
+{
+  for (auto& column: Columns) {
+    if (column.IsText())
+      record.AddText(column.Text());
+    else
+      record.values.push_back(column.GetValue());
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputPlan::CollectValues(FGOutputRecord& record) const
+{
+  for (auto& column: Columns) {
+    if (!column.IsText()) {
+      record.values.push_back(column.GetValue());
+      continue;
+    }
+
+    // A missing or an extra value would shift all the columns that follow.
+    size_t first = record.values.size();
+    column.Values(record.values);
+    if (record.values.size() - first != column.Names.size())
+      return false;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+vector<string> FGOutputPlan::GetNames(void) const
+{
+  vector<string> names;
+
+  for (auto& column: Columns) {
+    if (column.IsText())
+      names.insert(names.end(), column.Names.begin(), column.Names.end());
+    else
+      names.push_back(column.Caption);
+  }
+
+  return names;
+}
+}
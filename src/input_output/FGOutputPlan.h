@@ -0,0 +1,171 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGOutputPlan.h
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/2026   Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGOUTPUTPLAN_H
+#define FGOUTPUTPLAN_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "input_output/FGOutputWriter.h"
+#include "math/FGColumnVector3.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** The list of the columns of an output, resolved once for all when the output
+    is initialized. Each column knows where its value comes from: the entry of
+    a vector owned by a model (read directly through a pointer and multiplied
+    by a unit conversion factor) or a getter for the values which are computed
+    on request. The output step then boils down to a loop over the columns,
+    and the output types only need to serialize the values collected by
+    Collect() or CollectValues().
+
+    The values whose number depends on the aircraft (aerodynamic functions,
+    FCS components, ground reactions and propulsion) are stored in text
+    columns. Such a column contains several values: it returns them either as
+    a text separated by the delimiter it has been built with, or as numbers
+    appended to a vector.
+
+    The plan stores pointers to the models data so it must be rebuilt whenever
+    the models are reloaded, which is done by FGOutputType::InitModel().
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGOutputPlan
+{
+public:
+  /// A column of the output.
+  struct Column {
+    /// The caption of the column. Text columns hold delimited captions.
+    std::string Caption;
+    /// The vector that holds the value, or null if the value has a getter.
+    const FGColumnVector3* Vector;
+    /// The 1-based index of the value in Vector.
+    unsigned int Index;
+    /// The factor applied to the entry of Vector.
+    double Scale;
+    /// The getter of the value when Vector is null.
+    std::function<double(void)> Getter;
+    /// The getter of the delimited values of a text column.
+    std::function<std::string(void)> Text;
+    /// The getter of the values of a text column as numbers.
+    std::function<void(std::vector<double>&)> Values;
+    /// The captions of the values of a text column.
+    std::vector<std::string> Names;
+    /// The delimiter of the captions and values of a text column.
+    std::string Delimiter;
+    /// The precision and the width used to format the value as text.
+    int Precision;
+    int Width;
+
+    bool IsText(void) const { return static_cast<bool>(Text); }
+    double GetValue(void) const
+    { return Vector ? Scale * (*Vector)(Index) : Getter(); }
+  };
+
+  /// Removes all the columns.
+  void Clear(void);
+
+  /** Adds a column whose value is returned by a getter.
+      @param caption the caption of the column.
+      @param getter the function that returns the value.
+      @param precision the number of significant digits of the text output.
+      @param width the minimal width of the text output. */
+  void AddValue(const std::string& caption, std::function<double(void)> getter,
+                int precision=10, int width=0);
+  /** Adds 3 columns whose values are read from a vector. The vector must
+      outlive the plan and is therefore passed by reference.
+      @param captions the captions of the 3 columns.
+      @param v the vector holding the values.
+      @param scale the factor applied to the values.
+      @param precision the number of significant digits of the text output. */
+  void AddVector(const std::string (&captions)[3], const FGColumnVector3& v,
+                 double scale=1.0, int precision=16);
+  void AddVector(const std::string (&captions)[3], const FGColumnVector3&& v,
+                 double scale=1.0, int precision=16) = delete;
+  /** Adds a text column.
+      @param captions the captions of the values, separated by delimiter.
+      @param text the function that returns the values, separated by
+                  delimiter.
+      @param values the function that appends the same values as numbers to
+                    a vector.
+      @param delimiter the delimiter of the captions and the values. */
+  void AddText(const std::string& captions, std::function<std::string(void)> text,
+               std::function<void(std::vector<double>&)> values,
+               const std::string& delimiter=",");
+
+  /// Returns the columns.
+  const std::vector<Column>& GetColumns(void) const { return Columns; }
+  /// Returns the number of columns that are not text columns.
+  size_t GetNumValues(void) const { return ValueColumns.size(); }
+  /// Returns the i-th column that is not a text column.
+  const Column& GetValueColumn(size_t i) const
+  { return Columns[ValueColumns[i]]; }
+
+  /** Collects the current values. The texts are kept in the record as they
+      are returned by the text columns.
+      @param record the record where the values are stored. */
+  void Collect(FGOutputRecord& record) const;
+  /** Collects the current values as numbers. The values of the text columns
+      are read as numbers, without going through their text.
+      @param record the record where the values are stored.
+      @return false if a text column has not returned one value per caption,
+              in which case the values no longer match GetNames(). */
+  bool CollectValues(FGOutputRecord& record) const;
+  /** Returns the captions, one per value, in the same order as the values
+      collected by CollectValues(). */
+  std::vector<std::string> GetNames(void) const;
+
+private:
+  std::vector<Column> Columns;
+  std::vector<size_t> ValueColumns;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
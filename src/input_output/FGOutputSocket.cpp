@@ -67,7 +67,8 @@ CLASS IMPLEMENTATION
 
 FGOutputSocket::FGOutputSocket(FGFDMExec* fdmex) :
   FGOutputType(fdmex),
-  socket(0)
+  socket(0),
+  Binary(false)
 {
 }
 
@@ -121,6 +122,9 @@ bool FGOutputSocket::Load(Element* el)
                 el->GetAttributeValue("protocol") + "/" +
                 el->GetAttributeValue("port"));
 
+  string format = el->GetAttributeValue("format");
+  Binary = to_upper(format) == "BINARY";
+
   return true;
 }
 
@@ -129,6 +133,7 @@ bool FGOutputSocket::Load(Element* el)
 bool FGOutputSocket::InitModel(void)
 {
   if (FGOutputType::InitModel()) {
+    Flush();
     delete socket;
     socket = new FGfdmSocket(SockName, SockPort, SockProtocol);
 
@@ -145,238 +150,187 @@ bool FGOutputSocket::InitModel(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-void FGOutputSocket::PrintHeaders(void)
+void FGOutputSocket::BuildPlan(void)
 {
-  string scratch;
-
-  socket->Clear();
-  socket->Clear("<LABELS>");
-  socket->Append("Time");
+  FGFDMExec* fdmex = FDMExec;
+  FGFCS* fcs = FCS;
+  FGAuxiliary* aux = Auxiliary;
+  FGPropagate* prop = Propagate;
+  FGAccelerations* accel = Accelerations;
+  FGAerodynamics* aero = Aerodynamics;
+  FGAtmosphere* atm = Atmosphere;
+  FGWinds* winds = Winds;
+  FGMassBalance* mass = MassBalance;
+  FGGroundReactions* ground = GroundReactions;
+  FGPropulsion* propulsion = Propulsion;
+
+  Plan.AddValue("Time", [fdmex]{ return fdmex->GetSimTime(); });
 
   if (SubSystems & ssAerosurfaces) {
-    socket->Append("Aileron Command");
-    socket->Append("Elevator Command");
-    socket->Append("Rudder Command");
-    socket->Append("Flap Command");
-    socket->Append("Left Aileron Position");
-    socket->Append("Right Aileron Position");
-    socket->Append("Elevator Position");
-    socket->Append("Rudder Position");
-    socket->Append("Flap Position");
+    Plan.AddValue("Aileron Command", [fcs]{ return fcs->GetDaCmd(); });
+    Plan.AddValue("Elevator Command", [fcs]{ return fcs->GetDeCmd(); });
+    Plan.AddValue("Rudder Command", [fcs]{ return fcs->GetDrCmd(); });
+    Plan.AddValue("Flap Command", [fcs]{ return fcs->GetDfCmd(); });
+    Plan.AddValue("Left Aileron Position", [fcs]{ return fcs->GetDaLPos(); });
+    Plan.AddValue("Right Aileron Position", [fcs]{ return fcs->GetDaRPos(); });
+    Plan.AddValue("Elevator Position", [fcs]{ return fcs->GetDePos(); });
+    Plan.AddValue("Rudder Position", [fcs]{ return fcs->GetDrPos(); });
+    Plan.AddValue("Flap Position", [fcs]{ return fcs->GetDfPos(); });
   }
-
   if (SubSystems & ssRates) {
-    socket->Append("P");
-    socket->Append("Q");
-    socket->Append("R");
-    socket->Append("PDot");
-    socket->Append("QDot");
-    socket->Append("RDot");
+    Plan.AddVector({"P", "Q", "R"}, prop->GetPQR(), radtodeg);
+    Plan.AddVector({"PDot", "QDot", "RDot"}, accel->GetPQRdot(), radtodeg);
   }
-
   if (SubSystems & ssVelocities) {
-    socket->Append("QBar");
-    socket->Append("Vtotal");
-    socket->Append("UBody");
-    socket->Append("VBody");
-    socket->Append("WBody");
-    socket->Append("UAero");
-    socket->Append("VAero");
-    socket->Append("WAero");
-    socket->Append("Vn");
-    socket->Append("Ve");
-    socket->Append("Vd");
+    Plan.AddValue("QBar", [aux]{ return aux->Getqbar(); });
+    Plan.AddValue("Vtotal", [aux]{ return aux->GetVt(); });
+    Plan.AddVector({"UBody", "VBody", "WBody"}, prop->GetUVW());
+    Plan.AddVector({"UAero", "VAero", "WAero"}, aux->GetAeroUVW());
+    Plan.AddVector({"Vn", "Ve", "Vd"}, prop->GetVel());
   }
-
   if (SubSystems & ssForces) {
-    socket->Append("F_Drag");
-    socket->Append("F_Side");
-    socket->Append("F_Lift");
-    socket->Append("LoD");
-    socket->Append("Fx");
-    socket->Append("Fy");
-    socket->Append("Fz");
+    Plan.AddVector({"F_Drag", "F_Side", "F_Lift"}, aero->GetvFw());
+    Plan.AddValue("LoD", [aero]{ return aero->GetLoD(); });
+    Plan.AddVector({"Fx", "Fy", "Fz"}, Aircraft->GetForces());
   }
-
-  if (SubSystems & ssMoments) {
-    socket->Append("L");
-    socket->Append("M");
-    socket->Append("N");
-  }
-
+  if (SubSystems & ssMoments)
+    Plan.AddVector({"L", "M", "N"}, Aircraft->GetMoments());
   if (SubSystems & ssAtmosphere) {
-    socket->Append("Rho");
-    socket->Append("SL pressure");
-    socket->Append("Ambient pressure");
-    socket->Append("Turbulence Magnitude");
-    socket->Append("Turbulence Direction");
-    socket->Append("NWind");
-    socket->Append("EWind");
-    socket->Append("DWind");
+    Plan.AddValue("Rho", [atm]{ return atm->GetDensity(); });
+    Plan.AddValue("SL pressure", [atm]{ return atm->GetPressureSL(); });
+    Plan.AddValue("Ambient pressure", [atm]{ return atm->GetPressure(); });
+    Plan.AddValue("Turbulence Magnitude",
+                  [winds]{ return winds->GetTurbMagnitude(); });
+    Plan.AddValue("Turbulence Direction",
+                  [winds]{ return winds->GetTurbDirection(); });
+    // The wind is sent with the format of FGColumnVector3::Dump().
+    Plan.AddText("NWind,EWind,DWind",
+                 [winds]{ return winds->GetTotalWindNED().Dump(","); },
+                 [winds](vector<double>& v) {
+                   const FGColumnVector3& wind = winds->GetTotalWindNED();
+                   for (int i=eNorth; i<=eDown; i++)
+                     v.push_back(wind(i));
+                 });
   }
-
   if (SubSystems & ssMassProps) {
-    socket->Append("Ixx");
-    socket->Append("Ixy");
-    socket->Append("Ixz");
-    socket->Append("Iyx");
-    socket->Append("Iyy");
-    socket->Append("Iyz");
-    socket->Append("Izx");
-    socket->Append("Izy");
-    socket->Append("Izz");
-    socket->Append("Mass");
-    socket->Append("Xcg");
-    socket->Append("Ycg");
-    socket->Append("Zcg");
+    const char* inertia[] = {"Ixx", "Ixy", "Ixz", "Iyx", "Iyy", "Iyz", "Izx",
+                             "Izy", "Izz"};
+    for (unsigned int i=0; i<9; ++i) {
+      unsigned int row = i/3 + 1, col = i%3 + 1;
+      Plan.AddValue(inertia[i],
+                    [mass, row, col]{ return mass->GetJ()(row, col); });
+    }
+    Plan.AddValue("Mass", [mass]{ return mass->GetMass(); });
+    Plan.AddVector({"Xcg", "Ycg", "Zcg"}, mass->GetXYZcg());
   }
-
   if (SubSystems & ssPropagate) {
-    socket->Append("Altitude");
-    socket->Append("Phi (deg)");
-    socket->Append("Tht (deg)");
-    socket->Append("Psi (deg)");
-    socket->Append("Alpha (deg)");
-    socket->Append("Beta (deg)");
-    socket->Append("Latitude (deg)");
-    socket->Append("Longitude (deg)");
+    Plan.AddValue("Altitude", [prop]{ return prop->GetAltitudeASL(); });
+    Plan.AddValue("Phi (deg)",
+                  [prop]{ return radtodeg*prop->GetEuler(ePhi); });
+    Plan.AddValue("Tht (deg)",
+                  [prop]{ return radtodeg*prop->GetEuler(eTht); });
+    Plan.AddValue("Psi (deg)",
+                  [prop]{ return radtodeg*prop->GetEuler(ePsi); });
+    Plan.AddValue("Alpha (deg)", [aux]{ return aux->Getalpha(inDegrees); });
+    Plan.AddValue("Beta (deg)", [aux]{ return aux->Getbeta(inDegrees); });
+    Plan.AddValue("Latitude (deg)",
+                  [prop]{ return prop->GetLocation().GetLatitudeDeg(); });
+    Plan.AddValue("Longitude (deg)",
+                  [prop]{ return prop->GetLocation().GetLongitudeDeg(); });
   }
-
   if (SubSystems & ssAeroFunctions) {
-    scratch = Aerodynamics->GetAeroFunctionStrings(",");
-    if (scratch.length() != 0) socket->Append(scratch);
+    string captions = aero->GetAeroFunctionStrings(",");
+    if (!captions.empty())
+      Plan.AddText(captions, [aero]{ return aero->GetAeroFunctionValues(","); },
+                   [aero](vector<double>& v){ aero->GetAeroFunctionValues(v); });
   }
-
   if (SubSystems & ssFCS) {
-    scratch = FCS->GetComponentStrings(",");
-    if (scratch.length() != 0) socket->Append(scratch);
+    string captions = fcs->GetComponentStrings(",");
+    if (!captions.empty())
+      Plan.AddText(captions, [fcs]{ return fcs->GetComponentValues(","); },
+                   [fcs](vector<double>& v){ fcs->GetComponentValues(v); });
   }
-
   if (SubSystems & ssGroundReactions)
-    socket->Append(GroundReactions->GetGroundReactionStrings(","));
-
-  if (SubSystems & ssPropulsion && Propulsion->GetNumEngines() > 0)
-    socket->Append(Propulsion->GetPropulsionStrings(","));
+    Plan.AddText(ground->GetGroundReactionStrings(","),
+                 [ground]{ return ground->GetGroundReactionValues(","); },
+                 [ground](vector<double>& v)
+                 { ground->GetGroundReactionValues(v); });
+  if (SubSystems & ssPropulsion && propulsion->GetNumEngines() > 0)
+    Plan.AddText(propulsion->GetPropulsionStrings(","),
+                 [propulsion]{ return propulsion->GetPropulsionValues(","); },
+                 [propulsion](vector<double>& v)
+                 { propulsion->GetPropulsionValues(v); });
 
   for (unsigned int i=0;i<OutputParameters.size();++i) {
-    if (!OutputCaptions[i].empty())
-      socket->Append(OutputCaptions[i]);
-    else
-      socket->Append(OutputParameters[i]->GetPrintableName());
+    FGPropertyValue* param = OutputParameters[i];
+    string caption = OutputCaptions[i];
+    if (caption.empty()) caption = param->GetPrintableName();
+    Plan.AddValue(caption, [param]{ return param->GetValue(); });
   }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGOutputSocket::PrintHeaders(void)
+{
+  if (Binary) {
+    vector<string> names = Plan.GetNames();
+    FGSocketMessageWriter labels;
+    labels.Start(FGSocketMessage::mtLabels);
+    labels.PutShort(static_cast<uint16_t>(names.size()));
+    for (auto& name: names)
+      labels.PutString(name);
+    const string& data = labels.Finish();
+    socket->Send(data.c_str(), data.size());
+    return;
+  }
+
+  socket->Clear();
+  socket->Clear("<LABELS>");
+  for (auto& column: Plan.GetColumns())
+    socket->Append(column.Caption);
   socket->Send();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-void FGOutputSocket::Print(void)
+bool FGOutputSocket::Collect(FGOutputRecord& record)
 {
-  string asciiData, scratch;
+  if (socket == 0) return false;
+  if (!socket->GetConnectStatus()) return false;
 
-  if (socket == 0) return;
-  if (!socket->GetConnectStatus()) return;
+  if (Binary)
+    return CollectValues(record);
 
-  socket->Clear();
-  socket->Append(FDMExec->GetSimTime());
+  Plan.Collect(record);
 
-  if (SubSystems & ssAerosurfaces) {
-    socket->Append(FCS->GetDaCmd());
-    socket->Append(FCS->GetDeCmd());
-    socket->Append(FCS->GetDrCmd());
-    socket->Append(FCS->GetDfCmd());
-    socket->Append(FCS->GetDaLPos());
-    socket->Append(FCS->GetDaRPos());
-    socket->Append(FCS->GetDePos());
-    socket->Append(FCS->GetDrPos());
-    socket->Append(FCS->GetDfPos());
-  }
-  if (SubSystems & ssRates) {
-    socket->Append(radtodeg*Propagate->GetPQR(eP));
-    socket->Append(radtodeg*Propagate->GetPQR(eQ));
-    socket->Append(radtodeg*Propagate->GetPQR(eR));
-    socket->Append(radtodeg*Accelerations->GetPQRdot(eP));
-    socket->Append(radtodeg*Accelerations->GetPQRdot(eQ));
-    socket->Append(radtodeg*Accelerations->GetPQRdot(eR));
-  }
-  if (SubSystems & ssVelocities) {
-    socket->Append(Auxiliary->Getqbar());
-    socket->Append(Auxiliary->GetVt());
-    socket->Append(Propagate->GetUVW(eU));
-    socket->Append(Propagate->GetUVW(eV));
-    socket->Append(Propagate->GetUVW(eW));
-    socket->Append(Auxiliary->GetAeroUVW(eU));
-    socket->Append(Auxiliary->GetAeroUVW(eV));
-    socket->Append(Auxiliary->GetAeroUVW(eW));
-    socket->Append(Propagate->GetVel(eNorth));
-    socket->Append(Propagate->GetVel(eEast));
-    socket->Append(Propagate->GetVel(eDown));
-  }
-  if (SubSystems & ssForces) {
-    socket->Append(Aerodynamics->GetvFw()(eDrag));
-    socket->Append(Aerodynamics->GetvFw()(eSide));
-    socket->Append(Aerodynamics->GetvFw()(eLift));
-    socket->Append(Aerodynamics->GetLoD());
-    socket->Append(Aircraft->GetForces(eX));
-    socket->Append(Aircraft->GetForces(eY));
-    socket->Append(Aircraft->GetForces(eZ));
-  }
-  if (SubSystems & ssMoments) {
-    socket->Append(Aircraft->GetMoments(eL));
-    socket->Append(Aircraft->GetMoments(eM));
-    socket->Append(Aircraft->GetMoments(eN));
-  }
-  if (SubSystems & ssAtmosphere) {
-    socket->Append(Atmosphere->GetDensity());
-    socket->Append(Atmosphere->GetPressureSL());
-    socket->Append(Atmosphere->GetPressure());
-    socket->Append(Winds->GetTurbMagnitude());
-    socket->Append(Winds->GetTurbDirection());
-    socket->Append(Winds->GetTotalWindNED().Dump(","));
-  }
-  if (SubSystems & ssMassProps) {
-    socket->Append(MassBalance->GetJ()(1,1));
-    socket->Append(MassBalance->GetJ()(1,2));
-    socket->Append(MassBalance->GetJ()(1,3));
-    socket->Append(MassBalance->GetJ()(2,1));
-    socket->Append(MassBalance->GetJ()(2,2));
-    socket->Append(MassBalance->GetJ()(2,3));
-    socket->Append(MassBalance->GetJ()(3,1));
-    socket->Append(MassBalance->GetJ()(3,2));
-    socket->Append(MassBalance->GetJ()(3,3));
-    socket->Append(MassBalance->GetMass());
-    socket->Append(MassBalance->GetXYZcg()(eX));
-    socket->Append(MassBalance->GetXYZcg()(eY));
-    socket->Append(MassBalance->GetXYZcg()(eZ));
-  }
-  if (SubSystems & ssPropagate) {
-    socket->Append(Propagate->GetAltitudeASL());
-    socket->Append(radtodeg*Propagate->GetEuler(ePhi));
-    socket->Append(radtodeg*Propagate->GetEuler(eTht));
-    socket->Append(radtodeg*Propagate->GetEuler(ePsi));
-    socket->Append(Auxiliary->Getalpha(inDegrees));
-    socket->Append(Auxiliary->Getbeta(inDegrees));
-    socket->Append(Propagate->GetLocation().GetLatitudeDeg());
-    socket->Append(Propagate->GetLocation().GetLongitudeDeg());
-  }
-  if (SubSystems & ssAeroFunctions) {
-    scratch = Aerodynamics->GetAeroFunctionValues(",");
-    if (scratch.length() != 0) socket->Append(scratch);
-  }
-  if (SubSystems & ssFCS) {
-    scratch = FCS->GetComponentValues(",");
-    if (scratch.length() != 0) socket->Append(scratch);
-  }
-  if (SubSystems & ssGroundReactions) {
-    socket->Append(GroundReactions->GetGroundReactionValues(","));
-  }
-  if (SubSystems & ssPropulsion && Propulsion->GetNumEngines() > 0) {
-    socket->Append(Propulsion->GetPropulsionValues(","));
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputSocket::Emit(const FGOutputRecord& record)
+{
+  if (Binary) {
+    Message.Start(FGSocketMessage::mtData);
+    Message.PutInt(static_cast<uint32_t>(record.values.size()));
+    for (double value: record.values)
+      Message.PutDouble(value);
+    const string& data = Message.Finish();
+    socket->Send(data.c_str(), data.size());
+    return;
   }
 
-  for (unsigned int i=0;i<OutputParameters.size();++i) {
-    socket->Append(OutputParameters[i]->GetValue());
+  size_t text = 0;
+
+  socket->Clear();
+  for (size_t i=0; i<record.values.size(); ++i) {
+    for (; text < record.texts.size() && record.positions[text] == i; ++text)
+      socket->Append(record.texts[text]);
+    socket->Append(record.values[i]);
   }
+  for (; text < record.texts.size(); ++text)
+    socket->Append(record.texts[text]);
 
   socket->Send();
 }
@@ -389,6 +343,18 @@ void FGOutputSocket::SocketStatusOutput(const string& out_str)
 
   if (socket == 0) return;
 
+  // The status must not be mixed with the output being sent by the writer.
+  Flush();
+
+  if (Binary) {
+    FGSocketMessageWriter status;
+    status.Start(FGSocketMessage::mtStatus);
+    status.PutString(out_str);
+    const string& data = status.Finish();
+    socket->Send(data.c_str(), data.size());
+    return;
+  }
+
   socket->Clear();
   asciiData = string("<STATUS>") + out_str;
   socket->Append(asciiData.c_str());
@@ -41,6 +41,7 @@ INCLUDES
 #include "FGOutputType.h"
 #include "input_output/net_fdm.hxx"
 #include "input_output/FGfdmSocket.h"
+#include "input_output/FGSocketMessage.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -57,6 +58,12 @@ CLASS DOCUMENTATION
     provides services for socket outputs. For instance FGOutputFG inherits
     FGOutputSocket for the socket management but outputs data with a format
     different than FGOutputSocket.
+
+    By default the values are sent as comma separated text. With the
+    attribute format="BINARY" they are sent as framed binary messages instead
+    (see FGSocketMessage): the labels once when the output is initialized then
+    one message per output step holding all the values as doubles, which is
+    both faster to produce and to parse and does not lose any precision.
  */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -92,8 +99,6 @@ public:
       @result true if the execution succeeded.
    */
   bool InitModel(void);
-  /// Generates the output.
-  void Print(void);
 
   /** Outputs a status thru the socket. This method issues a message prepended
       by the string "<STATUS>" to the socket.
@@ -102,12 +107,17 @@ public:
   void SocketStatusOutput(const std::string& out_str);
 
 protected:
+  virtual void BuildPlan(void);
   virtual void PrintHeaders(void);
+  virtual bool Collect(FGOutputRecord& record);
+  virtual void Emit(const FGOutputRecord& record);
 
   std::string SockName;
   unsigned int SockPort;
   FGfdmSocket::ProtocolType SockProtocol;
   FGfdmSocket* socket;
+  bool Binary;
+  FGSocketMessageWriter Message;
 };
 }
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
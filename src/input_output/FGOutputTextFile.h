@@ -79,15 +79,16 @@ public:
   */
   virtual bool Load(Element* el);
 
-  /// Generates the output to the text file.
-  virtual void Print(void);
-
 protected:
   std::string delimeter;
   sg_ofstream datafile;
 
   virtual bool OpenFile(void);
   virtual void CloseFile(void) { if (datafile.is_open()) datafile.close(); }
+  virtual void BuildPlan(void) { BuildStandardPlan(delimeter); }
+  virtual bool Collect(FGOutputRecord& record);
+  virtual void Emit(const FGOutputRecord& record);
+
 };
 }
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
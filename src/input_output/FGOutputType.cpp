@@ -41,6 +41,19 @@ INCLUDES
 
 #include "FGFDMExec.h"
 #include "FGOutputType.h"
+#include "models/FGAerodynamics.h"
+#include "models/FGAccelerations.h"
+#include "models/FGAircraft.h"
+#include "models/FGAtmosphere.h"
+#include "models/FGAuxiliary.h"
+#include "models/FGPropulsion.h"
+#include "models/FGMassBalance.h"
+#include "models/FGPropagate.h"
+#include "models/FGGroundReactions.h"
+#include "models/FGExternalReactions.h"
+#include "models/FGBuoyantForces.h"
+#include "models/FGFCS.h"
+#include "models/atmosphere/FGWinds.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGPropertyManager.h"
 #include "math/FGTemplateFunc.h"
@@ -57,7 +70,8 @@ CLASS IMPLEMENTATION
 FGOutputType::FGOutputType(FGFDMExec* fdmex) :
   FGModel(fdmex),
   SubSystems(0),
-  enabled(true)
+  enabled(true),
+  Writer(nullptr)
 {
   Aerodynamics = FDMExec->GetAerodynamics();
   Auxiliary = FDMExec->GetAuxiliary();
@@ -80,6 +94,8 @@ FGOutputType::FGOutputType(FGFDMExec* fdmex) :
 
 FGOutputType::~FGOutputType()
 {
+  delete Writer;
+
   vector<FGPropertyValue*>::iterator it;
   for (it=OutputParameters.begin(); it != OutputParameters.end(); ++it)
     delete *it;
@@ -95,6 +111,8 @@ void FGOutputType::SetIdx(unsigned int idx)
 
   PropertyManager->Tie(outputProp + "/log_rate_hz", this, &FGOutputType::GetRateHz, &FGOutputType::SetRateHz, false);
   PropertyManager->Tie(outputProp + "/enabled", &enabled);
+  PropertyManager->Tie(outputProp + "/dropped-frames", this, &FGOutputType::GetDroppedFrames);
+  PropertyManager->Tie(outputProp + "/queued-frames", this, &FGOutputType::GetQueuedFrames);
   OutputIdx = idx;
 }
 
@@ -172,21 +190,311 @@ bool FGOutputType::Load(Element* element)
 
   SetRateHz(outRate);
 
+  if (element->GetAttributeValue("async") == "true") {
+    size_t capacity = 256;
+    FGOutputWriter::eOverflow overflow = FGOutputWriter::ofBlock;
+
+    if (element->HasAttribute("queue"))
+      capacity = max(1.0, element->GetAttributeValueAsNumber("queue"));
+    if (element->HasAttribute("overflow")) {
+      string policy = element->GetAttributeValue("overflow");
+      if (!FGOutputWriter::GetOverflowPolicy(policy, overflow))
+        cerr << element->ReadFrom() << fgred << "Unknown overflow policy "
+             << policy << ". The output will block when its queue is full."
+             << reset << endl;
+    }
+
+    SetAsync(true, capacity, overflow);
+  }
+
   return true;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGOutputType::SetAsync(bool async, size_t capacity,
+                            FGOutputWriter::eOverflow overflow)
+{
+  // The pending output steps are emitted before the writer is replaced.
+  delete Writer;
+  Writer = nullptr;
+
+  if (async)
+    Writer = new FGOutputWriter([this](const FGOutputRecord& record)
+                                { Emit(record); }, capacity, overflow);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int FGOutputType::GetDroppedFrames(void) const
+{
+  return Writer ? Writer->GetDroppedRecords() : 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int FGOutputType::GetQueuedFrames(void) const
+{
+  return Writer ? Writer->GetPendingRecords() : 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGOutputType::InitModel(void)
 {
   bool ret = FGModel::InitModel();
 
+  // The writer thread must not emit the queued output steps while the columns
+  // are modified.
+  Flush();
+  Plan.Clear();
+  BuildPlan();
+
   Debug(2);
   return ret;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGOutputType::BuildStandardPlan(const string& delimiter)
+{
+  // The getters capture the models rather than "this" to save an indirection.
+  FGFDMExec* fdmex = FDMExec;
+  FGFCS* fcs = FCS;
+  FGAuxiliary* aux = Auxiliary;
+  FGPropagate* prop = Propagate;
+  FGAccelerations* accel = Accelerations;
+  FGAerodynamics* aero = Aerodynamics;
+  FGAtmosphere* atm = Atmosphere;
+  FGWinds* winds = Winds;
+  FGMassBalance* mass = MassBalance;
+  FGGroundReactions* ground = GroundReactions;
+  FGPropulsion* propulsion = Propulsion;
+
+  Plan.AddValue("Time", [fdmex]{ return fdmex->GetSimTime(); });
+
+  if (SubSystems & ssAerosurfaces) {
+    Plan.AddValue("Aileron Command (norm)", [fcs]{ return fcs->GetDaCmd(); });
+    Plan.AddValue("Elevator Command (norm)", [fcs]{ return fcs->GetDeCmd(); });
+    Plan.AddValue("Rudder Command (norm)", [fcs]{ return fcs->GetDrCmd(); });
+    Plan.AddValue("Flap Command (norm)", [fcs]{ return fcs->GetDfCmd(); });
+    Plan.AddValue("Left Aileron Position (deg)",
+                  [fcs]{ return fcs->GetDaLPos(ofDeg); });
+    Plan.AddValue("Right Aileron Position (deg)",
+                  [fcs]{ return fcs->GetDaRPos(ofDeg); });
+    Plan.AddValue("Elevator Position (deg)",
+                  [fcs]{ return fcs->GetDePos(ofDeg); });
+    Plan.AddValue("Rudder Position (deg)",
+                  [fcs]{ return fcs->GetDrPos(ofDeg); });
+    Plan.AddValue("Flap Position (deg)", [fcs]{ return fcs->GetDfPos(ofDeg); });
+  }
+  if (SubSystems & ssRates) {
+    Plan.AddVector({"P (deg/s)", "Q (deg/s)", "R (deg/s)"},
+                   prop->GetPQR(), radtodeg);
+    Plan.AddVector({"P dot (deg/s^2)", "Q dot (deg/s^2)", "R dot (deg/s^2)"},
+                   accel->GetPQRdot(), radtodeg);
+    Plan.AddVector({"P_{inertial} (deg/s)", "Q_{inertial} (deg/s)",
+                    "R_{inertial} (deg/s)"}, prop->GetPQRi(), radtodeg);
+  }
+  if (SubSystems & ssVelocities) {
+    Plan.AddValue("q bar (psf)", [aux]{ return aux->Getqbar(); });
+    Plan.AddValue("Reynolds Number", [aux]{ return aux->GetReynoldsNumber(); });
+    Plan.AddValue("V_{Total} (ft/s)", [aux]{ return aux->GetVt(); }, 12);
+    Plan.AddValue("V_{Inertial} (ft/s)",
+                  [prop]{ return prop->GetInertialVelocityMagnitude(); }, 12);
+    Plan.AddVector({"UBody", "VBody", "WBody"}, prop->GetUVW());
+    Plan.AddVector({"UdotBody", "VdotBody", "WdotBody"}, accel->GetUVWdot());
+    Plan.AddVector({"UdotBody_i", "VdotBody_i", "WdotBody_i"},
+                   accel->GetUVWidot());
+    Plan.AddVector({"BodyAccel_X", "BodyAccel_Y", "BodyAccel_Z"},
+                   accel->GetBodyAccel());
+    Plan.AddVector({"Aero V_{X Body} (ft/s)", "Aero V_{Y Body} (ft/s)",
+                    "Aero V_{Z Body} (ft/s)"}, aux->GetAeroUVW());
+    Plan.AddVector({"V_{X_{inertial}} (ft/s)", "V_{Y_{inertial}} (ft/s)",
+                    "V_{Z_{inertial}} (ft/s)"}, prop->GetInertialVelocity());
+    // The ECEF velocity is computed on request.
+    Plan.AddValue("V_{X_{ecef}} (ft/s)",
+                  [prop]{ return prop->GetECEFVelocity(eX); }, 16);
+    Plan.AddValue("V_{Y_{ecef}} (ft/s)",
+                  [prop]{ return prop->GetECEFVelocity(eY); }, 16);
+    Plan.AddValue("V_{Z_{ecef}} (ft/s)",
+                  [prop]{ return prop->GetECEFVelocity(eZ); }, 16);
+    Plan.AddVector({"V_{North} (ft/s)", "V_{East} (ft/s)", "V_{Down} (ft/s)"},
+                   prop->GetVel());
+  }
+  if (SubSystems & ssForces) {
+    Plan.AddVector({"F_{Drag} (lbs)", "F_{Side} (lbs)", "F_{Lift} (lbs)"},
+                   aero->GetvFw());
+    Plan.AddValue("L/D", [aero]{ return aero->GetLoD(); });
+    Plan.AddVector({"F_{Aero x} (lbs)", "F_{Aero y} (lbs)", "F_{Aero z} (lbs)"},
+                   aero->GetForces());
+    Plan.AddVector({"F_{Prop x} (lbs)", "F_{Prop y} (lbs)", "F_{Prop z} (lbs)"},
+                   propulsion->GetForces());
+    // The forces of FGAccelerations are computed on request.
+    Plan.AddValue("F_{Gear x} (lbs)",
+                  [accel]{ return accel->GetGroundForces(eX); }, 16);
+    Plan.AddValue("F_{Gear y} (lbs)",
+                  [accel]{ return accel->GetGroundForces(eY); }, 16);
+    Plan.AddValue("F_{Gear z} (lbs)",
+                  [accel]{ return accel->GetGroundForces(eZ); }, 16);
+    Plan.AddVector({"F_{Ext x} (lbs)", "F_{Ext y} (lbs)", "F_{Ext z} (lbs)"},
+                   ExternalReactions->GetForces());
+    Plan.AddVector({"F_{Buoyant x} (lbs)", "F_{Buoyant y} (lbs)",
+                    "F_{Buoyant z} (lbs)"}, BuoyantForces->GetForces());
+    Plan.AddValue("F_{Weight x} (lbs)",
+                  [accel]{ return accel->GetWeight()(eX); }, 16);
+    Plan.AddValue("F_{Weight y} (lbs)",
+                  [accel]{ return accel->GetWeight()(eY); }, 16);
+    Plan.AddValue("F_{Weight z} (lbs)",
+                  [accel]{ return accel->GetWeight()(eZ); }, 16);
+    Plan.AddValue("F_{Total x} (lbs)",
+                  [accel]{ return accel->GetForces(eX); }, 16);
+    Plan.AddValue("F_{Total y} (lbs)",
+                  [accel]{ return accel->GetForces(eY); }, 16);
+    Plan.AddValue("F_{Total z} (lbs)",
+                  [accel]{ return accel->GetForces(eZ); }, 16);
+  }
+  if (SubSystems & ssMoments) {
+    Plan.AddVector({"L_{Aero} (ft-lbs)", "M_{Aero} (ft-lbs)",
+                    "N_{Aero} (ft-lbs)"}, aero->GetMoments());
+    Plan.AddVector({"L_{Aero MRC} (ft-lbs)", "M_{Aero MRC} (ft-lbs)",
+                    "N_{Aero MRC} (ft-lbs)"}, aero->GetMomentsMRC());
+    Plan.AddVector({"L_{Prop} (ft-lbs)", "M_{Prop} (ft-lbs)",
+                    "N_{Prop} (ft-lbs)"}, propulsion->GetMoments());
+    Plan.AddValue("L_{Gear} (ft-lbs)",
+                  [accel]{ return accel->GetGroundMoments(eL); }, 16);
+    Plan.AddValue("M_{Gear} (ft-lbs)",
+                  [accel]{ return accel->GetGroundMoments(eM); }, 16);
+    Plan.AddValue("N_{Gear} (ft-lbs)",
+                  [accel]{ return accel->GetGroundMoments(eN); }, 16);
+    Plan.AddVector({"L_{ext} (ft-lbs)", "M_{ext} (ft-lbs)",
+                    "N_{ext} (ft-lbs)"}, ExternalReactions->GetMoments());
+    Plan.AddVector({"L_{Buoyant} (ft-lbs)", "M_{Buoyant} (ft-lbs)",
+                    "N_{Buoyant} (ft-lbs)"}, BuoyantForces->GetMoments());
+    Plan.AddValue("L_{Total} (ft-lbs)",
+                  [accel]{ return accel->GetMoments(eL); }, 16);
+    Plan.AddValue("M_{Total} (ft-lbs)",
+                  [accel]{ return accel->GetMoments(eM); }, 16);
+    Plan.AddValue("N_{Total} (ft-lbs)",
+                  [accel]{ return accel->GetMoments(eN); }, 16);
+  }
+  if (SubSystems & ssAtmosphere) {
+    Plan.AddValue("Rho (slugs/ft^3)", [atm]{ return atm->GetDensity(); });
+    Plan.AddValue("Absolute Viscosity",
+                  [atm]{ return atm->GetAbsoluteViscosity(); });
+    Plan.AddValue("Kinematic Viscosity",
+                  [atm]{ return atm->GetKinematicViscosity(); });
+    Plan.AddValue("Temperature (R)", [atm]{ return atm->GetTemperature(); });
+    Plan.AddValue("P_{SL} (psf)", [atm]{ return atm->GetPressureSL(); });
+    Plan.AddValue("P_{Ambient} (psf)", [atm]{ return atm->GetPressure(); });
+    Plan.AddValue("Turbulence Magnitude (ft/sec)",
+                  [winds]{ return winds->GetTurbMagnitude(); });
+    Plan.AddValue("Turbulence X Direction (deg)",
+                  [winds]{ return winds->GetTurbDirection(); });
+    Plan.AddVector({"Wind V_{North} (ft/s)", "Wind V_{East} (ft/s)",
+                    "Wind V_{Down} (ft/s)"}, winds->GetTotalWindNED());
+    Plan.AddVector({"Roll Turbulence (deg/sec)", "Pitch Turbulence (deg/sec)",
+                    "Yaw Turbulence (deg/sec)"}, winds->GetTurbPQR(), radtodeg);
+  }
+  if (SubSystems & ssMassProps) {
+    // Same format as FGMatrix33::Dump()
+    const char* inertia[] = {"I_{xx}", "I_{xy}", "I_{xz}", "I_{yx}", "I_{yy}",
+                             "I_{yz}", "I_{zx}", "I_{zy}", "I_{zz}"};
+    for (unsigned int i=0; i<9; ++i) {
+      unsigned int row = i/3 + 1, col = i%3 + 1;
+      Plan.AddValue(inertia[i],
+                    [mass, row, col]{ return mass->GetJ()(row, col); }, 10, 12);
+    }
+    Plan.AddValue("Mass", [mass]{ return mass->GetMass(); });
+    Plan.AddValue("Weight", [mass]{ return mass->GetWeight(); });
+    Plan.AddVector({"X_{cg}", "Y_{cg}", "Z_{cg}"}, mass->GetXYZcg());
+  }
+  if (SubSystems & ssPropagate) {
+    Plan.AddValue("Altitude ASL (ft)",
+                  [prop]{ return prop->GetAltitudeASL(); }, 14);
+    Plan.AddValue("Altitude AGL (ft)",
+                  [prop]{ return prop->GetDistanceAGL(); }, 14);
+    // The Euler angles are computed on request.
+    Plan.AddValue("Phi (deg)",
+                  [prop]{ return radtodeg*prop->GetEuler(ePhi); }, 16);
+    Plan.AddValue("Theta (deg)",
+                  [prop]{ return radtodeg*prop->GetEuler(eTht); }, 16);
+    Plan.AddValue("Psi (deg)",
+                  [prop]{ return radtodeg*prop->GetEuler(ePsi); }, 16);
+    // Same precision as FGQuaternion::Dump()
+    for (unsigned int i=1; i<=4; ++i)
+      Plan.AddValue("Q(" + to_string(i) + ")_{LOCAL}",
+                    [prop, i]{ return prop->GetQuaternion()(i); }, 16);
+    for (unsigned int i=1; i<=4; ++i)
+      Plan.AddValue("Q(" + to_string(i) + ")_{ECEF}",
+                    [prop, i]{ return prop->GetQuaternionECEF()(i); }, 16);
+    for (unsigned int i=1; i<=4; ++i)
+      Plan.AddValue("Q(" + to_string(i) + ")_{ECI}",
+                    [prop, i]{ return prop->GetQuaternionECI()(i); }, 16);
+    Plan.AddValue("Alpha (deg)", [aux]{ return aux->Getalpha(inDegrees); }, 14);
+    Plan.AddValue("Beta (deg)", [aux]{ return aux->Getbeta(inDegrees); }, 14);
+    Plan.AddValue("Latitude (deg)",
+                  [prop]{ return prop->GetLocation().GetLatitudeDeg(); }, 14);
+    Plan.AddValue("Latitude Geodetic (deg)",
+                  [prop]{ return prop->GetLocation().GetGeodLatitudeDeg(); },
+                  14);
+    Plan.AddValue("Longitude (deg)",
+                  [prop]{ return prop->GetLocation().GetLongitudeDeg(); }, 14);
+    Plan.AddVector({"X_{ECI} (ft)", "Y_{ECI} (ft)", "Z_{ECI} (ft)"},
+                   prop->GetInertialPosition());
+    Plan.AddVector({"X_{ECEF} (ft)", "Y_{ECEF} (ft)", "Z_{ECEF} (ft)"},
+                   prop->GetLocation());
+    Plan.AddValue("Earth Position Angle (deg)",
+                  [prop]{ return prop->GetEarthPositionAngleDeg(); }, 14);
+    Plan.AddValue("Distance AGL (ft)",
+                  [prop]{ return prop->GetDistanceAGL(); }, 14);
+    Plan.AddValue("Terrain Elevation (ft)",
+                  [prop]{ return prop->GetTerrainElevation(); }, 14);
+  }
+  if (SubSystems & ssAeroFunctions) {
+    string captions = aero->GetAeroFunctionStrings(delimiter);
+    if (!captions.empty())
+      Plan.AddText(captions, [aero, delimiter]
+                   { return aero->GetAeroFunctionValues(delimiter); },
+                   [aero](vector<double>& v){ aero->GetAeroFunctionValues(v); },
+                   delimiter);
+  }
+  if (SubSystems & ssFCS) {
+    string captions = fcs->GetComponentStrings(delimiter);
+    if (!captions.empty())
+      Plan.AddText(captions, [fcs, delimiter]
+                   { return fcs->GetComponentValues(delimiter); },
+                   [fcs](vector<double>& v){ fcs->GetComponentValues(v); },
+                   delimiter);
+  }
+  if (SubSystems & ssGroundReactions)
+    Plan.AddText(ground->GetGroundReactionStrings(delimiter), [ground, delimiter]
+                 { return ground->GetGroundReactionValues(delimiter); },
+                 [ground](vector<double>& v)
+                 { ground->GetGroundReactionValues(v); },
+                 delimiter);
+  if (SubSystems & ssPropulsion && propulsion->GetNumEngines() > 0)
+    Plan.AddText(propulsion->GetPropulsionStrings(delimiter),
+                 [propulsion, delimiter]
+                 { return propulsion->GetPropulsionValues(delimiter); },
+                 [propulsion](vector<double>& v)
+                 { propulsion->GetPropulsionValues(v); },
+                 delimiter);
+
+  for (unsigned int i=0;i<OutputParameters.size();++i) {
+    FGPropertyValue* param = OutputParameters[i];
+    string caption = OutputCaptions[i];
+    if (caption.empty()) caption = param->GetFullyQualifiedName();
+    Plan.AddValue(caption, [param]{ return param->GetValue(); }, 18);
+  }
+  for (unsigned int i=0;i<PreFunctions.size();i++) {
+    FGFunction* f = PreFunctions[i];
+    Plan.AddValue(f->GetName(), [f]{ return f->getDoubleValue(); }, 18);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGOutputType::Run(void)
 {
   if (FGModel::Run(false)) return true;
@@ -203,6 +511,32 @@ bool FGOutputType::Run(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGOutputType::Print(void)
+{
+  Scratch.Clear();
+  if (!Collect(Scratch)) return;
+
+  if (Writer)
+    Writer->Push(Scratch);
+  else
+    Emit(Scratch);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputType::CollectValues(FGOutputRecord& record)
+{
+  if (Plan.CollectValues(record)) return true;
+
+  cerr << endl << fgred << highint << "ERROR: the values of the output " << Name
+       << " do not match its captions." << endl
+       << "       => Output is disabled." << reset << endl;
+  Disable();
+  return false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGOutputType::SetRateHz(double rtHz)
 {
   rtHz = rtHz>1000?1000:(rtHz<0?0:rtHz);
@@ -39,6 +39,8 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include "models/FGModel.h"
+#include "input_output/FGOutputWriter.h"
+#include "input_output/FGOutputPlan.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -81,6 +83,31 @@ CLASS DOCUMENTATION
     The class mimics some functionalities of FGModel (methods InitModel(),
     Run() and SetRate()). However it does not inherit from FGModel since it is
     conceptually different from the model paradigm.
+
+    The output generation is split in two steps: Collect() takes a snapshot of
+    the values to output and Emit() formats them and performs the I/O. When
+    the output is asynchronous, only Collect() is executed by the simulation
+    thread and Emit() is executed by a background thread (see FGOutputWriter).
+    The asynchronous mode is enabled by the attribute <tt>async="true"</tt> of
+    the output directives. The attribute <tt>queue</tt> sets the number of
+    output steps that can be waiting to be emitted (256 by default) and the
+    attribute <tt>overflow</tt> sets what happens when that number is reached:
+    <tt>block</tt> (the default) waits for the background thread,
+    <tt>drop-oldest</tt> and <tt>drop-newest</tt> discard an output step.
+    @code
+    <output name="localhost" type="SOCKET" port="1138" rate="60"
+            async="true" queue="64" overflow="drop-oldest">
+      <property> velocities/vc-kts </property>
+    </output>
+    @endcode
+    The number of output steps that have been discarded is available in the
+    property <tt>simulation/output[n]/dropped-frames</tt> and the number of
+    output steps waiting to be emitted in
+    <tt>simulation/output[n]/queued-frames</tt>.
+
+    The columns of the output are resolved by BuildPlan() when the output is
+    initialized and stored in an FGOutputPlan, so that Collect() does not need
+    to test the selected subsystems nor to find the values at each step.
  */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -148,11 +175,27 @@ public:
    */
   bool Run(void);
 
-  /** Generate the output. This is a pure method so it must be implemented by
-      the classes that inherits from FGOutputType. The Print name may not be
-      relevant to all outputs but it has been kept for backward compatibility.
+  /** Generate the output. The values are collected by Collect() and are
+      either emitted immediately by Emit() or queued for the writer thread if
+      the output is asynchronous. The Print name may not be relevant to all
+      outputs but it has been kept for backward compatibility.
    */
-  virtual void Print(void) = 0;
+  virtual void Print(void);
+
+  /** Enables or disables the asynchronous output.
+      @param async true to emit the output from a background thread.
+      @param capacity the number of output steps that can be queued.
+      @param overflow the policy applied when the queue is full. */
+  void SetAsync(bool async, size_t capacity=256,
+                FGOutputWriter::eOverflow overflow=FGOutputWriter::ofBlock);
+  /// Returns true if the output is asynchronous.
+  bool GetAsync(void) const { return Writer != nullptr; }
+  /// Waits until the queued output steps have been emitted.
+  void Flush(void) { if (Writer) Writer->Flush(); }
+  /// Returns the number of output steps discarded by the asynchronous output.
+  int GetDroppedFrames(void) const;
+  /// Returns the number of output steps waiting to be emitted.
+  int GetQueuedFrames(void) const;
 
   /** Reset the output prior to a restart of the simulation. This method should
       be called when the simulation is restarted with, for example, new initial
@@ -209,7 +252,39 @@ protected:
   FGExternalReactions* ExternalReactions;
   FGBuoyantForces* BuoyantForces;
 
+  /// The columns of the output.
+  FGOutputPlan Plan;
+
+  /** Builds the columns of the output. This method is called by InitModel()
+      and builds the same columns as the CSV output by default. */
+  virtual void BuildPlan(void) { BuildStandardPlan(","); }
+  /** Builds the columns of the CSV output: the simulation time, the selected
+      subsystems, the properties and the "pre" functions.
+      @param delimiter the delimiter of the text columns. */
+  void BuildStandardPlan(const std::string& delimiter);
+
+  /** Collects the values of the current output step. This method is always
+      executed by the simulation thread.
+      @param record the record where the values are stored. It is empty when
+                    the method is called.
+      @result false if there is nothing to output. */
+  virtual bool Collect(FGOutputRecord& record) { return false; }
+  /** Collects the values of the plan as numbers for the outputs which write
+      one number per caption of FGOutputPlan::GetNames(). The output is
+      disabled if the values no longer match the captions.
+      @param record the record where the values are stored.
+      @result false if the output has been disabled. */
+  bool CollectValues(FGOutputRecord& record);
+  /** Formats and writes the values collected by Collect(). This method is
+      executed by the writer thread when the output is asynchronous so it must
+      not access the models. */
+  virtual void Emit(const FGOutputRecord& record) {}
+
   void Debug(int from);
+
+private:
+  FGOutputWriter* Writer;
+  FGOutputRecord Scratch;
 };
 }
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -0,0 +1,236 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGOutputWriter.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+ Purpose:      Emits output records from a background thread
+ Called by:    FGOutputType
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+The ring buffer is the bounded queue of Dmitry Vyukov: each slot holds a
+sequence number that tells whether it is ready to be written or to be read.
+The simulation thread is the only producer. The writer thread is normally the
+only consumer but the simulation thread also consumes the oldest record when
+the buffer is full and the overflow policy is "drop-oldest", hence the
+compare-and-swap on the positions.
+
+The threads only use the mutex to go to sleep. A thread that is about to sleep
+raises its "waiting" flag before checking the buffer a last time, and the other
+thread only takes the mutex to wake it up when that flag is raised. The waits
+are bounded so that a wake up missed because of that race only costs a
+millisecond.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstddef>
+
+#include "FGOutputWriter.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+static const chrono::milliseconds MaxWait(1);
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGOutputWriter::FGOutputWriter(function<void(const FGOutputRecord&)> emit,
+                               size_t capacity, eOverflow policy)
+  : Emit(emit), overflow(policy), enqueuePos(0), dequeuePos(0), dropped(0),
+    pending(0), writerWaiting(false), producerWaiting(false), stop(false)
+{
+  size_t size = 2;
+  while (size < capacity) size *= 2;
+
+  slots.reset(new Slot[size]);
+  mask = size - 1;
+  for (size_t i=0; i<size; i++)
+    slots[i].sequence.store(i, memory_order_relaxed);
+
+  thread = std::thread(&FGOutputWriter::Loop, this);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGOutputWriter::~FGOutputWriter()
+{
+  {
+    lock_guard<std::mutex> lock(mutex);
+    stop = true;
+  }
+  writerCondition.notify_one();
+  thread.join();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputWriter::GetOverflowPolicy(const string& name, eOverflow& policy)
+{
+  if (name == "block")
+    policy = ofBlock;
+  else if (name == "drop-oldest")
+    policy = ofDropOldest;
+  else if (name == "drop-newest")
+    policy = ofDropNewest;
+  else
+    return false;
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputWriter::TryPush(FGOutputRecord& record)
+{
+  size_t pos = enqueuePos.load(memory_order_relaxed);
+  Slot* slot;
+
+  for (;;) {
+    slot = &slots[pos & mask];
+    size_t seq = slot->sequence.load(memory_order_acquire);
+    ptrdiff_t diff = (ptrdiff_t)seq - (ptrdiff_t)pos;
+
+    if (diff == 0) {
+      if (enqueuePos.compare_exchange_weak(pos, pos+1, memory_order_relaxed))
+        break;
+    }
+    else if (diff < 0)
+      return false; // The buffer is full.
+    else
+      pos = enqueuePos.load(memory_order_relaxed);
+  }
+
+  swap(slot->record, record);
+  slot->sequence.store(pos+1, memory_order_release);
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputWriter::TryPop(FGOutputRecord& record)
+{
+  size_t pos = dequeuePos.load(memory_order_relaxed);
+  Slot* slot;
+
+  for (;;) {
+    slot = &slots[pos & mask];
+    size_t seq = slot->sequence.load(memory_order_acquire);
+    ptrdiff_t diff = (ptrdiff_t)seq - (ptrdiff_t)(pos+1);
+
+    if (diff == 0) {
+      if (dequeuePos.compare_exchange_weak(pos, pos+1, memory_order_relaxed))
+        break;
+    }
+    else if (diff < 0)
+      return false; // The buffer is empty.
+    else
+      pos = dequeuePos.load(memory_order_relaxed);
+  }
+
+  swap(record, slot->record);
+  slot->sequence.store(pos+mask+1, memory_order_release);
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputWriter::WakeUp(atomic<bool>& waiting, condition_variable& condition)
+{
+  if (waiting.load()) {
+    lock_guard<std::mutex> lock(mutex);
+    condition.notify_one();
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputWriter::Push(FGOutputRecord& record)
+{
+  pending++;
+
+  while (!TryPush(record)) {
+    switch(overflow) {
+    case ofDropNewest:
+      pending--;
+      dropped++;
+      return;
+    case ofDropOldest:
+      if (TryPop(discarded)) {
+        pending--;
+        dropped++;
+      }
+      break;
+    case ofBlock:
+      {
+        unique_lock<std::mutex> lock(mutex);
+        producerWaiting = true;
+        producerCondition.wait_for(lock, MaxWait);
+        producerWaiting = false;
+      }
+      break;
+    }
+  }
+
+  WakeUp(writerWaiting, writerCondition);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputWriter::Flush(void)
+{
+  unique_lock<std::mutex> lock(mutex);
+
+  while (pending > 0) {
+    producerWaiting = true;
+    producerCondition.wait_for(lock, MaxWait);
+  }
+  producerWaiting = false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputWriter::Loop(void)
+{
+  FGOutputRecord record;
+
+  for (;;) {
+    if (TryPop(record)) {
+      Emit(record);
+      pending--;
+      WakeUp(producerWaiting, producerCondition);
+      continue;
+    }
+
+    unique_lock<std::mutex> lock(mutex);
+    if (stop && pending == 0) break;
+
+    writerWaiting = true;
+    if (pending == 0) writerCondition.wait_for(lock, MaxWait);
+    writerWaiting = false;
+  }
+}
+}
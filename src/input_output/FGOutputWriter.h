@@ -0,0 +1,175 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGOutputWriter.h
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/2026   Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGOUTPUTWRITER_H
+#define FGOUTPUTWRITER_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** The values of one output step. The numbers are stored in values and the
+    texts (the values that the models only supply as strings) are stored in
+    texts along with the index of the value they precede in the output. */
+struct FGOutputRecord
+{
+  std::vector<double> values;
+  std::vector<std::string> texts;
+  std::vector<size_t> positions;
+
+  /// Appends a text after the values that have been added so far.
+  void AddText(const std::string& text) {
+    texts.push_back(text);
+    positions.push_back(values.size());
+  }
+
+  /// Removes the content of the record without releasing its memory.
+  void Clear(void) {
+    values.clear();
+    texts.clear();
+    positions.clear();
+  }
+};
+
+/** Emits output records from a background thread. The simulation thread
+    pushes the records in a bounded lock-free ring buffer and returns
+    immediately; the writer thread pops them and hands them over to the emit
+    function which formats the values and performs the I/O. A slow disk or a
+    stalled network peer therefore no longer stalls the simulation.
+
+    The records are swapped in and out of the ring buffer so that the memory
+    of their vectors is recycled and no allocation takes place once the buffer
+    has been filled.
+
+    When the ring buffer is full, the behavior depends on the overflow policy:
+    - ofBlock: the simulation thread waits until the writer thread frees a
+      slot. No record is lost.
+    - ofDropOldest: the oldest record in the buffer is discarded.
+    - ofDropNewest: the record being pushed is discarded.
+
+    The number of discarded records is returned by GetDroppedRecords().
+
+    @author The JSBSim team
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGOutputWriter
+{
+public:
+  enum eOverflow {ofBlock=0, ofDropOldest, ofDropNewest};
+
+  /** Constructor. Starts the writer thread.
+      @param emit the function called by the writer thread for each record.
+      @param capacity the number of records of the ring buffer. It is rounded
+                      up to the next power of 2.
+      @param overflow the policy applied when the ring buffer is full. */
+  FGOutputWriter(std::function<void(const FGOutputRecord&)> emit,
+                 size_t capacity, eOverflow overflow);
+
+  /// Destructor. Emits the pending records then stops the writer thread.
+  ~FGOutputWriter();
+
+  /** Queues a record. The content of the record is exchanged with the one of
+      a recycled record: the caller must clear it before reusing it. */
+  void Push(FGOutputRecord& record);
+
+  /// Waits until all the queued records have been emitted.
+  void Flush(void);
+
+  /// Returns the number of records discarded since the writer was created.
+  unsigned long GetDroppedRecords(void) const { return dropped; }
+  /// Returns the number of records waiting to be emitted.
+  unsigned long GetPendingRecords(void) const { return pending; }
+  size_t GetCapacity(void) const { return mask + 1; }
+  eOverflow GetOverflowPolicy(void) const { return overflow; }
+
+  /** Converts the name of an overflow policy ("block", "drop-oldest" or
+      "drop-newest") to its value.
+      @return false if the name is unknown. */
+  static bool GetOverflowPolicy(const std::string& name, eOverflow& policy);
+
+private:
+  struct Slot {
+    std::atomic<size_t> sequence;
+    FGOutputRecord record;
+  };
+
+  std::function<void(const FGOutputRecord&)> Emit;
+  std::unique_ptr<Slot[]> slots;
+  size_t mask;
+  eOverflow overflow;
+
+  std::atomic<size_t> enqueuePos;
+  std::atomic<size_t> dequeuePos;
+  std::atomic<unsigned long> dropped;
+  std::atomic<unsigned long> pending;
+  std::atomic<bool> writerWaiting;
+  std::atomic<bool> producerWaiting;
+  bool stop;
+
+  std::mutex mutex;
+  std::condition_variable writerCondition;
+  std::condition_variable producerCondition;
+  std::thread thread;
+  FGOutputRecord discarded;
+
+  bool TryPush(FGOutputRecord& record);
+  bool TryPop(FGOutputRecord& record);
+  void WakeUp(std::atomic<bool>& waiting, std::condition_variable& condition);
+  void Loop(void);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
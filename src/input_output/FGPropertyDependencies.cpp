@@ -0,0 +1,130 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGPropertyDependencies.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+ Purpose:      Detects the modifications of a set of properties
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/2026   Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGPropertyDependencies.h"
+#include "math/FGParameter.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+void FGPropertyDependencies::Track(const vector<FGPropertyNode*>& nodes)
+{
+  Inputs.clear();
+
+  for (auto node: nodes) {
+    bool found = false;
+
+    // A property may be read several times by the same function.
+    for (auto& input: Inputs) {
+      if (input.node == node) {
+        found = true;
+        break;
+      }
+    }
+
+    if (!found) {
+      Input input;
+      input.node = node;
+      input.version = 0;
+      input.value = 0.0;
+      Inputs.push_back(input);
+    }
+  }
+
+  State = eTracked;
+  Valid = false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropertyDependencies::Track(const FGParameter* param)
+{
+  vector<FGPropertyNode*> nodes;
+
+  if (param->GetDependencies(nodes))
+    Track(nodes);
+  else
+    Disable();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropertyDependencies::Disable(void)
+{
+  Inputs.clear();
+  State = eDisabled;
+  Valid = false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The recorded versions and values are refreshed while the inputs are checked
+// since the caller evaluates its value again as soon as a change is reported.
+// The version of a tied node is also checked since it is incremented when the
+// node is tied or untied.
+
+bool FGPropertyDependencies::Changed(void)
+{
+  if (State != eTracked) return true;
+
+  bool changed = !Valid;
+
+  for (auto& input: Inputs) {
+    FGPropertyNode* node = input.node;
+    unsigned int version = node->getVersion();
+
+    if (version != input.version) {
+      input.version = version;
+      changed = true;
+    }
+
+    if (node->isTied() || node->isAlias()) {
+      double value = node->getDoubleValue();
+      // NaN values are never equal and are therefore always reported as
+      // changed.
+      if (value != input.value) {
+        input.value = value;
+        changed = true;
+      }
+    }
+  }
+
+  Valid = true;
+  return changed;
+}
+}
@@ -0,0 +1,130 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGPropertyDependencies.h
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/2026   Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGPROPERTYDEPENDENCIES_H
+#define FGPROPERTYDEPENDENCIES_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <vector>
+
+#include "input_output/FGPropertyManager.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGParameter;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Detects the modifications of the properties that a value depends on.
+    This class is used to memoize the value of the functions and tables: as
+    long as none of the properties they read has changed, their last value can
+    be returned without evaluating them again.
+
+    The dependencies are collected by Track() using
+    FGParameter::GetDependencies(). Since the properties can be defined late,
+    the owner should call it once its value has been successfully evaluated.
+    The memoization is disabled if the dependencies cannot all be determined
+    (random numbers, templates, properties that do not exist, etc.).
+
+    The modifications of an untied property are detected by its version (see
+    SGPropertyNode::getVersion()) which is incremented each time a value is
+    written to it. The value of a tied property can be modified by its owner
+    behind the back of the property tree: its value is therefore read and
+    compared to the last value seen.
+
+    @author The JSBSim team
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGPropertyDependencies
+{
+public:
+  FGPropertyDependencies(void) : State(eUnresolved), Valid(false) {}
+
+  /** Tracks a list of property nodes.
+      @param nodes the property nodes to track. */
+  void Track(const std::vector<FGPropertyNode*>& nodes);
+
+  /** Tracks the dependencies of a parameter. The tracking is disabled if they
+      cannot be determined.
+      @param param the parameter which dependencies are tracked. */
+  void Track(const FGParameter* param);
+
+  /// Stops tracking the properties. Changed() will then always return true.
+  void Disable(void);
+
+  /// Returns true if the properties have already been tracked or disabled.
+  bool IsResolved(void) const { return State != eUnresolved; }
+
+  /// Returns true if the properties are tracked.
+  bool IsTracked(void) const { return State == eTracked; }
+
+  /** Checks whether one of the properties has changed since the previous
+      call. The first call following Track() always returns true, as well as
+      all the calls when the tracking is disabled. */
+  bool Changed(void);
+
+  /** Forces the next call to Changed() to return true. This must be called
+      when the evaluation of the value has failed after a change has been
+      reported. */
+  void Invalidate(void) { Valid = false; }
+
+  /// Returns the number of tracked property nodes.
+  size_t GetNumNodes(void) const { return Inputs.size(); }
+
+private:
+  struct Input {
+    FGPropertyNode_ptr node;
+    unsigned int version;
+    double value;
+  };
+
+  enum {eUnresolved, eTracked, eDisabled} State;
+  bool Valid;
+  std::vector<Input> Inputs;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
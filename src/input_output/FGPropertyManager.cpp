@@ -28,6 +28,9 @@
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <algorithm>
+#include <cmath>
+
 #include "FGPropertyManager.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -62,6 +65,128 @@ void FGPropertyManager::Unbind(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+int FGPropertyManager::GetHandle(const string& path, bool create)
+{
+  auto cached = handle_paths.find(path);
+  if (cached != handle_paths.end()) return cached->second;
+
+  FGPropertyNode* node = (FGPropertyNode*)root->getNode(path.c_str(), create);
+  if (!node) return -1;
+
+  // Different paths (relative or absolute, with or without index) can lead
+  // to the same node, which must get a single handle.
+  auto known = handle_nodes.find(node);
+  int handle;
+  if (known != handle_nodes.end())
+    handle = known->second;
+  else {
+    handle = static_cast<int>(handles.size());
+    handles.push_back(node);
+    handle_nodes[node] = handle;
+  }
+
+  handle_paths[path] = handle;
+  return handle;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropertyManager::CheckHandle(int handle) const
+{
+  if (handle < 0 || static_cast<size_t>(handle) >= handles.size())
+    throw("Invalid property handle " + to_string(handle));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropertyManager::GetValues(const vector<int>& h,
+                                  vector<double>& values) const
+{
+  values.resize(h.size());
+  for (size_t i=0; i<h.size(); ++i) {
+    CheckHandle(h[i]);
+    values[i] = handles[h[i]]->getDoubleValue();
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropertyManager::SetValues(const vector<int>& h,
+                                  const vector<double>& values)
+{
+  if (h.size() != values.size())
+    throw string("The numbers of handles and values differ");
+
+  // The handles are checked first so that no property is modified when one
+  // of them is not valid.
+  for (int handle: h)
+    CheckHandle(handle);
+  for (size_t i=0; i<h.size(); ++i)
+    handles[h[i]]->setDoubleValue(values[i]);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+vector<FGPropertyManager::WatchedProperty>::iterator
+FGPropertyManager::FindWatched(int handle)
+{
+  return lower_bound(watched.begin(), watched.end(), handle,
+                     [](const WatchedProperty& w, int h) {
+                       return w.handle < h;
+                     });
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropertyManager::Watch(int handle)
+{
+  CheckHandle(handle);
+
+  auto it = FindWatched(handle);
+  if (it != watched.end() && it->handle == handle) return;
+
+  watched.insert(it, {handle, handles[handle]->getDoubleValue()});
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropertyManager::Unwatch(int handle)
+{
+  auto it = FindWatched(handle);
+  if (it == watched.end() || it->handle != handle) return;
+
+  watched.erase(it);
+  if (HasChanged(handle)) {
+    changed[handle] = false;
+    changes.erase(find(changes.begin(), changes.end(), handle));
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropertyManager::UpdateJournal(void)
+{
+  for (int handle: changes)
+    changed[handle] = false;
+  changes.clear();
+  changed.resize(handles.size(), false);
+
+  for (WatchedProperty& w: watched) {
+    double value = handles[w.handle]->getDoubleValue();
+
+    // A NaN is different from itself: it would be reported at each frame.
+    if (value != w.value && !(std::isnan(value) && std::isnan(w.value))) {
+      w.value = value;
+      changes.push_back(w.handle);
+      changed[w.handle] = true;
+    }
+  }
+
+  ++journal_frame;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 string FGPropertyManager::mkPropertyName(string name, bool lowercase) {
 
   /* do this two pass to avoid problems with characters getting skipped
@@ -42,6 +42,7 @@ INCLUDES
 #endif
 
 #include <string>
+#include <unordered_map>
 #include "simgear/props/propertyObject.hxx"
 #if !PROPS_STANDALONE
 # include "simgear/math/SGMath.hxx"
@@ -374,10 +375,11 @@ class FGPropertyManager
 {
   public:
     /// Default constructor
-    FGPropertyManager(void) { root = new FGPropertyNode; }
+    FGPropertyManager(void) : journal_frame(0) { root = new FGPropertyNode; }
 
     /// Constructor
-    explicit FGPropertyManager(FGPropertyNode* _root) : root(_root) {};
+    explicit FGPropertyManager(FGPropertyNode* _root)
+      : root(_root), journal_frame(0) {};
 
     /// Destructor
     virtual ~FGPropertyManager(void) { Unbind(); }
@@ -685,9 +687,122 @@ class FGPropertyManager
     CreatePropertyObject(const std::string &path)
     { return simgear::PropertyObject<T>(root->GetNode(path, true)); }
 
+    ////////////////////////////////////////////////////////////////////////
+    // Access to the properties by handle.
+    ////////////////////////////////////////////////////////////////////////
+
+    /**
+     * Resolve a property path into a handle.
+     *
+     * The path is only resolved the first time it is requested: the handle
+     * is then found in a hash table, and the value is read or written
+     * directly through the node of the handle, without walking the property
+     * tree. A handle stays valid as long as the property manager exists, and
+     * all the paths that lead to the same node share the same handle.
+     *
+     * @param path The property path, relative to the root of the manager.
+     * @param create true to create the property if it does not exist.
+     * @return the handle or -1 if the property does not exist and could not
+     *         be created. No error message is printed.
+     */
+    int GetHandle(const std::string& path, bool create = false);
+
+    /// Returns the number of handles; the valid handles are 0 to this - 1.
+    size_t GetNumHandles(void) const { return handles.size(); }
+
+    /// Returns the node of a handle. The handle is not checked.
+    FGPropertyNode* GetHandleNode(int handle) const { return handles[handle]; }
+
+    /// Returns the value of the property of a handle which is not checked.
+    double GetValue(int handle) const
+    { return handles[handle]->getDoubleValue(); }
+
+    /// Sets the value of the property of a handle which is not checked.
+    void SetValue(int handle, double value)
+    { handles[handle]->setDoubleValue(value); }
+
+    /**
+     * Get the values of several properties at once.
+     *
+     * @param h The handles of the properties.
+     * @param values Receives the values, in the order of the handles.
+     * @throw std::string if a handle is not valid.
+     */
+    void GetValues(const std::vector<int>& h, std::vector<double>& values) const;
+
+    /**
+     * Set the values of several properties at once.
+     *
+     * @param h The handles of the properties.
+     * @param values The values, in the order of the handles.
+     * @throw std::string if a handle is not valid or the sizes differ.
+     */
+    void SetValues(const std::vector<int>& h, const std::vector<double>& values);
+
+    ////////////////////////////////////////////////////////////////////////
+    // Journal of the property changes.
+    ////////////////////////////////////////////////////////////////////////
+
+    /**
+     * Record the changes of a property in the journal.
+     *
+     * Most properties are tied to variables that the models modify directly
+     * rather than through the property tree, so the changes are detected by
+     * comparing the value of each watched property at the end of a frame
+     * with its value at the end of the previous frame. The consumers pull the
+     * changes once per frame with GetChanges() or HasChanged() instead of
+     * being notified of each write.
+     *
+     * @param handle The handle of the property. Watching a property twice
+     *               has no effect.
+     * @throw std::string if the handle is not valid.
+     */
+    void Watch(int handle);
+
+    /// Stops recording the changes of a property.
+    void Unwatch(int handle);
+
+    /// Returns the number of watched properties.
+    size_t GetNumWatched(void) const { return watched.size(); }
+
+    /**
+     * Update the journal with the changes since its previous update.
+     * FGFDMExec::Run() calls it at the end of each frame.
+     */
+    void UpdateJournal(void);
+
+    /// Returns the handles of the watched properties that changed during the
+    /// last frame, in increasing order.
+    const std::vector<int>& GetChanges(void) const { return changes; }
+
+    /// Returns true if the property of a handle changed during the last frame.
+    bool HasChanged(int handle) const {
+      return handle >= 0 && static_cast<size_t>(handle) < changed.size()
+        && changed[handle];
+    }
+
+    /// Returns the number of updates of the journal. A consumer can compare it
+    /// with its previous pull to detect the frames it has missed.
+    unsigned int GetJournalFrame(void) const { return journal_frame; }
+
   private:
     std::vector<SGPropertyNode_ptr> tied_properties;
     FGPropertyNode_ptr root;
+    std::vector<FGPropertyNode_ptr> handles;
+    std::unordered_map<std::string, int> handle_paths;
+    std::unordered_map<const FGPropertyNode*, int> handle_nodes;
+
+    struct WatchedProperty {
+      int handle;
+      double value; // At the end of the last frame
+    };
+    std::vector<WatchedProperty> watched; // Sorted by handle
+    std::vector<int> changes;
+    std::vector<bool> changed; // Indexed by handle
+    unsigned int journal_frame;
+
+    void CheckHandle(int handle) const;
+    std::vector<WatchedProperty>::iterator FindWatched(int handle);
 };
 }
 #endif // FGPROPERTYMANAGER_H
@@ -48,7 +48,7 @@ INCLUDES
 #include "FGScript.h"
 #include "FGFDMExec.h"
 #include "input_output/FGXMLElement.h"
-#include "input_output/FGXMLFileRead.h"
+#include "input_output/FGXMLDocumentCache.h"
 #include "initialization/FGInitialCondition.h"
 #include "models/FGInput.h"
 #include "math/FGCondition.h"
@@ -104,8 +104,7 @@ bool FGScript::LoadScript(const SGPath& script, double default_dT,
   double dt = 0.0, value = 0.0;
   FGCondition *newCondition;
 
-  FGXMLFileRead XMLFileRead;
-  Element* document = XMLFileRead.LoadXMLDocument(script);
+  Element_ptr document = FDMExec->GetDocumentCache()->Load(script);
 
   if (!document) {
     cerr << "File: " << script << " could not be loaded." << endl;
@@ -314,8 +313,9 @@ bool FGScript::LoadScript(const SGPath& script, double default_dT,
     set_element = event_element->FindElement("set");
     while (set_element) {
       prop_name = set_element->GetAttributeValue("name");
-      if (PropertyManager->HasNode(prop_name)) {
-        newEvent->SetParam.push_back( PropertyManager->GetNode(prop_name) );
+      int handle = PropertyManager->GetHandle(prop_name);
+      if (handle >= 0) {
+        newEvent->SetParam.push_back( PropertyManager->GetHandleNode(handle) );
       } else {
         newEvent->SetParam.push_back( 0L );
       }
@@ -328,7 +328,7 @@ bool FGScript::LoadScript(const SGPath& script, double default_dT,
         newEvent->Functions.push_back((FGFunction*)0L);
       } else if (set_element->FindElement("function")) {
         value = 0.0;
-        newEvent->Functions.push_back(new FGFunction(PropertyManager, set_element->FindElement("function")));
+        newEvent->Functions.push_back(new FGFunction(FDMExec, set_element->FindElement("function")));
       }
       newEvent->SetValue.push_back(value);
       newEvent->OriginalValue.push_back(0.0);
@@ -378,6 +378,22 @@ void FGScript::ResetEvents(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGScript::SerializeState(FGStateArchive& archive)
+{
+  archive.Sync(StartTime, EndTime);
+
+  archive.SyncCount(Events.size(), "events");
+  for (auto& thisEvent: Events) {
+    archive.Sync(thisEvent.Triggered, thisEvent.Notified, thisEvent.Delay,
+                 thisEvent.StartTime, thisEvent.TimeSpan);
+    archive.Sync(thisEvent.SetValue, thisEvent.newValue,
+                 thisEvent.OriginalValue, thisEvent.ValueSpan,
+                 thisEvent.Transiting);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGScript::RunScript(void)
 {
   unsigned i, j;
@@ -404,8 +420,9 @@ bool FGScript::RunScript(void)
         // The conditions are true, do the setting of the desired Event parameters
         for (i=0; i<thisEvent.SetValue.size(); i++) {
           if (thisEvent.SetParam[i] == 0L) { // Late bind property if necessary
-            if (PropertyManager->HasNode(thisEvent.SetParamName[i])) {
-              thisEvent.SetParam[i] = PropertyManager->GetNode(thisEvent.SetParamName[i]);
+            int handle = PropertyManager->GetHandle(thisEvent.SetParamName[i]);
+            if (handle >= 0) {
+              thisEvent.SetParam[i] = PropertyManager->GetHandleNode(handle);
             } else {
               throw("No property, \""+thisEvent.SetParamName[i]+"\" is defined.");
             }
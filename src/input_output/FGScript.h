@@ -43,6 +43,7 @@ INCLUDES
 #include "FGJSBBase.h"
 #include "FGPropertyReader.h"
 #include "input_output/FGPropertyManager.h"
+#include "input_output/FGStateArchive.h"
 #include "simgear/misc/sg_path.hxx"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -193,6 +194,10 @@ public:
 
   void ResetEvents(void);
 
+  /** Saves or restores the status of the events: whether they have been
+      triggered and the progress of the values they are setting. */
+  void SerializeState(FGStateArchive& archive);
+
 private:
   enum eAction {
     FG_RAMP  = 1,
@@ -0,0 +1,282 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGSharedMemory.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+ Purpose:      Shared memory segment protected by a seqlock
+ Called by:    FGOutputSharedMemory, FGInputSharedMemory
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+The segment is created with shm_open() and mmap() on POSIX systems and with
+CreateFileMapping() and MapViewOfFile() on Windows.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <new>
+
+#include "FGSharedMemory.h"
+#include "FGJSBBase.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+// Number of attempts made by Read() before giving up on a frame that keeps
+// being modified by the writer.
+static const int MaxReadAttempts = 100;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+const char FGSharedMemory::Magic[8] = {'J','S','B','S','I','M','S','M'};
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGSharedMemory::FGSharedMemory(void)
+  : Owner(false), Handle(nullptr), Size(0), NumValues(0), Header(nullptr),
+    Values(nullptr)
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGSharedMemory::~FGSharedMemory()
+{
+  Close();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGSharedMemory::Map(const string& name, size_t size, bool create)
+{
+#if defined(_MSC_VER) || defined(__MINGW32__)
+  HANDLE mapping;
+  if (create)
+    mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0,
+                                 (DWORD)size, name.c_str());
+  else
+    mapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, name.c_str());
+  if (!mapping) return false;
+
+  void* address = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+  if (!address) {
+    CloseHandle(mapping);
+    return false;
+  }
+
+  if (!create) {
+    MEMORY_BASIC_INFORMATION info;
+    VirtualQuery(address, &info, sizeof(info));
+    size = info.RegionSize;
+  }
+
+  Handle = mapping;
+#else
+  // POSIX requires the name of a shared memory object to begin with a slash.
+  string path = name[0] == '/' ? name : "/" + name;
+  int fd;
+
+  if (create) {
+    // The existing segment is unlinked rather than truncated so that the
+    // processes which still map it do not crash when accessing it.
+    shm_unlink(path.c_str());
+    fd = shm_open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0) return false;
+    if (ftruncate(fd, size) < 0) {
+      close(fd);
+      shm_unlink(path.c_str());
+      return false;
+    }
+  } else {
+    fd = shm_open(path.c_str(), O_RDWR, 0);
+    if (fd < 0) return false;
+    struct stat status;
+    if (fstat(fd, &status) < 0) {
+      close(fd);
+      return false;
+    }
+    size = status.st_size;
+  }
+
+  void* address = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (address == MAP_FAILED) {
+    if (create) shm_unlink(path.c_str());
+    return false;
+  }
+#endif
+
+  Name = name;
+  Owner = create;
+  Size = size;
+  Header = static_cast<SegmentHeader*>(address);
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGSharedMemory::Create(const string& name, const vector<string>& names)
+{
+  Close();
+
+  size_t offset = sizeof(SegmentHeader);
+  for (auto& n: names)
+    offset += n.size() + 1;
+  offset = (offset + 7) & ~size_t(7);
+
+  if (!Map(name, offset + names.size()*sizeof(double), true)) {
+    cerr << FGJSBBase::fgred << "Unable to create the shared memory segment "
+         << name << ": " << strerror(errno) << FGJSBBase::reset << endl;
+    return false;
+  }
+
+  char* base = reinterpret_cast<char*>(Header);
+  memset(base, 0, Size);
+  memcpy(Header->magic, Magic, sizeof(Magic));
+  Header->version = 1;
+  Header->offset = static_cast<uint32_t>(offset);
+  Header->count = static_cast<uint32_t>(names.size());
+  Header->reserved = 0;
+  new (&Header->sequence) atomic<uint64_t>(0);
+
+  char* name_ptr = base + sizeof(SegmentHeader);
+  for (auto& n: names) {
+    memcpy(name_ptr, n.c_str(), n.size() + 1);
+    name_ptr += n.size() + 1;
+  }
+
+  NumValues = names.size();
+  Names = names;
+  Values = reinterpret_cast<double*>(base + offset);
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGSharedMemory::Attach(const string& name)
+{
+  Close();
+
+  if (!Map(name, 0, false)) return false;
+
+  char* base = reinterpret_cast<char*>(Header);
+  if (Size < sizeof(SegmentHeader)
+      || memcmp(Header->magic, Magic, sizeof(Magic)) != 0
+      || Header->version != 1
+      || Header->offset < sizeof(SegmentHeader)
+      || Header->offset + Header->count*sizeof(double) > Size) {
+    Close();
+    return false;
+  }
+
+  const char* name_ptr = base + sizeof(SegmentHeader);
+  const char* end = base + Header->offset;
+  for (uint32_t i=0; i<Header->count && name_ptr < end; ++i) {
+    Names.push_back(string(name_ptr, strnlen(name_ptr, end - name_ptr)));
+    name_ptr += Names.back().size() + 1;
+  }
+
+  NumValues = Header->count;
+  Values = reinterpret_cast<double*>(base + Header->offset);
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSharedMemory::Close(void)
+{
+  if (!Header) return;
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+  // Windows removes the segment when the last handle to it is closed.
+  UnmapViewOfFile(Header);
+  CloseHandle(static_cast<HANDLE>(Handle));
+#else
+  munmap(Header, Size);
+  if (Owner)
+    shm_unlink((Name[0] == '/' ? Name : "/" + Name).c_str());
+#endif
+
+  Handle = nullptr;
+  Header = nullptr;
+  Values = nullptr;
+  Owner = false;
+  Size = 0;
+  NumValues = 0;
+  Names.clear();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+uint64_t FGSharedMemory::GetSequence(void) const
+{
+  return Header ? Header->sequence.load(memory_order_acquire) : 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSharedMemory::Write(const double* values)
+{
+  uint64_t sequence = Header->sequence.load(memory_order_relaxed);
+
+  Header->sequence.store(sequence + 1, memory_order_relaxed);
+  atomic_thread_fence(memory_order_release);
+  memcpy(Values, values, NumValues*sizeof(double));
+  Header->sequence.store(sequence + 2, memory_order_release);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGSharedMemory::Read(double* values, uint64_t& sequence) const
+{
+  for (int i=0; i<MaxReadAttempts; ++i) {
+    uint64_t before = Header->sequence.load(memory_order_acquire);
+    if (before == 0) return false;
+    if (before & 1) continue;
+
+    memcpy(values, Values, NumValues*sizeof(double));
+    atomic_thread_fence(memory_order_acquire);
+
+    if (Header->sequence.load(memory_order_relaxed) == before) {
+      sequence = before;
+      return true;
+    }
+  }
+
+  return false;
+}
+}
@@ -0,0 +1,159 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGSharedMemory.h
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/2026   Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGSHAREDMEMORY_H
+#define FGSHAREDMEMORY_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** A named shared memory segment holding a frame of double values. The
+    segment is meant to exchange data with processes running on the same host
+    without any copy nor system call per frame.
+
+    The layout of the segment is fixed when it is created. All the numbers are
+    in the native byte order of the host:
+
+    | Offset | Size    | Content                                            |
+    |--------|---------|----------------------------------------------------|
+    | 0      | 8       | The magic string "JSBSIMSM"                        |
+    | 8      | 4       | uint32: version of the layout (1)                  |
+    | 12     | 4       | uint32: offset of the values in bytes              |
+    | 16     | 4       | uint32: number of values N                         |
+    | 20     | 4       | uint32: reserved (0)                               |
+    | 24     | 8       | uint64: sequence number                            |
+    | 32     |         | N null terminated names, then padding up to a      |
+    |        |         | multiple of 8 bytes                                |
+    | offset | 8*N     | float64: the values                                |
+
+    The values are protected by a seqlock: the writer makes the sequence
+    number odd before it modifies the values and even again after. A reader
+    copies the values between two reads of the sequence number and discards
+    the copy if the sequence number was odd or has changed meanwhile. The
+    sequence number is 0 until the first frame has been written. Readers
+    therefore never block the writer.
+
+    On POSIX systems the segment is created with shm_open() so that it can be
+    found under /dev/shm on Linux. The segment is removed when the instance
+    that created it is destroyed.
+
+    @author The JSBSim team
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGSharedMemory
+{
+public:
+  /// Constructor
+  FGSharedMemory(void);
+  /// Destructor. Unmaps the segment and removes it if it has been created.
+  ~FGSharedMemory();
+
+  /** Creates a segment. An existing segment with the same name is replaced.
+      @param name the name of the segment.
+      @param names the names of the values.
+      @return false if the segment could not be created. */
+  bool Create(const std::string& name, const std::vector<std::string>& names);
+  /** Maps an existing segment.
+      @param name the name of the segment.
+      @return false if the segment does not exist or has an unknown layout. */
+  bool Attach(const std::string& name);
+  /// Unmaps the segment and removes it if it has been created.
+  void Close(void);
+
+  /// Returns true if a segment is mapped.
+  bool IsOpen(void) const { return Header != nullptr; }
+  /// Returns the number of values in the segment.
+  size_t GetNumValues(void) const { return NumValues; }
+  /// Returns the names of the values of the segment.
+  const std::vector<std::string>& GetNames(void) const { return Names; }
+  /// Returns the current sequence number of the segment.
+  uint64_t GetSequence(void) const;
+
+  /** Writes a frame. Only one process may write to a given segment.
+      @param values the GetNumValues() values of the frame. */
+  void Write(const double* values);
+  /** Reads the last frame.
+      @param values buffer that receives the GetNumValues() values.
+      @param sequence receives the sequence number of the frame read.
+      @return false if no consistent frame could be read because none has
+              been written yet or the writer kept modifying the values. */
+  bool Read(double* values, uint64_t& sequence) const;
+
+  /// The magic string at the beginning of the segments.
+  static const char Magic[8];
+
+private:
+  struct SegmentHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t offset;
+    uint32_t count;
+    uint32_t reserved;
+    std::atomic<uint64_t> sequence;
+  };
+
+  std::string Name;
+  bool Owner;
+  void* Handle;
+  size_t Size;
+  size_t NumValues;
+  SegmentHeader* Header;
+  double* Values;
+  std::vector<std::string> Names;
+
+  bool Map(const std::string& name, size_t size, bool create);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
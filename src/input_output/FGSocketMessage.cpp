@@ -0,0 +1,226 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGSocketMessage.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+ Purpose:      Encoder and decoder of the binary socket messages
+ Called by:    FGInputSocket, FGOutputSocket
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+
+#include "FGSocketMessage.h"
+#include "FGByteOrder.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+const uint32_t FGSocketMessage::InvalidId;
+const uint32_t FGSocketMessage::MaxSize;
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSocketMessageWriter::Start(MessageType type)
+{
+  Buffer.assign(4, '\0'); // The length is filled by Finish()
+  Buffer.push_back(static_cast<char>(type));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSocketMessageWriter::PutByte(uint8_t value)
+{
+  Buffer.push_back(static_cast<char>(value));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSocketMessageWriter::PutShort(uint16_t value)
+{
+  PutLittleEndian(Buffer, value);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSocketMessageWriter::PutInt(uint32_t value)
+{
+  PutLittleEndian(Buffer, value);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSocketMessageWriter::PutDouble(double value)
+{
+  PutLittleEndian(Buffer, value);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSocketMessageWriter::PutString(const string& value)
+{
+  size_t length = min(value.size(), size_t(0xffff));
+  PutLittleEndian(Buffer, static_cast<uint16_t>(length));
+  Buffer.append(value, 0, length);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSocketMessageWriter::PutValue(ValueType type, double value)
+{
+  PutByte(type);
+
+  switch (type) {
+  case vtFloat:
+    PutLittleEndian(Buffer, static_cast<float>(value));
+    break;
+  case vtInt:
+    PutLittleEndian(Buffer, static_cast<int32_t>(value));
+    break;
+  case vtBool:
+    PutByte(value != 0.0 ? 1 : 0);
+    break;
+  default:
+    PutLittleEndian(Buffer, value);
+    break;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+const string& FGSocketMessageWriter::Finish(void)
+{
+  string length;
+  PutLittleEndian(length, static_cast<uint32_t>(Buffer.size() - 4));
+  Buffer.replace(0, 4, length);
+  return Buffer;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGSocketMessageReader::Next(const string& stream, size_t& pos)
+{
+  Invalid = false;
+  if (pos + 4 > stream.size()) return false;
+
+  uint32_t length = GetLittleEndian<uint32_t>(stream.data() + pos);
+  if (length == 0 || length > MaxSize) {
+    Invalid = true;
+    return false;
+  }
+  if (stream.size() - pos - 4 < length) return false;
+
+  Ptr = stream.data() + pos + 4;
+  End = Ptr + length;
+  Type = static_cast<uint8_t>(*Ptr++);
+  Failed = false;
+  pos += 4 + length;
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+const char* FGSocketMessageReader::Take(size_t size)
+{
+  if (Failed || static_cast<size_t>(End - Ptr) < size) {
+    Failed = true;
+    return nullptr;
+  }
+
+  const char* data = Ptr;
+  Ptr += size;
+  return data;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+uint8_t FGSocketMessageReader::GetByte(void)
+{
+  const char* data = Take(1);
+  return data ? static_cast<uint8_t>(*data) : 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+uint16_t FGSocketMessageReader::GetShort(void)
+{
+  const char* data = Take(2);
+  return data ? GetLittleEndian<uint16_t>(data) : 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+uint32_t FGSocketMessageReader::GetInt(void)
+{
+  const char* data = Take(4);
+  return data ? GetLittleEndian<uint32_t>(data) : 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGSocketMessageReader::GetDouble(void)
+{
+  const char* data = Take(8);
+  return data ? GetLittleEndian<double>(data) : 0.0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+string FGSocketMessageReader::GetString(void)
+{
+  uint16_t length = GetShort();
+  const char* data = Take(length);
+  return data ? string(data, length) : string();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGSocketMessageReader::GetValue(ValueType& type)
+{
+  type = static_cast<ValueType>(GetByte());
+  const char* data;
+
+  switch (type) {
+  case vtDouble:
+    return GetDouble();
+  case vtFloat:
+    data = Take(4);
+    return data ? GetLittleEndian<float>(data) : 0.0;
+  case vtInt:
+    data = Take(4);
+    return data ? GetLittleEndian<int32_t>(data) : 0.0;
+  case vtBool:
+    return GetByte() != 0 ? 1.0 : 0.0;
+  default:
+    Failed = true;
+    return 0.0;
+  }
+}
+}
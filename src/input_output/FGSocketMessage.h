@@ -0,0 +1,193 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGSocketMessage.h
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/2026   Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGSOCKETMESSAGE_H
+#define FGSOCKETMESSAGE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdint>
+#include <string>
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** The binary protocol of the sockets (attribute format="BINARY" of the
+    SOCKET inputs and outputs).
+
+    Each message is framed by its length so that several messages can be sent
+    in a single packet and a message can span several packets:
+
+    | Size | Content                                                       |
+    |------|---------------------------------------------------------------|
+    | 4    | uint32: size of the rest of the message in bytes              |
+    | 1    | uint8: type of the message                                    |
+    |      | The content of the message                                    |
+
+    All the numbers are little-endian. A string is sent as a uint16 length
+    followed by its characters, and a value as a uint8 tag followed by the
+    value: 'd' (float64), 'f' (float32), 'i' (int32) or 'b' (uint8, 0 or 1).
+
+    The messages received by a SOCKET input are:
+
+    | Type         | Content                                                 |
+    |--------------|---------------------------------------------------------|
+    | mtRegister   | uint16 n, n property names. Answered by mtIds.          |
+    | mtSet        | uint16 n, n times uint32 id and value. Not answered.    |
+    | mtGet        | uint16 n, n uint32 ids. Answered by mtValues.           |
+    | mtHold       | Holds the simulation.                                   |
+    | mtResume     | Resumes the simulation.                                 |
+    | mtIterate    | uint32 n: runs n steps then holds the simulation.       |
+
+    and the messages that the input sends back are:
+
+    | Type         | Content                                                 |
+    |--------------|---------------------------------------------------------|
+    | mtIds        | uint16 n, n uint32 ids (0xFFFFFFFF for the names that   |
+    |              | are not leaf properties).                               |
+    | mtValues     | uint16 n, n values with the type of the properties.     |
+    | mtError      | A string describing why a message was rejected.         |
+
+    The ids are the handles of the property manager of the simulation. A
+    controller registers its properties once then exchanges mtSet and mtGet
+    messages, so the properties are never looked up by name again.
+
+    A SOCKET output sends an mtLabels message (uint16 n, n strings) when it is
+    initialized, then an mtData message (uint32 n, n float64) per output step
+    and mtStatus messages (a string) for the status of the simulation.
+
+    FGSocketMessageWriter builds the messages and FGSocketMessageReader splits
+    the received data into messages and decodes them.
+
+    @author The JSBSim team
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGSocketMessage
+{
+public:
+  enum MessageType : uint8_t {
+    mtRegister = 0x01, mtSet = 0x02, mtGet = 0x03, mtHold = 0x04,
+    mtResume = 0x05, mtIterate = 0x06,
+    mtLabels = 0x10, mtData = 0x11, mtStatus = 0x12,
+    mtError = 0x7f, mtIds = 0x81, mtValues = 0x83
+  };
+
+  enum ValueType : uint8_t {
+    vtDouble = 'd', vtFloat = 'f', vtInt = 'i', vtBool = 'b'
+  };
+
+  /// The id sent back for the names that could not be registered.
+  static const uint32_t InvalidId = 0xffffffff;
+  /// The maximum size of a message. Larger messages are rejected.
+  static const uint32_t MaxSize = 16*1024*1024;
+};
+
+/** Builds a message. */
+
+class FGSocketMessageWriter : public FGSocketMessage
+{
+public:
+  /// Starts a new message, discarding the previous one.
+  void Start(MessageType type);
+  void PutByte(uint8_t value);
+  void PutShort(uint16_t value);
+  void PutInt(uint32_t value);
+  void PutDouble(double value);
+  void PutString(const std::string& value);
+  /// Puts a tagged value converted to the type type.
+  void PutValue(ValueType type, double value);
+  /// Completes the length of the message and returns its bytes.
+  const std::string& Finish(void);
+
+private:
+  std::string Buffer;
+};
+
+/** Reads the messages out of a stream of bytes. The Get methods do not read
+    past the end of the message: they return 0 and set the failure flag
+    instead. */
+
+class FGSocketMessageReader : public FGSocketMessage
+{
+public:
+  FGSocketMessageReader(void)
+    : Type(0), Ptr(nullptr), End(nullptr), Failed(false), Invalid(false) {}
+
+  /** Selects the next message of a stream.
+      @param stream the bytes received so far. They must not be modified
+                    while the message is read.
+      @param pos the position of the message in the stream, moved to the next
+                 message when it is complete.
+      @return false if the stream does not contain a complete message, in
+              which case IsInvalid() tells if its length was not valid. */
+  bool Next(const std::string& stream, size_t& pos);
+
+  uint8_t GetType(void) const { return Type; }
+  uint8_t GetByte(void);
+  uint16_t GetShort(void);
+  uint32_t GetInt(void);
+  double GetDouble(void);
+  std::string GetString(void);
+  /// Reads a tagged value. Its type is returned in type.
+  double GetValue(ValueType& type);
+
+  /// Returns true if a Get method has read past the end of the message.
+  bool HasFailed(void) const { return Failed; }
+  /// Returns true if the length of the last message was not valid.
+  bool IsInvalid(void) const { return Invalid; }
+
+private:
+  uint8_t Type;
+  const char* Ptr;
+  const char* End;
+  bool Failed;
+  bool Invalid;
+
+  const char* Take(size_t size);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
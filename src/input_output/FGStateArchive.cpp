@@ -0,0 +1,170 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGStateArchive.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+ Purpose:      Binary blob of the state of a simulation
+ Called by:    FGFDMExec
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGStateArchive.h"
+#include "math/FGLocation.h"
+#include "math/FGQuaternion.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGStateArchive::FGStateArchive(void)
+  : Saving(true), Ptr(nullptr), End(nullptr)
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGStateArchive::FGStateArchive(const string& blob)
+  : Saving(false), Ptr(blob.data()), End(blob.data() + blob.size())
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+const char* FGStateArchive::Take(size_t size)
+{
+  if (static_cast<size_t>(End - Ptr) < size)
+    throw string("The state blob is truncated or does not match the simulation");
+
+  const char* data = Ptr;
+  Ptr += size;
+  return data;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStateArchive::Finish(void)
+{
+  if (!Saving && Ptr != End)
+    throw string("The state blob does not match the simulation: ")
+      + to_string(End - Ptr) + " bytes were not restored";
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStateArchive::SyncCount(size_t count, const char* what)
+{
+  size_t saved = count;
+  Sync(saved);
+
+  if (saved != count)
+    throw string("The state blob does not match the simulation: it holds ")
+      + to_string(saved) + " " + what + " instead of " + to_string(count);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStateArchive::Sync(FGColumnVector3& v)
+{
+  for (unsigned int i=1; i<=3; i++)
+    Sync(v(i));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStateArchive::Sync(FGMatrix33& m)
+{
+  for (unsigned int i=1; i<=3; i++)
+    for (unsigned int j=1; j<=3; j++)
+      Sync(m(i,j));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The non-const accessors of the quaternions and the locations invalidate their
+// cached values, which are computed again from the restored components.
+
+void FGStateArchive::Sync(FGQuaternion& q)
+{
+  for (unsigned int i=1; i<=4; i++) {
+    if (Saving) {
+      double value = static_cast<const FGQuaternion&>(q).Entry(i);
+      Sync(value);
+    }
+    else
+      Sync(q.Entry(i));
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStateArchive::Sync(FGLocation& l)
+{
+  for (unsigned int i=1; i<=3; i++) {
+    if (Saving) {
+      double value = static_cast<const FGLocation&>(l).Entry(i);
+      Sync(value);
+    }
+    else
+      Sync(l.Entry(i));
+  }
+
+  double epa = l.GetEPA();
+  Sync(epa);
+  if (!Saving) l.SetEarthPositionAngle(epa);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStateArchive::Sync(string& s)
+{
+  size_t size = s.size();
+  Sync(size);
+
+  if (Saving)
+    Blob.append(s);
+  else
+    s.assign(Take(size), size);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStateArchive::Sync(vector<bool>& v)
+{
+  size_t size = v.size();
+  Sync(size);
+  if (!Saving) {
+    if (size > static_cast<size_t>(End - Ptr)) Take(size);
+    v.resize(size);
+  }
+
+  for (size_t i=0; i<size; i++) {
+    bool value = v[i];
+    Sync(value);
+    v[i] = value;
+  }
+}
+}
@@ -0,0 +1,156 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGStateArchive.h
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/2026   Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGSTATEARCHIVE_H
+#define FGSTATEARCHIVE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstring>
+#include <deque>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGColumnVector3;
+class FGMatrix33;
+class FGQuaternion;
+class FGLocation;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Saves the state of a simulation into a binary blob or restores it.
+
+    The classes which hold a part of the state of the simulation implement a
+    SerializeState(FGStateArchive&) method which passes their state variables
+    to Sync(). The same method is used to save and to restore the state, so
+    that both always process the same variables in the same order: when the
+    archive is saving, Sync() appends the values to the blob and when it is
+    restoring, Sync() overwrites them with the values read from the blob.
+
+    The blob only holds the values, in the native byte order. It can only be
+    restored in a simulation with the same structure (the same aircraft,
+    engines, systems and script) run by the same build of JSBSim. The counts
+    passed to SyncCount() detect most of the mismatches.
+
+    @author The JSBSim team
+    @see FGFDMExec::SaveState, FGFDMExec::RestoreState
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGStateArchive
+{
+public:
+  /// Creates an archive which saves the state into a new blob.
+  FGStateArchive(void);
+  /** Creates an archive which restores the state from a blob. The blob is
+      not copied and must not be modified while the state is restored. */
+  explicit FGStateArchive(const std::string& blob);
+
+  bool IsSaving(void) const { return Saving; }
+  /// Returns the blob built by a saving archive.
+  const std::string& GetBlob(void) const { return Blob; }
+
+  /** Checks that the whole blob has been restored.
+      @throw std::string if there are bytes left. */
+  void Finish(void);
+
+  /// Saves or restores a value of a trivially copyable type.
+  template <typename T> void Sync(T& value) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "FGStateArchive::Sync needs a dedicated overload");
+    if (Saving)
+      Blob.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    else
+      memcpy(&value, Take(sizeof(T)), sizeof(T));
+  }
+
+  void Sync(FGColumnVector3& v);
+  void Sync(FGMatrix33& m);
+  void Sync(FGQuaternion& q);
+  void Sync(FGLocation& l);
+  void Sync(std::string& s);
+  void Sync(std::vector<bool>& v);
+
+  template <typename T> void Sync(std::vector<T>& v) { SyncSequence(v); }
+  template <typename T> void Sync(std::deque<T>& d) { SyncSequence(d); }
+
+  /// Saves or restores several values in turn.
+  template <typename T, typename U, typename... Others>
+  void Sync(T& first, U& second, Others&... others) {
+    Sync(first);
+    Sync(second, others...);
+  }
+
+  /** Saves a number of objects or checks that it matches the saved one.
+      @param count the number of objects in this simulation.
+      @param what the kind of the objects, for the error message.
+      @throw std::string if the numbers differ. */
+  void SyncCount(size_t count, const char* what);
+
+private:
+  bool Saving;
+  std::string Blob;
+  const char* Ptr;
+  const char* End;
+
+  const char* Take(size_t size);
+
+  template <typename Sequence> void SyncSequence(Sequence& s) {
+    size_t size = s.size();
+    Sync(size);
+    if (!Saving) {
+      // Each item takes at least one byte: reject the corrupted sizes.
+      if (size > static_cast<size_t>(End - Ptr)) Take(size);
+      s.resize(size);
+    }
+    for (auto& item: s)
+      Sync(item);
+  }
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -0,0 +1,357 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGUnitConverter.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+ Purpose:      Conversions of the units of the XML elements
+ Called by:    Element
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <cmath>
+
+#include "FGUnitConverter.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace {
+
+/* Packs up to 8 characters in an integer, the first one in the most
+   significant byte. The packed names compare in the order of strcmp. */
+constexpr uint64_t Pack(const char* s, unsigned int i = 0)
+{
+  return (i == 8 || *s == '\0') ? 0
+    : (uint64_t(uint8_t(*s)) << (56 - 8*i)) | Pack(s+1, i+1);
+}
+
+constexpr const char* Skip(const char* s, unsigned int n)
+{
+  return (n == 0 || *s == '\0') ? s : Skip(s+1, n-1);
+}
+
+constexpr size_t Length(const char* s)
+{
+  return *s == '\0' ? 0 : 1 + Length(s+1);
+}
+
+template <typename T, size_t N>
+constexpr size_t Count(const T (&)[N]) { return N; }
+
+template <typename UnitInfo>
+constexpr bool IsLess(const UnitInfo& a, const UnitInfo& b)
+{
+  return a.high < b.high || (a.high == b.high && a.low < b.low);
+}
+
+template <typename UnitInfo>
+constexpr bool AreSorted(const UnitInfo* units, size_t n, size_t max_length)
+{
+  return n == 0 || (Length(units[0].name) <= max_length
+                    && (n == 1 || IsLess(units[0], units[1]))
+                    && AreSorted(units+1, n-1, max_length));
+}
+
+template <typename Conversion>
+constexpr bool AreSortedAndDistinct(const Conversion* c, size_t n)
+{
+  return n < 2 || ((c[0].from < c[1].from
+                    || (c[0].from == c[1].from && c[0].to < c[1].to))
+                   && AreSortedAndDistinct(c+1, n-1));
+}
+
+template <typename Conversion, typename UnitInfo>
+constexpr bool HaveDimensions(const Conversion* c, size_t n,
+                              const UnitInfo* units)
+{
+  return n == 0 || (c->from != c->to
+                    && (units[c->from].dimensions & units[c->to].dimensions)
+                    && HaveDimensions(c+1, n-1, units));
+}
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+constexpr FGUnitConverter::UnitInfo::UnitInfo(const char* _name,
+                                              uint32_t _dimensions)
+  : name(_name), dimensions(_dimensions), high(Pack(_name)),
+    low(Pack(Skip(_name, 8)))
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+// The names must be sorted in the order of strcmp, which is the order of the
+// enumerators of FGUnitConverter::Unit.
+constexpr FGUnitConverter::UnitInfo FGUnitConverter::Units[] = {
+  {"ATM", dmPressure},
+  {"CC", dmVolume},
+  {"CM", dmLength},
+  {"CM2", dmArea},
+  {"DEG", dmAngle},
+  {"DEG/SEC", dmAngularRate},
+  {"FT", dmLength},
+  {"FT*LBS", dmTorque},
+  {"FT/S", dmVelocity},
+  {"FT/SEC", dmVelocity},
+  {"FT2", dmArea},
+  {"FT3", dmVolume},
+  {"FT4*SEC/SLUG", dmValveCoefficient},
+  {"HP", dmPower},
+  {"IN", dmLength},
+  {"IN2", dmArea},
+  {"IN3", dmVolume},
+  {"INHG", dmPressure},
+  {"KG", dmMass},
+  {"KG*M2", dmMomentOfInertia},
+  {"KG/KW*HR", dmFuelConsumption},
+  {"KG/L", dmDensity},
+  {"KG/MIN", dmMassFlow},
+  {"KM", dmLength},
+  {"KM/SEC", dmVelocity},
+  {"KTS", dmVelocity},
+  {"LBS", dmMass | dmForce},
+  {"LBS/FT", dmSpringCoefficient},
+  {"LBS/FT/SEC", dmDampingCoefficient},
+  {"LBS/FT2", dmPressure},
+  {"LBS/FT2/SEC2", dmSquareDampingCoefficient},
+  {"LBS/GAL", dmDensity},
+  {"LBS/HP*HR", dmFuelConsumption},
+  {"LBS/MIN", dmMassFlow},
+  {"LBS/SEC", dmMassFlow},
+  {"LTR", dmVolume},
+  {"M", dmLength},
+  {"M/S", dmVelocity},
+  {"M/SEC", dmVelocity},
+  {"M2", dmArea},
+  {"M3", dmVolume},
+  {"M4*SEC/KG", dmValveCoefficient},
+  {"N", dmForce},
+  {"N*M", dmTorque},
+  {"N/M", dmSpringCoefficient},
+  {"N/M/SEC", dmDampingCoefficient},
+  {"N/M2", dmPressure},
+  {"N/M2/SEC2", dmSquareDampingCoefficient},
+  {"N/SEC", dmMassFlow},
+  {"PA", dmPressure},
+  {"PSF", dmPressure},
+  {"PSI", dmPressure},
+  {"RAD", dmAngle},
+  {"RAD/SEC", dmAngularRate},
+  {"SLUG", dmMass},
+  {"SLUG*FT2", dmMomentOfInertia},
+  {"WATTS", dmPower}
+};
+
+// The conversions, sorted by their source then target units. The derived
+// factors are written as expressions of the base factors rather than as their
+// values, so that they are rounded exactly as they have always been. A unit is
+// converted into itself without looking at this table.
+constexpr FGUnitConverter::Conversion FGUnitConverter::Conversions[] = {
+  {uATM, uINHG, 29.9246899},
+  {uCC, uIN3, 1.0/16.387064},
+  {uCM, uFT, 0.032808399},
+  {uCM2, uFT2, 0.032808399*0.032808399},
+  {uDEG, uRAD, 1.0/(180.0/M_PI)},
+  {uDEG_SEC, uRAD_SEC, 1.0/(180.0/M_PI)},
+  {uFT, uCM, 1.0/0.032808399},
+  {uFT, uIN, 12.0},
+  {uFT, uKM, 1.0/3280.8399},
+  {uFT, uM, 1.0/3.2808399},
+  {uFTxLBS, uNxM, 1.35581795},
+  {uFT_S, uM_S, 1.0/3.2808399},
+  {uFT_SEC, uKM_SEC, 1.0/3280.8399},
+  {uFT_SEC, uKTS, 1.0/1.68781},
+  {uFT_SEC, uM_SEC, 1.0/3.2808399},
+  {uFT2, uCM2, 1.0/(0.032808399*0.032808399)},
+  {uFT2, uIN2, 144.0},
+  {uFT2, uM2, 1.0/(3.2808399*3.2808399)},
+  {uFT3, uIN3, 1728.0},
+  {uFT3, uM3, 1.0/35.3146667},
+  {uFT4xSEC_SLUG, uM4xSEC_KG,
+   1.0/(3.2808399*3.2808399*3.2808399*3.2808399/(1.0/14.59390))},
+  {uHP, uWATTS, 1.0/0.001341022},
+  {uIN, uFT, 1.0/12.0},
+  {uIN, uM, (1.0/12.0)*(1.0/3.2808399)},
+  {uIN2, uFT2, 1.0/144.0},
+  {uIN2, uM2, 1.0/((3.2808399*12.0)*(3.2808399*12.0))},
+  {uIN3, uCC, 16.387064},
+  {uIN3, uFT3, 1.0/1728.0},
+  {uIN3, uLTR, 1.0/61.0237441},
+  {uINHG, uATM, 1.0/29.9246899},
+  {uINHG, uPA, 3386.0},
+  {uINHG, uPSF, 70.7180803},
+  {uINHG, uPSI, 1.0/2.03625437},
+  {uKG, uLBS, 1.0/0.45359237},
+  {uKG, uSLUG, 1.0/14.59390},
+  {uKGxM2, uSLUGxFT2, 1.0/1.35594},
+  {uKG_KWxHR, uLBS_HPxHR, 1.0/0.6083},
+  {uKG_L, uLBS_GAL, 8.3454045},
+  {uKG_MIN, uLBS_MIN, 1.0/0.45359237},
+  {uKM, uFT, 3280.8399},
+  {uKM_SEC, uFT_SEC, 3280.8399},
+  {uKTS, uFT_SEC, 1.68781},
+  {uLBS, uKG, 0.45359237},
+  {uLBS, uN, 1.0/0.22482},
+  {uLBS_FT, uN_M, 14.5939},
+  {uLBS_FT_SEC, uN_M_SEC, 14.5939},
+  {uLBS_FT2, uN_M2, 14.5939/(1.0/3.2808399)},
+  {uLBS_FT2, uPA, 14.5939/(1.0/3.2808399)},
+  {uLBS_FT2_SEC2, uN_M2_SEC2, 47.880259},
+  {uLBS_GAL, uKG_L, 1.0/8.3454045},
+  {uLBS_HPxHR, uKG_KWxHR, 0.6083},
+  {uLBS_SEC, uN_SEC, 1.0/0.224808943},
+  {uLTR, uIN3, 61.0237441},
+  {uM, uFT, 3.2808399},
+  {uM, uIN, 3.2808399*12.0},
+  {uM_S, uFT_S, 3.2808399},
+  {uM_S, uKTS, 3.2808399/1.68781},
+  {uM_SEC, uFT_SEC, 3.2808399},
+  {uM2, uFT2, 3.2808399*3.2808399},
+  {uM2, uIN2, (3.2808399*12.0)*(3.2808399*12.0)},
+  {uM3, uFT3, 35.3146667},
+  {uM4xSEC_KG, uFT4xSEC_SLUG,
+   3.2808399*3.2808399*3.2808399*3.2808399/(1.0/14.59390)},
+  {uN, uLBS, 0.22482},
+  {uNxM, uFTxLBS, 1.0/1.35581795},
+  {uN_M, uLBS_FT, 1.0/14.5939},
+  {uN_M_SEC, uLBS_FT_SEC, 1.0/14.5939},
+  {uN_M2, uLBS_FT2, 1.0/(14.5939/(1.0/3.2808399))},
+  {uN_M2_SEC2, uLBS_FT2_SEC2, 1.0/47.880259},
+  {uN_SEC, uLBS_SEC, 0.224808943},
+  {uPA, uINHG, 1.0/3386.0},
+  {uPA, uLBS_FT2, 1.0/(14.5939/(1.0/3.2808399))},
+  {uPSF, uINHG, 1.0/70.7180803},
+  {uPSI, uINHG, 2.03625437},
+  {uRAD, uDEG, 180.0/M_PI},
+  {uRAD_SEC, uDEG_SEC, 180.0/M_PI},
+  {uSLUG, uKG, 14.59390},
+  {uSLUGxFT2, uKGxM2, 1.35594},
+  {uWATTS, uHP, 0.001341022}
+};
+namespace {
+
+const char* DimensionNames[] = {
+  "length", "area", "volume", "mass", "moment of inertia", "angle",
+  "angular rate", "spring coefficient", "damping coefficient",
+  "square damping coefficient", "power", "force", "velocity", "torque",
+  "valve coefficient", "pressure", "mass flow", "fuel consumption", "density"
+};
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGUnitConverter::Unit FGUnitConverter::GetUnit(const string& name)
+{
+  static_assert(Count(Units) == NumUnits,
+                "A unit is missing from FGUnitConverter::Units");
+  static_assert(AreSorted(Units, Count(Units), MaxNameLength),
+                "FGUnitConverter::Units is not sorted or a name is too long");
+
+  if (name.size() > MaxNameLength) return uUnknown;
+
+  const UnitInfo key(name.c_str(), 0);
+  const UnitInfo* end = Units + NumUnits;
+  const UnitInfo* unit = lower_bound(Units, end, key, IsLess<UnitInfo>);
+
+  // The packed names ignore the characters after a null character.
+  if (unit == end || unit->high != key.high || unit->low != key.low
+      || name.size() != Length(unit->name))
+    return uUnknown;
+
+  return static_cast<Unit>(unit - Units);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+const char* FGUnitConverter::GetName(Unit unit)
+{
+  if (unit < 0 || unit >= NumUnits) return "";
+
+  return Units[unit].name;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+uint32_t FGUnitConverter::GetDimensions(Unit unit)
+{
+  if (unit < 0 || unit >= NumUnits) return 0;
+
+  return Units[unit].dimensions;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+string FGUnitConverter::GetDimensionNames(uint32_t dimensions)
+{
+  string names;
+
+  for (size_t i=0; i<Count(DimensionNames); i++) {
+    if (dimensions & (1u << i)) {
+      if (!names.empty()) names += " or ";
+      names += DimensionNames[i];
+    }
+  }
+
+  return names;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGUnitConverter::GetFactor(Unit from, Unit to, double& factor)
+{
+  static_assert(AreSortedAndDistinct(Conversions, Count(Conversions)),
+                "FGUnitConverter::Conversions is not sorted");
+  static_assert(HaveDimensions(Conversions, Count(Conversions), Units),
+                "A conversion of FGUnitConverter::Conversions is between "
+                "units which do not share a dimension");
+
+  if (from < 0 || from >= NumUnits || to < 0 || to >= NumUnits) return false;
+
+  if (from == to) {
+    factor = 1.0;
+    return true;
+  }
+
+  const Conversion* end = Conversions + Count(Conversions);
+  const Conversion* conversion =
+    lower_bound(Conversions, end, make_pair(from, to),
+                [](const Conversion& c, const pair<Unit, Unit>& units) {
+                  return c.from < units.first
+                    || (c.from == units.first && c.to < units.second);
+                });
+
+  if (conversion == end || conversion->from != from || conversion->to != to)
+    return false;
+
+  factor = conversion->factor;
+  return true;
+}
+}
@@ -0,0 +1,190 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGUnitConverter.h
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/2026   Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGUNITCONVERTER_H
+#define FGUNITCONVERTER_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdint>
+#include <string>
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** The units of the unit attribute of the XML elements and the factors which
+    convert them into each other.
+
+    The units and the conversions are stored in constant tables which are
+    built and checked at compile time. The names of the units are packed in
+    integers, so that a unit name is parsed by a bisection which compares
+    integers rather than strings, and a factor is found by a bisection on the
+    pairs of units. Nothing is initialized at run time. Each unit belongs to
+    one or more dimensions (LBS is both a mass and a force) and a conversion
+    is only defined between units which share a dimension. A unit can always
+    be converted into itself. The conversions are:
+
+    | Dimension                  | Units                                      |
+    |----------------------------|--------------------------------------------|
+    | Length                     | M, FT, CM, KM, IN                          |
+    | Area                       | M2, FT2, CM2, IN2                          |
+    | Volume                     | IN3, CC, FT3, M3, LTR                      |
+    | Mass                       | LBS, KG, SLUG                              |
+    | Moment of inertia          | SLUG*FT2, KG*M2                            |
+    | Angle                      | RAD, DEG                                   |
+    | Angular rate               | RAD/SEC, DEG/SEC                           |
+    | Spring coefficient         | LBS/FT, N/M                                |
+    | Damping coefficient        | LBS/FT/SEC, N/M/SEC                        |
+    | Square damping coefficient | LBS/FT2/SEC2, N/M2/SEC2                    |
+    | Power                      | WATTS, HP                                  |
+    | Force                      | N, LBS                                     |
+    | Velocity                   | KTS, FT/SEC, M/S, FT/S, M/SEC, KM/SEC      |
+    | Torque                     | FT*LBS, N*M                                |
+    | Valve coefficient          | M4*SEC/KG, FT4*SEC/SLUG                    |
+    | Pressure                   | INHG, PSF, ATM, PSI, PA, LBS/FT2, N/M2     |
+    | Mass flow                  | KG/MIN, LBS/MIN, LBS/SEC, N/SEC            |
+    | Fuel consumption           | LBS/HP*HR, KG/KW*HR                        |
+    | Density                    | KG/L, LBS/GAL                              |
+
+    Not all the pairs of units of a dimension can be converted: CM can be
+    converted to FT but not to M for instance. See the table in
+    FGUnitConverter.cpp for the list of the conversions.
+
+    Where:
+    - N = newtons
+    - M = meters
+    - M2 = meters squared
+    - KG = kilograms
+    - LBS = pounds force
+    - FT = feet
+    - FT2 = feet squared
+    - SEC = seconds
+    - MIN = minutes
+    - SLUG = slug
+    - DEG = degrees
+    - RAD = radians
+    - WATTS = watts
+    - HP = horsepower
+    - HR = hour
+    - L = liter
+    - GAL = gallon (U.S. liquid)
+
+    @author The JSBSim team
+    @see Element::FindElementValueAsNumberConvertTo
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGUnitConverter
+{
+public:
+  /** The units, in the alphabetical order of their names. In the names of the
+      enumerators, "*" is spelled x and "/" is spelled _: uFTxLBS is FT*LBS
+      and uLBS_FT is LBS/FT. */
+  enum Unit : int8_t {
+    uUnknown = -1,
+    uATM, uCC, uCM, uCM2, uDEG, uDEG_SEC, uFT, uFTxLBS, uFT_S, uFT_SEC, uFT2,
+    uFT3, uFT4xSEC_SLUG, uHP, uIN, uIN2, uIN3, uINHG, uKG, uKGxM2, uKG_KWxHR,
+    uKG_L, uKG_MIN, uKM, uKM_SEC, uKTS, uLBS, uLBS_FT, uLBS_FT_SEC, uLBS_FT2,
+    uLBS_FT2_SEC2, uLBS_GAL, uLBS_HPxHR, uLBS_MIN, uLBS_SEC, uLTR, uM, uM_S,
+    uM_SEC, uM2, uM3, uM4xSEC_KG, uN, uNxM, uN_M, uN_M_SEC, uN_M2, uN_M2_SEC2,
+    uN_SEC, uPA, uPSF, uPSI, uRAD, uRAD_SEC, uSLUG, uSLUGxFT2, uWATTS,
+    NumUnits
+  };
+
+  /// The dimensions of the units, combined as bit flags.
+  enum Dimension : uint32_t {
+    dmLength = 1 << 0, dmArea = 1 << 1, dmVolume = 1 << 2, dmMass = 1 << 3,
+    dmMomentOfInertia = 1 << 4, dmAngle = 1 << 5, dmAngularRate = 1 << 6,
+    dmSpringCoefficient = 1 << 7, dmDampingCoefficient = 1 << 8,
+    dmSquareDampingCoefficient = 1 << 9, dmPower = 1 << 10, dmForce = 1 << 11,
+    dmVelocity = 1 << 12, dmTorque = 1 << 13, dmValveCoefficient = 1 << 14,
+    dmPressure = 1 << 15, dmMassFlow = 1 << 16, dmFuelConsumption = 1 << 17,
+    dmDensity = 1 << 18
+  };
+
+  /** Parses a unit name such as "LBS/FT2".
+      @return the unit or uUnknown if the name is not a known unit. */
+  static Unit GetUnit(const std::string& name);
+  /// Returns the name of a unit.
+  static const char* GetName(Unit unit);
+  /// Returns the dimensions of a unit, or 0 for uUnknown.
+  static uint32_t GetDimensions(Unit unit);
+  /** Returns the names of the dimensions, for the error messages.
+      @param dimensions a combination of Dimension flags.
+      @return the names, separated by " or ". */
+  static std::string GetDimensionNames(uint32_t dimensions);
+
+  /** Gets the factor which converts a value from a unit to another one:
+      value_in_to = value_in_from * factor.
+      @return false if the conversion is not defined. */
+  static bool GetFactor(Unit from, Unit to, double& factor);
+
+private:
+  /// The longest name of a unit.
+  static const size_t MaxNameLength = 16;
+
+  struct UnitInfo {
+    constexpr UnitInfo(const char* _name, uint32_t _dimensions);
+
+    const char* name;
+    uint32_t dimensions;
+    /// The name packed in two integers which compare as the names.
+    uint64_t high, low;
+  };
+
+  struct Conversion {
+    Unit from;
+    Unit to;
+    double factor;
+  };
+
+  /// The units, indexed by Unit.
+  static const UnitInfo Units[];
+  /// The conversions, sorted by their units.
+  static const Conversion Conversions[];
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -0,0 +1,274 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGXMLDocumentCache.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+ Purpose:      Cache of the parsed XML documents
+ Called by:    FGFDMExec
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <sstream>
+
+#include "FGXMLDocumentCache.h"
+#include "FGXMLParse.h"
+#include "FGStateArchive.h"
+#include "simgear/io/iostreams/sgstream.hxx"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+LOCAL DATA AND FUNCTIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace {
+
+const char* CacheFileMagic = "JSBSim XML document cache";
+// Must be incremented when the content of the cache files changes.
+const uint32_t CacheFileVersion = 1;
+
+// 64 bits FNV-1a hash.
+uint64_t Hash(const string& data)
+{
+  uint64_t hash = 14695981039346656037ULL;
+
+  for (unsigned char c: data) {
+    hash ^= c;
+    hash *= 1099511628211ULL;
+  }
+
+  return hash;
+}
+
+bool ReadBytes(const SGPath& filename, string& data)
+{
+  sg_ifstream file(filename);
+  if (!file.is_open()) return false;
+
+  ostringstream buffer;
+  buffer << file.rdbuf();
+  data = buffer.str();
+  return true;
+}
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+shared_ptr<FGXMLDocumentCache> FGXMLDocumentCache::GetShared(void)
+{
+  static mutex SharedMutex;
+  static weak_ptr<FGXMLDocumentCache> SharedCache;
+
+  lock_guard<mutex> lock(SharedMutex);
+  shared_ptr<FGXMLDocumentCache> cache = SharedCache.lock();
+
+  if (!cache) {
+    cache = make_shared<FGXMLDocumentCache>();
+    SharedCache = cache;
+  }
+
+  return cache;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Element_ptr FGXMLDocumentCache::Load(const SGPath& path, bool verbose)
+{
+  SGPath filename(path);
+
+  if (filename.isNull()) {
+    cerr << "No filename given." << endl;
+    return nullptr;
+  }
+
+  if (filename.extension().empty())
+    filename.concat(".xml");
+
+  string key = filename.utf8Str();
+  Document document;
+  filename.set_cached(true);
+  document.modTime = filename.modTime();
+  document.size = filename.sizeInBytes();
+
+  // The reference count of the elements is not atomic: the roots of the
+  // documents in the cache are only copied and released with the lock held.
+  {
+    lock_guard<mutex> lock(Mutex);
+    auto it = Documents.find(key);
+    if (it != Documents.end()) {
+      if (it->second.modTime == document.modTime
+          && it->second.size == document.size)
+        return it->second.root->Clone();
+      Documents.erase(it);
+    }
+  }
+
+  // The file is read and parsed without holding the lock. If another thread
+  // loads the same file meanwhile, the last document read is kept.
+  string data;
+  if (!ReadBytes(filename, data)) {
+    if (verbose) cerr << "Could not open file: " << filename << endl;
+    return nullptr;
+  }
+
+  document.hash = Hash(data);
+
+  {
+    lock_guard<mutex> lock(Mutex);
+    auto it = Precompiled.find(key);
+    if (it != Precompiled.end() && it->second.hash == document.hash) {
+      Document& cached = Documents[key];
+      cached = document;
+      cached.root = it->second.root;
+      return cached.root->Clone();
+    }
+  }
+
+  // The parsed document is not shared until it is moved to the cache.
+  {
+    FGXMLParse parser;
+    istringstream input(data);
+    readXML(input, parser, key);
+    document.root = parser.GetDocument();
+  }
+
+  lock_guard<mutex> lock(Mutex);
+  Document& cached = Documents[key];
+  cached = document;
+  document.root = nullptr;
+  NumParsed++;
+  return cached.root->Clone();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGXMLDocumentCache::GetNumDocuments(void) const
+{
+  lock_guard<mutex> lock(Mutex);
+  return Documents.size();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGXMLDocumentCache::GetNumParsed(void) const
+{
+  lock_guard<mutex> lock(Mutex);
+  return NumParsed;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGXMLDocumentCache::Clear(void)
+{
+  lock_guard<mutex> lock(Mutex);
+  Documents.clear();
+  Precompiled.clear();
+  NumParsed = 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// A cache file holds a header followed by the documents. The header is made of
+// a magic string, the version of the file format and a hash of the documents,
+// which is checked before they are decoded.
+
+bool FGXMLDocumentCache::ReadFile(const SGPath& filename)
+{
+  string data;
+  if (!ReadBytes(filename, data)) return false;
+
+  map<string, Document> documents;
+
+  try {
+    FGStateArchive header(data);
+    string magic, content;
+    uint32_t version = 0;
+    uint64_t hash = 0;
+    header.Sync(magic);
+    if (magic != CacheFileMagic) return false;
+    header.Sync(version, hash, content);
+    header.Finish();
+    if (version != CacheFileVersion || hash != Hash(content)) return false;
+
+    FGStateArchive archive(content);
+    size_t ndocuments = 0;
+    archive.Sync(ndocuments);
+    for (size_t i=0; i<ndocuments; i++) {
+      string key;
+      Document document;
+      document.root = new Element("");
+      archive.Sync(key, document.hash);
+      document.root->Serialize(archive);
+      documents[key] = document;
+    }
+    archive.Finish();
+  } catch (const string&) {
+    return false;
+  }
+
+  // The former documents may be shared with the cache: they are released with
+  // the lock held.
+  lock_guard<mutex> lock(Mutex);
+  Precompiled.swap(documents);
+  documents.clear();
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGXMLDocumentCache::WriteFile(const SGPath& filename) const
+{
+  FGStateArchive archive;
+
+  {
+    lock_guard<mutex> lock(Mutex);
+    size_t ndocuments = Documents.size();
+    archive.Sync(ndocuments);
+    for (auto& item: Documents) {
+      string key = item.first;
+      uint64_t hash = item.second.hash;
+      archive.Sync(key, hash);
+      item.second.root->Serialize(archive);
+    }
+  }
+
+  FGStateArchive header;
+  string magic = CacheFileMagic;
+  string content = archive.GetBlob();
+  uint32_t version = CacheFileVersion;
+  uint64_t hash = Hash(content);
+  header.Sync(magic, version, hash, content);
+
+  sg_ofstream file(filename);
+  if (!file.is_open()) return false;
+
+  const string& blob = header.GetBlob();
+  file.write(blob.data(), blob.size());
+  file.close();
+  return !file.fail();
+}
+}
@@ -0,0 +1,151 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGXMLDocumentCache.h
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/2026   Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGXMLDOCUMENTCACHE_H
+#define FGXMLDOCUMENTCACHE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdint>
+#include <ctime>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "FGXMLElement.h"
+#include "simgear/misc/sg_path.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Keeps the XML documents read by the executives so that they are only
+    parsed once.
+
+    The models modify the documents while they are loaded: the included files
+    are attached to the elements which include them and some attributes are
+    renamed. The cache therefore keeps the documents as they were parsed and
+    returns a copy of them, which the caller may modify freely. Copying a
+    document is much faster than reading and parsing its file again.
+
+    By default all the executives of a process, including the child FDMs and
+    the clones, share the cache returned by GetShared(): an engine or a system
+    file is parsed once, however many engines, executives and threads use it.
+    The shared cache is released with the last executive which uses it. The
+    documents in the cache are never modified, so the cache can be used from
+    several threads. Since the reference count of the elements is not atomic,
+    the references to the documents in the cache are only copied and released
+    with the lock held and never leave the cache.
+
+    A document is read again when the modification time or the size of its
+    file has changed since it was read.
+
+    The documents can also be written to a binary cache file, from which they
+    are read much faster than they are parsed. The documents of a cache file
+    are only used when the files they were parsed from are unchanged, which is
+    checked with a hash of the content of the files. The cache file holds the
+    values in the native byte order and can only be read by the build of
+    JSBSim which wrote it.
+
+    @author The JSBSim team
+    @see FGFDMExec::Clone
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGXMLDocumentCache
+{
+public:
+  FGXMLDocumentCache(void) : NumParsed(0) {}
+
+  /** Returns the cache shared by the executives of the process. The cache is
+      created when needed and deleted when it is no longer used. */
+  static std::shared_ptr<FGXMLDocumentCache> GetShared(void);
+
+  /** Returns a copy of a document, reading and parsing its file if it is not
+      in the cache yet or if it has changed since it was read.
+      @param path the path of the file. The extension ".xml" is added if the
+                  path has no extension.
+      @param verbose prints an error message if the file cannot be opened.
+      @return the copy of the document or null if the file cannot be opened. */
+  Element_ptr Load(const SGPath& path, bool verbose=true);
+
+  /// Returns the number of documents in the cache.
+  size_t GetNumDocuments(void) const;
+
+  /** Returns the number of documents which were parsed rather than taken
+      from the cache file. */
+  size_t GetNumParsed(void) const;
+
+  /// Removes all the documents from the cache.
+  void Clear(void);
+
+  /** Reads a cache file written by WriteFile(). Its documents are used by
+      Load() in place of the files which have not changed since.
+      @param filename the name of the cache file.
+      @return false if the file does not exist, is corrupted or was written
+              by another version of JSBSim. */
+  bool ReadFile(const SGPath& filename);
+
+  /** Writes the documents of the cache to a cache file.
+      @param filename the name of the cache file.
+      @return false if the file cannot be written. */
+  bool WriteFile(const SGPath& filename) const;
+
+private:
+  struct Document {
+    Element_ptr root;
+    uint64_t hash;
+    time_t modTime;
+    size_t size;
+  };
+
+  mutable std::mutex Mutex;
+  std::map<std::string, Document> Documents;
+  std::map<std::string, Document> Precompiled;
+  size_t NumParsed;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -36,6 +36,8 @@ INCLUDES
 #include "FGXMLElement.h"
 #include "string_utilities.h"
 #include "FGJSBBase.h"
+#include "FGStateArchive.h"
+#include "FGUnitConverter.h"
 
 using namespace std;
 
@@ -45,8 +47,7 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
-bool Element::converterIsInitialized = false;
-map <string, map <string, double> > Element::convert;
+thread_local RandomNumberGenerator* Element::DispersionGenerator = nullptr;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS IMPLEMENTATION
@@ -58,183 +59,6 @@ Element::Element(const string& nm)
   parent = 0L;
   element_index = 0;
   line_number = -1;
-
-  if (!converterIsInitialized) {
-    converterIsInitialized = true;
-    // convert ["from"]["to"] = factor, so: from * factor = to
-    // Length
-    convert["M"]["FT"] = 3.2808399;
-    convert["FT"]["M"] = 1.0/convert["M"]["FT"];
-    convert["CM"]["FT"] = 0.032808399;
-    convert["FT"]["CM"] = 1.0/convert["CM"]["FT"];
-    convert["KM"]["FT"] = 3280.8399;
-    convert["FT"]["KM"] = 1.0/convert["KM"]["FT"];
-    convert["FT"]["IN"] = 12.0;
-    convert["IN"]["FT"] = 1.0/convert["FT"]["IN"];
-    convert["IN"]["M"] = convert["IN"]["FT"] * convert["FT"]["M"];
-    convert["M"]["IN"] = convert["M"]["FT"] * convert["FT"]["IN"];
-    // Area
-    convert["M2"]["FT2"] = convert["M"]["FT"]*convert["M"]["FT"];
-    convert["FT2"]["M2"] = 1.0/convert["M2"]["FT2"];
-    convert["CM2"]["FT2"] = convert["CM"]["FT"]*convert["CM"]["FT"];
-    convert["FT2"]["CM2"] = 1.0/convert["CM2"]["FT2"];
-    convert["M2"]["IN2"] = convert["M"]["IN"]*convert["M"]["IN"];
-    convert["IN2"]["M2"] = 1.0/convert["M2"]["IN2"];
-    convert["FT2"]["IN2"] = 144.0;
-    convert["IN2"]["FT2"] = 1.0/convert["FT2"]["IN2"];
-    // Volume
-    convert["IN3"]["CC"] = 16.387064;
-    convert["CC"]["IN3"] = 1.0/convert["IN3"]["CC"];
-    convert["FT3"]["IN3"] = 1728.0;
-    convert["IN3"]["FT3"] = 1.0/convert["FT3"]["IN3"];
-    convert["M3"]["FT3"] = 35.3146667;
-    convert["FT3"]["M3"] = 1.0/convert["M3"]["FT3"];
-    convert["LTR"]["IN3"] = 61.0237441;
-    convert["IN3"]["LTR"] = 1.0/convert["LTR"]["IN3"];
-    // Mass & Weight
-    convert["LBS"]["KG"] = 0.45359237;
-    convert["KG"]["LBS"] = 1.0/convert["LBS"]["KG"];
-    convert["SLUG"]["KG"] = 14.59390;
-    convert["KG"]["SLUG"] = 1.0/convert["SLUG"]["KG"];
-    // Moments of Inertia
-    convert["SLUG*FT2"]["KG*M2"] = 1.35594;
-    convert["KG*M2"]["SLUG*FT2"] = 1.0/convert["SLUG*FT2"]["KG*M2"];
-    // Angles
-    convert["RAD"]["DEG"] = 180.0/M_PI;
-    convert["DEG"]["RAD"] = 1.0/convert["RAD"]["DEG"];
-    // Angular rates
-    convert["RAD/SEC"]["DEG/SEC"] = convert["RAD"]["DEG"];
-    convert["DEG/SEC"]["RAD/SEC"] = 1.0/convert["RAD/SEC"]["DEG/SEC"];
-    // Spring force
-    convert["LBS/FT"]["N/M"] = 14.5939;
-    convert["N/M"]["LBS/FT"] = 1.0/convert["LBS/FT"]["N/M"];
-    // Damping force
-    convert["LBS/FT/SEC"]["N/M/SEC"] = 14.5939;
-    convert["N/M/SEC"]["LBS/FT/SEC"] = 1.0/convert["LBS/FT/SEC"]["N/M/SEC"];
-    // Damping force (Square Law)
-    convert["LBS/FT2/SEC2"]["N/M2/SEC2"] = 47.880259;
-    convert["N/M2/SEC2"]["LBS/FT2/SEC2"] = 1.0/convert["LBS/FT2/SEC2"]["N/M2/SEC2"];
-    // Power
-    convert["WATTS"]["HP"] = 0.001341022;
-    convert["HP"]["WATTS"] = 1.0/convert["WATTS"]["HP"];
-    // Force
-    convert["N"]["LBS"] = 0.22482;
-    convert["LBS"]["N"] = 1.0/convert["N"]["LBS"];
-    // Velocity
-    convert["KTS"]["FT/SEC"] = 1.68781;
-    convert["FT/SEC"]["KTS"] = 1.0/convert["KTS"]["FT/SEC"];
-    convert["M/S"]["FT/S"] = 3.2808399;
-    convert["M/S"]["KTS"] = convert["M/S"]["FT/S"]/convert["KTS"]["FT/SEC"];
-    convert["M/SEC"]["FT/SEC"] = 3.2808399;
-    convert["FT/S"]["M/S"] = 1.0/convert["M/S"]["FT/S"];
-    convert["M/SEC"]["FT/SEC"] = 3.2808399;
-    convert["FT/SEC"]["M/SEC"] = 1.0/convert["M/SEC"]["FT/SEC"];
-    convert["KM/SEC"]["FT/SEC"] = 3280.8399;
-    convert["FT/SEC"]["KM/SEC"] = 1.0/convert["KM/SEC"]["FT/SEC"];
-    // Torque
-    convert["FT*LBS"]["N*M"] = 1.35581795;
-    convert["N*M"]["FT*LBS"] = 1/convert["FT*LBS"]["N*M"];
-    // Valve
-    convert["M4*SEC/KG"]["FT4*SEC/SLUG"] = convert["M"]["FT"]*convert["M"]["FT"]*
-      convert["M"]["FT"]*convert["M"]["FT"]/convert["KG"]["SLUG"];
-    convert["FT4*SEC/SLUG"]["M4*SEC/KG"] =
-      1.0/convert["M4*SEC/KG"]["FT4*SEC/SLUG"];
-    // Pressure
-    convert["INHG"]["PSF"] = 70.7180803;
-    convert["PSF"]["INHG"] = 1.0/convert["INHG"]["PSF"];
-    convert["ATM"]["INHG"] = 29.9246899;
-    convert["INHG"]["ATM"] = 1.0/convert["ATM"]["INHG"];
-    convert["PSI"]["INHG"] = 2.03625437;
-    convert["INHG"]["PSI"] = 1.0/convert["PSI"]["INHG"];
-    convert["INHG"]["PA"] = 3386.0; // inches Mercury to pascals
-    convert["PA"]["INHG"] = 1.0/convert["INHG"]["PA"];
-    convert["LBS/FT2"]["N/M2"] = 14.5939/convert["FT"]["M"];
-    convert["N/M2"]["LBS/FT2"] = 1.0/convert["LBS/FT2"]["N/M2"];
-    convert["LBS/FT2"]["PA"] = convert["LBS/FT2"]["N/M2"];
-    convert["PA"]["LBS/FT2"] = 1.0/convert["LBS/FT2"]["PA"];
-    // Mass flow
-    convert["KG/MIN"]["LBS/MIN"] = convert["KG"]["LBS"];
-    convert ["N/SEC"]["LBS/SEC"] = 0.224808943;
-    convert ["LBS/SEC"]["N/SEC"] = 1.0/convert ["N/SEC"]["LBS/SEC"];
-    // Fuel Consumption
-    convert["LBS/HP*HR"]["KG/KW*HR"] = 0.6083;
-    convert["KG/KW*HR"]["LBS/HP*HR"] = 1.0/convert["LBS/HP*HR"]["KG/KW*HR"];
-    // Density
-    convert["KG/L"]["LBS/GAL"] = 8.3454045;
-    convert["LBS/GAL"]["KG/L"] = 1.0/convert["KG/L"]["LBS/GAL"];
-
-    // Length
-    convert["M"]["M"] = 1.00;
-    convert["KM"]["KM"] = 1.00;
-    convert["FT"]["FT"] = 1.00;
-    convert["IN"]["IN"] = 1.00;
-    // Area
-    convert["M2"]["M2"] = 1.00;
-    convert["FT2"]["FT2"] = 1.00;
-    // Volume
-    convert["IN3"]["IN3"] = 1.00;
-    convert["CC"]["CC"] = 1.0;
-    convert["M3"]["M3"] = 1.0;
-    convert["FT3"]["FT3"] = 1.0;
-    convert["LTR"]["LTR"] = 1.0;
-    // Mass & Weight
-    convert["KG"]["KG"] = 1.00;
-    convert["LBS"]["LBS"] = 1.00;
-    // Moments of Inertia
-    convert["KG*M2"]["KG*M2"] = 1.00;
-    convert["SLUG*FT2"]["SLUG*FT2"] = 1.00;
-    // Angles
-    convert["DEG"]["DEG"] = 1.00;
-    convert["RAD"]["RAD"] = 1.00;
-    // Angular rates
-    convert["DEG/SEC"]["DEG/SEC"] = 1.00;
-    convert["RAD/SEC"]["RAD/SEC"] = 1.00;
-    // Spring force
-    convert["LBS/FT"]["LBS/FT"] = 1.00;
-    convert["N/M"]["N/M"] = 1.00;
-    // Damping force
-    convert["LBS/FT/SEC"]["LBS/FT/SEC"] = 1.00;
-    convert["N/M/SEC"]["N/M/SEC"] = 1.00;
-    // Damping force (Square law)
-    convert["LBS/FT2/SEC2"]["LBS/FT2/SEC2"] = 1.00;
-    convert["N/M2/SEC2"]["N/M2/SEC2"] = 1.00;
-    // Power
-    convert["HP"]["HP"] = 1.00;
-    convert["WATTS"]["WATTS"] = 1.00;
-    // Force
-    convert["N"]["N"] = 1.00;
-    // Velocity
-    convert["FT/SEC"]["FT/SEC"] = 1.00;
-    convert["KTS"]["KTS"] = 1.00;
-    convert["M/S"]["M/S"] = 1.0;
-    convert["M/SEC"]["M/SEC"] = 1.0;
-    convert["KM/SEC"]["KM/SEC"] = 1.0;
-    // Torque
-    convert["FT*LBS"]["FT*LBS"] = 1.00;
-    convert["N*M"]["N*M"] = 1.00;
-    // Valve
-    convert["M4*SEC/KG"]["M4*SEC/KG"] = 1.0;
-    convert["FT4*SEC/SLUG"]["FT4*SEC/SLUG"] = 1.0;
-    // Pressure
-    convert["PSI"]["PSI"] = 1.00;
-    convert["PSF"]["PSF"] = 1.00;
-    convert["INHG"]["INHG"] = 1.00;
-    convert["ATM"]["ATM"] = 1.0;
-    convert["PA"]["PA"] = 1.0;
-    convert["N/M2"]["N/M2"] = 1.00;
-    convert["LBS/FT2"]["LBS/FT2"] = 1.00;
-    // Mass flow
-    convert["LBS/SEC"]["LBS/SEC"] = 1.00;
-    convert["KG/MIN"]["KG/MIN"] = 1.0;
-    convert["LBS/MIN"]["LBS/MIN"] = 1.0;
-    convert["N/SEC"]["N/SEC"] = 1.0;
-    // Fuel Consumption
-    convert["LBS/HP*HR"]["LBS/HP*HR"] = 1.0;
-    convert["KG/KW*HR"]["KG/KW*HR"] = 1.0;
-    // Density
-    convert["KG/L"]["KG/L"] = 1.0;
-    convert["LBS/GAL"]["LBS/GAL"] = 1.0;
-  }
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -447,19 +271,7 @@ double Element::FindElementValueAsNumberConvertTo(const string& el, const string
 
   string supplied_units = element->GetAttributeValue("unit");
 
-  if (!supplied_units.empty()) {
-    if (convert.find(supplied_units) == convert.end()) {
-      cerr << element->ReadFrom() << "Supplied unit: \""
-           << supplied_units << "\" does not exist (typo?)." << endl;
-      exit(-1);
-    }
-    if (convert[supplied_units].find(target_units) == convert[supplied_units].end()) {
-      cerr << element->ReadFrom() << "Supplied unit: \""
-           << supplied_units << "\" cannot be converted to " << target_units
-           << endl;
-      exit(-1);
-    }
-  }
+  double factor = element->GetConversionFactor(supplied_units, target_units);
 
   double value = element->GetDataAsNumber();
 
@@ -476,9 +288,7 @@ double Element::FindElementValueAsNumberConvertTo(const string& el, const string
   }
 
 
-  if (!supplied_units.empty()) {
-    value *= convert[supplied_units][target_units];
-  }
+  value *= factor;
 
   if ((target_units == "RAD") && (fabs(value) > 2 * M_PI)) {
     cerr << element->ReadFrom() << element->GetName() << " value "
@@ -509,24 +319,10 @@ double Element::FindElementValueAsNumberConvertFromTo( const string& el,
     exit(-1);
   }
 
-  if (!supplied_units.empty()) {
-    if (convert.find(supplied_units) == convert.end()) {
-      cerr << element->ReadFrom() << "Supplied unit: \""
-           << supplied_units << "\" does not exist (typo?)." << endl;
-      exit(-1);
-    }
-    if (convert[supplied_units].find(target_units) == convert[supplied_units].end()) {
-      cerr << element->ReadFrom() << "Supplied unit: \""
-           << supplied_units << "\" cannot be converted to " << target_units
-           << endl;
-      exit(-1);
-    }
-  }
+  double factor = element->GetConversionFactor(supplied_units, target_units);
 
   double value = element->GetDataAsNumber();
-  if (!supplied_units.empty()) {
-    value *= convert[supplied_units][target_units];
-  }
+  value *= factor;
 
   value = DisperseValue(element, value, supplied_units, target_units);
 
@@ -542,25 +338,13 @@ FGColumnVector3 Element::FindElementTripletConvertTo( const string& target_units
   double value=0.0;
   string supplied_units = GetAttributeValue("unit");
 
-  if (!supplied_units.empty()) {
-    if (convert.find(supplied_units) == convert.end()) {
-      cerr << ReadFrom() << "Supplied unit: \""
-           << supplied_units << "\" does not exist (typo?)." << endl;
-      exit(-1);
-    }
-    if (convert[supplied_units].find(target_units) == convert[supplied_units].end()) {
-      cerr << ReadFrom() << "Supplied unit: \""
-           << supplied_units << "\" cannot be converted to " << target_units
-           << endl;
-      exit(-1);
-    }
-  }
+  double factor = GetConversionFactor(supplied_units, target_units);
 
   item = FindElement("x");
   if (!item) item = FindElement("roll");
   if (item) {
     value = item->GetDataAsNumber();
-    if (!supplied_units.empty()) value *= convert[supplied_units][target_units];
+    value *= factor;
     triplet(1) = DisperseValue(item, value, supplied_units, target_units);
   } else {
     triplet(1) = 0.0;
@@ -571,7 +355,7 @@ FGColumnVector3 Element::FindElementTripletConvertTo( const string& target_units
   if (!item) item = FindElement("pitch");
   if (item) {
     value = item->GetDataAsNumber();
-    if (!supplied_units.empty()) value *= convert[supplied_units][target_units];
+    value *= factor;
     triplet(2) = DisperseValue(item, value, supplied_units, target_units);
   } else {
     triplet(2) = 0.0;
@@ -581,7 +365,7 @@ FGColumnVector3 Element::FindElementTripletConvertTo( const string& target_units
   if (!item) item = FindElement("yaw");
   if (item) {
     value = item->GetDataAsNumber();
-    if (!supplied_units.empty()) value *= convert[supplied_units][target_units];
+    value *= factor;
     triplet(3) = DisperseValue(item, value, supplied_units, target_units);
   } else {
     triplet(3) = 0.0;
@@ -610,17 +394,21 @@ double Element::DisperseValue(Element *e, double val, const std::string& supplie
 
   if (e->HasAttribute("dispersion") && disperse) {
     double disp = e->GetAttributeValueAsNumber("dispersion");
-    if (!supplied_units.empty()) disp *= convert[supplied_units][target_units];
+    disp *= e->GetConversionFactor(supplied_units, target_units);
     string attType = e->GetAttributeValue("type");
+    static thread_local RandomNumberGenerator defaultGenerator;
+    RandomNumberGenerator& generator = DispersionGenerator ? *DispersionGenerator
+                                                           : defaultGenerator;
+
     if (attType == "gaussian" || attType == "gaussiansigned") {
-      double grn = FGJSBBase::GaussianRandomNumber();
+      double grn = generator.GetNormalRandomNumber();
     if (attType == "gaussian") {
       value = val + disp*grn;
       } else { // Assume gaussiansigned
         value = (val + disp*grn)*(fabs(grn)/grn);
       }
     } else if (attType == "uniform" || attType == "uniformsigned") {
-      double urn = ((((double)rand()/RAND_MAX)-0.5)*2.0);
+      double urn = generator.GetUniformRandomNumber();
       if (attType == "uniform") {
       value = val + disp * urn;
       } else { // Assume uniformsigned
@@ -637,6 +425,41 @@ double Element::DisperseValue(Element *e, double val, const std::string& supplie
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+double Element::GetConversionFactor(const string& supplied_units,
+                                    const string& target_units)
+{
+  if (supplied_units.empty()) return 1.0;
+
+  FGUnitConverter::Unit from = FGUnitConverter::GetUnit(supplied_units);
+  if (from == FGUnitConverter::uUnknown) {
+    cerr << ReadFrom() << "Supplied unit: \""
+         << supplied_units << "\" does not exist (typo?)." << endl;
+    exit(-1);
+  }
+
+  FGUnitConverter::Unit to = FGUnitConverter::GetUnit(target_units);
+  double factor;
+  if (!FGUnitConverter::GetFactor(from, to, factor)) {
+    cerr << ReadFrom() << "Supplied unit: \""
+         << supplied_units << "\" cannot be converted to " << target_units;
+
+    uint32_t supplied_dimensions = FGUnitConverter::GetDimensions(from);
+    uint32_t target_dimensions = FGUnitConverter::GetDimensions(to);
+    if (target_dimensions && !(supplied_dimensions & target_dimensions))
+      cerr << ": " << supplied_units << " is a unit of "
+           << FGUnitConverter::GetDimensionNames(supplied_dimensions)
+           << " and " << target_units << " is a unit of "
+           << FGUnitConverter::GetDimensionNames(target_dimensions);
+
+    cerr << endl;
+    exit(-1);
+  }
+
+  return factor;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void Element::Print(unsigned int level)
 {
   unsigned int i, spaces;
@@ -709,4 +532,57 @@ void Element::MergeAttributes(Element* el)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Element_ptr Element::Clone(void) const
+{
+  Element_ptr copy = new Element(name);
+
+  copy->attributes = attributes;
+  copy->data_lines = data_lines;
+  copy->file_name = file_name;
+  copy->line_number = line_number;
+
+  copy->children.reserve(children.size());
+  for (const auto& child: children) {
+    Element_ptr child_copy = child->Clone();
+    child_copy->parent = copy;
+    copy->children.push_back(child_copy);
+  }
+
+  return copy;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void Element::Serialize(FGStateArchive& archive)
+{
+  archive.Sync(name, file_name, line_number, data_lines);
+
+  size_t nattributes = attributes.size();
+  archive.Sync(nattributes);
+  if (archive.IsSaving()) {
+    for (auto& attribute: attributes) {
+      string key = attribute.first;
+      archive.Sync(key, attribute.second);
+    }
+  } else {
+    for (size_t i=0; i<nattributes; i++) {
+      string key, value;
+      archive.Sync(key, value);
+      attributes[key] = value;
+    }
+  }
+
+  size_t nchildren = children.size();
+  archive.Sync(nchildren);
+  for (size_t i=0; i<nchildren; i++) {
+    if (!archive.IsSaving()) {
+      children.push_back(new Element(""));
+      children.back()->parent = this;
+    }
+    children[i]->Serialize(archive);
+  }
+}
+
 } // end namespace JSBSim
@@ -47,88 +47,18 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
+class RandomNumberGenerator;
+class FGStateArchive;
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 /** Encapsulates an XML element.
     This class handles the creation, storage, and manipulation of XML elements.
-    This class also can convert supplied values as follows:
-
-    convert ["from"]["to"] = factor, so: from * factor = to
-    - convert["M"]["FT"] = 3.2808399;
-    - convert["FT"]["M"] = 1.0/convert["M"]["FT"];
-    - convert["M2"]["FT2"] = convert["M"]["FT"]*convert["M"]["FT"];
-    - convert["FT2"]["M2"] = 1.0/convert["M2"]["FT2"];
-    - convert["FT"]["IN"] = 12.0;
-    - convert["IN"]["FT"] = 1.0/convert["FT"]["IN"];
-    - convert["LBS"]["KG"] = 0.45359237;
-    - convert["KG"]["LBS"] = 1.0/convert["LBS"]["KG"];
-    - convert["SLUG*FT2"]["KG*M2"] = 1.35594;
-    - convert["KG*M2"]["SLUG*FT2"] = 1.0/convert["SLUG*FT2"]["KG*M2"];
-    - convert["RAD"]["DEG"] = 360.0/(2.0*3.1415926);
-    - convert["DEG"]["RAD"] = 1.0/convert["RAD"]["DEG"];
-    - convert["LBS/FT"]["N/M"] = 14.5939;
-    - convert["LBS/FT/SEC"]["N/M/SEC"] = 14.5939;
-    - convert["N/M"]["LBS/FT"] = 1.0/convert["LBS/FT"]["N/M"];
-    - convert["N/M/SEC"]["LBS/FT/SEC"] = 1.0/convert["LBS/FT/SEC"]["N/M/SEC"];
-    - convert["WATTS"]["HP"] = 0.001341022;
-    - convert["HP"]["WATTS"] = 1.0/convert["WATTS"]["HP"];
-    - convert["N"]["LBS"] = 0.22482;
-    - convert["LBS"]["N"] = 1.0/convert["N"]["LBS"];
-    - convert["KTS"]["FT/SEC"] = ktstofps;
-    - convert["KG/MIN"]["LBS/MIN"] = convert["KG"]["LBS"];
-    - convert["LBS/HP*HR"]["KG/KW*HR"] = 0.6083;
-    - convert["KG/KW*HR"]["LBS/HP*HR"] = 1/convert["LBS/HP*HR"]["KG/KW*HR"];
-    - convert["KG/L"]["LBS/GAL"] = 8.3454045;
-
-    - convert["M"]["M"] = 1.00;
-    - convert["FT"]["FT"] = 1.00;
-    - convert["IN"]["IN"] = 1.00;
-    - convert["DEG"]["DEG"] = 1.00;
-    - convert["RAD"]["RAD"] = 1.00;
-    - convert["M2"]["M2"] = 1.00;
-    - convert["FT2"]["FT2"] = 1.00;
-    - convert["KG*M2"]["KG*M2"] = 1.00;
-    - convert["SLUG*FT2"]["SLUG*FT2"] = 1.00;
-    - convert["KG"]["KG"] = 1.00;
-    - convert["LBS"]["LBS"] = 1.00;
-    - convert["LBS/FT"]["LBS/FT"] = 1.00;
-    - convert["N/M"]["N/M"] = 1.00;
-    - convert["LBS/FT/SEC"]["LBS/FT/SEC"] = 1.00;
-    - convert["N/M/SEC"]["N/M/SEC"] = 1.00;
-    - convert["PSI"]["PSI"] = 1.00;
-    - convert["INHG"]["INHG"] = 1.00;
-    - convert["HP"]["HP"] = 1.00;
-    - convert["N"]["N"] = 1.00;
-    - convert["WATTS"]["WATTS"] = 1.00;
-    - convert["KTS"]["KTS"] = 1.0;
-    - convert["FT/SEC"]["FT/SEC"] = 1.0;
-    - convert["KG/MIN"]["KG/MIN"] = 1.0;
-    - convert["LBS/MIN"]["LBS/MIN"] = 1.0;
-    - convert["LBS/HP*HR"]["LBS/HP*HR"] = 1.0;
-    - convert["KG/KW*HR"]["KG/KW*HR"] = 1.0;
-    - convert["KG/L"]["KG/L"] = 1.0;
-    - convert["LBS/GAL"]["LBS/GAL"] = 1.0;
-
-    Where:
-    - N = newtons
-    - M = meters
-    - M2 = meters squared
-    - KG = kilograms
-    - LBS = pounds force
-    - FT = feet
-    - FT2 = feet squared
-    - SEC = seconds
-    - MIN = minutes
-    - SLUG = slug
-    - DEG = degrees
-    - RAD = radians
-    - WATTS = watts
-    - HP = horsepower
-    - HR = hour
-    - L = liter
-    - GAL = gallon (U.S. liquid) 
+    This class also can convert the values of the elements from the units of
+    their unit attribute to the units expected by the models. The units and
+    their conversions are listed by FGUnitConverter.
 
     @author Jon S. Berndt
 */
@@ -325,6 +255,14 @@ public:
   double DisperseValue(Element *e, double val, const std::string& supplied_units="",
                        const std::string& target_units="");
 
+  /** Sets the random generator used to disperse the values read by the
+      calling thread. FGFDMExec installs its own generator before it loads a
+      model so that the dispersions can be reproduced from its seed and run
+      index. The generator is not owned by Element.
+      @param generator the generator or nullptr to use a default generator. */
+  static void SetDispersionGenerator(RandomNumberGenerator* generator)
+  { DispersionGenerator = generator; }
+
   /** This function sets the value of the parent class attribute to the supplied
       Element pointer.
       @param p pointer to the parent Element. */
@@ -374,6 +312,17 @@ public:
    */
   void MergeAttributes(Element* el);
 
+  /** Returns a deep copy of the element: its attributes, its data lines and
+   *  its children are copied recursively. The copy has no parent.
+   */
+  Element_ptr Clone(void) const;
+
+  /** Saves the element and its children to a binary archive or restores them
+   *  from it. The element must be empty when it is restored.
+   *  @see FGXMLDocumentCache::WriteFile
+   */
+  void Serialize(FGStateArchive& archive);
+
 private:
   std::string name;
   std::map <std::string, std::string> attributes;
@@ -383,9 +332,13 @@ private:
   unsigned int element_index;
   std::string file_name;
   int line_number;
-  typedef std::map <std::string, std::map <std::string, double> > tMapConvert;
-  static tMapConvert convert;
-  static bool converterIsInitialized;
+  static thread_local RandomNumberGenerator* DispersionGenerator;
+
+  /** Returns the factor which converts the values of this element from
+      supplied_units to target_units, or 1.0 if supplied_units is empty. The
+      program is stopped if the conversion does not exist. */
+  double GetConversionFactor(const std::string& supplied_units,
+                             const std::string& target_units);
 };
 
 } // namespace JSBSim
@@ -82,6 +82,7 @@ FGfdmSocket::FGfdmSocket(const string& address, int port, int protocol)
   sckt = sckt_in = 0;
   Protocol = (ProtocolType)protocol;
   connected = false;
+  Binary = false;
 
   #if defined(_MSC_VER) || defined(__MINGW32__)
   if (!LoadWinSockDLL(debug_lvl)) return;
@@ -140,6 +141,7 @@ FGfdmSocket::FGfdmSocket(int port, int protocol)
 {
   sckt = -1;
   connected = false;
+  Binary = false;
   Protocol = (ProtocolType)protocol;
   string ProtocolName;
  
@@ -218,7 +220,8 @@ FGfdmSocket::~FGfdmSocket()
 
 string FGfdmSocket::Receive(void)
 {
-  char buf[1024];
+  // Large enough for the biggest UDP datagram so that none is truncated.
+  char buf[65536];
   int len = sizeof(struct sockaddr_in);
   int num_chars=0;
   unsigned long NoBlock = true;
@@ -237,7 +240,8 @@ string FGfdmSocket::Receive(void)
       #else
          ioctl(sckt_in, FIONBIO, &NoBlock);
       #endif
-      send(sckt_in, "Connected to JSBSim server\nJSBSim> ", 35, 0);
+      if (!Binary)
+        send(sckt_in, "Connected to JSBSim server\nJSBSim> ", 35, 0);
     }
   }
 
@@ -279,7 +283,7 @@ int FGfdmSocket::Reply(const string& text)
 
   if (sckt_in >= 0) {
     num_chars_sent = send(sckt_in, text.c_str(), text.size(), 0);
-    send(sckt_in, "JSBSim> ", 8, 0);
+    if (!Binary) send(sckt_in, "JSBSim> ", 8, 0);
   } else {
     cerr << "Socket reply must be to a valid socket" << endl;
     return -1;
@@ -73,7 +73,10 @@ CLASS DOCUMENTATION
 
 /** Encapsulates an object that enables JSBSim to communicate via socket (input
     and/or output).
-    
+
+    In binary mode (see FGSocketMessage), the input socket neither greets the
+    clients nor prompts them after a reply, so that the data sent back only
+    contains messages.
   */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -102,6 +105,8 @@ public:
   void Close(void);
   bool GetConnectStatus(void) {return connected;}
   void WaitUntilReadable(void);
+  void SetBinary(bool binary) {Binary = binary;}
+  bool IsBinary(void) const {return Binary;}
 
   enum ProtocolType {ptUDP, ptTCP};
  
@@ -113,6 +118,7 @@ private:
   struct hostent *host;
   std::ostringstream buffer;
   bool connected;
+  bool Binary;
   void Debug(int from);
 };
 }
@@ -37,7 +37,9 @@ INCLUDES
 #include "simgear/misc/strutils.hxx"
 #include "FGFunction.h"
 #include "FGTable.h"
+#include "FGFDMExec.h"
 #include "FGPropertyValue.h"
+#include "input_output/FGStateArchive.h"
 #include "FGRealValue.h"
 #include "input_output/FGXMLElement.h"
 #include "math/FGMatrix33.h"
@@ -79,11 +81,13 @@ template<typename func_t, unsigned int Nmin, unsigned int Nmax=Nmin,
 class aFunc: public FGFunction
 {
 public:
-  aFunc(const func_t& _f, FGPropertyManager* pm, Element* el,
-        const string& prefix, FGPropertyValue* v)
+  aFunc(const func_t& _f, FGFDMExec* fdmex, Element* el,
+        const string& prefix, FGPropertyValue* v,
+        const Operation& op=Operation())
     : f(_f)
   {
-    Load(pm, el, v, prefix);
+    operation = op;
+    Load(fdmex, el, v, prefix);
     CheckMinArguments(el, Nmin);
     CheckMaxArguments(el, Nmax);
     CheckOddOrEvenArguments(el, odd_even);
@@ -99,7 +103,7 @@ private:
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-bool GetBinary(double val, const string &ctxMsg)
+bool FGFunction::GetBinary(double val, const string &ctxMsg)
 {
   val = fabs(val);
   if (val < 1E-9) return false;
@@ -116,13 +120,41 @@ bool GetBinary(double val, const string &ctxMsg)
 // Hides the machinery to create a class for functions from <math.h> such as
 // sin, cos, exp, etc.
 
-FGFunction* make_MathFn(double(*math_fn)(double), FGPropertyManager* pm, Element* el,
+FGFunction* make_MathFn(double(*math_fn)(double), FGFDMExec* fdmex, Element* el,
                         const string& prefix, FGPropertyValue* v)
 {
   auto f = [math_fn](const std::vector<FGParameter_ptr> &p)->double {
              return math_fn(p[0]->GetValue());
            };
-  return new aFunc<decltype(f), 1>(f, pm, el, prefix, v);
+  return new aFunc<decltype(f), 1>(f, fdmex, el, prefix, v, math_fn);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Same as above for functions with 2 arguments such as pow, atan2, etc.
+
+FGFunction* make_MathFn(double(*math_fn)(double, double), FGFDMExec* fdmex,
+                        Element* el, const string& prefix, FGPropertyValue* v)
+{
+  auto f = [math_fn](const std::vector<FGParameter_ptr> &p)->double {
+             return math_fn(p[0]->GetValue(), p[1]->GetValue());
+           };
+  return new aFunc<decltype(f), 2>(f, fdmex, el, prefix, v, math_fn);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Functions with 2 arguments that are not defined when their second argument is
+// null (quotient, fmod). In that case, the first argument is not evaluated and
+// HUGE_VAL is returned.
+
+FGFunction* make_GuardedFn(double(*math_fn)(double, double), FGFDMExec* fdmex,
+                           Element* el, const string& prefix, FGPropertyValue* v)
+{
+  auto f = [math_fn](const std::vector<FGParameter_ptr> &p)->double {
+             double y = p[1]->GetValue();
+             return y != 0.0 ? math_fn(p[0]->GetValue(), y) : HUGE_VAL;
+           };
+  return new aFunc<decltype(f), 2>(f, fdmex, el, prefix, v,
+                                   FGFunction::Operation(math_fn, FGFunction::Operation::Guarded));
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -131,11 +163,12 @@ FGFunction* make_MathFn(double(*math_fn)(double), FGPropertyManager* pm, Element
 // function: in that case the function is ignored and replaced by its argument.
 
 template<typename func_t>
-FGParameter_ptr VarArgsFn(const func_t& _f, FGPropertyManager* pm, Element* el,
-                          const string& prefix, FGPropertyValue* v)
+FGParameter_ptr VarArgsFn(const func_t& _f, FGFDMExec* fdmex, Element* el,
+                          const string& prefix, FGPropertyValue* v,
+                          FGFunction::Operation::Kind kind)
 {
   try {
-    return new aFunc<func_t, 2, MaxArgs>(_f, pm, el, prefix, v);
+    return new aFunc<func_t, 2, MaxArgs>(_f, fdmex, el, prefix, v, kind);
   }
   catch(WrongNumberOfArguments& e) {
     if ((e.GetElement() == el) && (e.NumberOfArguments() == 1)) {
@@ -153,13 +186,18 @@ FGParameter_ptr VarArgsFn(const func_t& _f, FGPropertyManager* pm, Element* el,
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-FGFunction::FGFunction(FGPropertyManager* PropertyManager, Element* el,
-                       const string& prefix, FGPropertyValue* var)
+FGFunction::FGFunction(FGFDMExec* fdmex, Element* el, const string& prefix,
+                       FGPropertyValue* var)
   : FGFunction()
 {
-  Load(PropertyManager, el, var, prefix);
+  Load(fdmex, el, var, prefix);
   CheckMinArguments(el, 1);
   CheckMaxArguments(el, 1);
+  Compile(fdmex);
+
+  // Only the top-level functions are memoized. The dependencies are collected
+  // at the first evaluation since the properties can be defined late.
+  Inputs = FGPropertyDependencies();
 
   string sCopyTo = el->GetAttributeValue("copyto");
 
@@ -176,7 +214,7 @@ FGFunction::FGFunction(FGPropertyManager* PropertyManager, Element* el,
       }
     }
 
-    pCopyTo = PropertyManager->GetNode(sCopyTo);
+    pCopyTo = fdmex->GetPropertyManager()->GetNode(sCopyTo);
     if (!pCopyTo)
       cerr << el->ReadFrom() << fgred
            << "Property \"" << sCopyTo
@@ -240,9 +278,11 @@ void FGFunction::CheckOddOrEvenArguments(Element* el, OddEven odd_even)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-void FGFunction::Load(FGPropertyManager* PropertyManager, Element* el,
-                      FGPropertyValue* var, const string& Prefix)
+void FGFunction::Load(FGFDMExec* fdmex, Element* el, FGPropertyValue* var,
+                      const string& Prefix)
 {
+  FGPropertyManager* PropertyManager = fdmex->GetPropertyManager();
+
   Name = el->GetAttributeValue("name");
   Element* element = el->GetElement();
   auto sum = [](const decltype(Parameters)& Parameters)->double {
@@ -295,14 +335,17 @@ void FGFunction::Load(FGPropertyManager* PropertyManager, Element* el,
 
                  return temp;
                };
-      Parameters.push_back(VarArgsFn<decltype(f)>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(VarArgsFn<decltype(f)>(f, fdmex, element, Prefix, var,
+                                                  Operation::Product));
     } else if (operation == "sum") {
-      Parameters.push_back(VarArgsFn<decltype(sum)>(sum, PropertyManager, element, Prefix, var));
+      Parameters.push_back(VarArgsFn<decltype(sum)>(sum, fdmex, element, Prefix,
+                                                    var, Operation::Sum));
     } else if (operation == "avg") {
-      auto avg = [&](const decltype(Parameters)& p)->double {
+      auto avg = [sum](const decltype(Parameters)& p)->double {
                    return sum(p) / p.size();
                  };
-      Parameters.push_back(VarArgsFn<decltype(avg)>(avg, PropertyManager, element, Prefix, var));
+      Parameters.push_back(VarArgsFn<decltype(avg)>(avg, fdmex, element, Prefix,
+                                                    var, Operation::Avg));
     } else if (operation == "difference") {
       auto f = [](const decltype(Parameters)& Parameters)->double {
                  double temp = Parameters[0]->GetValue();
@@ -312,7 +355,8 @@ void FGFunction::Load(FGPropertyManager* PropertyManager, Element* el,
 
                  return temp;
                };
-      Parameters.push_back(VarArgsFn<decltype(f)>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(VarArgsFn<decltype(f)>(f, fdmex, element, Prefix, var,
+                                                  Operation::Difference));
     } else if (operation == "min") {
       auto f = [](const decltype(Parameters)& Parameters)->double {
                  double _min = HUGE_VAL;
@@ -325,7 +369,8 @@ void FGFunction::Load(FGPropertyManager* PropertyManager, Element* el,
 
                  return _min;
                };
-      Parameters.push_back(VarArgsFn<decltype(f)>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(VarArgsFn<decltype(f)>(f, fdmex, element, Prefix, var,
+                                                  Operation::Min));
     } else if (operation == "max") {
       auto f = [](const decltype(Parameters)& Parameters)->double {
                  double _max = -HUGE_VAL;
@@ -338,7 +383,8 @@ void FGFunction::Load(FGPropertyManager* PropertyManager, Element* el,
 
                  return _max;
                };
-      Parameters.push_back(VarArgsFn<decltype(f)>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(VarArgsFn<decltype(f)>(f, fdmex, element, Prefix, var,
+                                                  Operation::Max));
     } else if (operation == "and") {
       string ctxMsg = element->ReadFrom();
       auto f = [ctxMsg](const decltype(Parameters)& Parameters)->double {
@@ -349,7 +395,8 @@ void FGFunction::Load(FGPropertyManager* PropertyManager, Element* el,
 
                  return 1.0;
                };
-      Parameters.push_back(new aFunc<decltype(f), 2, MaxArgs>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(new aFunc<decltype(f), 2, MaxArgs>(f, fdmex, element, Prefix, var,
+                                                              Operation(Operation::And, ctxMsg)));
     } else if (operation == "or") {
       string ctxMsg = element->ReadFrom();
       auto f = [ctxMsg](const decltype(Parameters)& Parameters)->double {
@@ -360,142 +407,108 @@ void FGFunction::Load(FGPropertyManager* PropertyManager, Element* el,
 
                  return 0.0;
                };
-      Parameters.push_back(new aFunc<decltype(f), 2, MaxArgs>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(new aFunc<decltype(f), 2, MaxArgs>(f, fdmex, element, Prefix, var,
+                                                              Operation(Operation::Or, ctxMsg)));
     } else if (operation == "quotient") {
-      auto f = [](const decltype(Parameters)& p)->double {
-                 double y = p[1]->GetValue();
-                 return y != 0.0 ? p[0]->GetValue()/y : HUGE_VAL;
-               };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, PropertyManager, element, Prefix, var));
+      auto f = [](double x, double y)->double { return x/y; };
+      Parameters.push_back(make_GuardedFn(f, fdmex, element, Prefix, var));
     } else if (operation == "pow") {
-      auto f = [](const decltype(Parameters)& p)->double {
-                 return pow(p[0]->GetValue(), p[1]->GetValue());
-               };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, PropertyManager, element, Prefix, var));
+      auto f = [](double x, double y)->double { return pow(x, y); };
+      Parameters.push_back(make_MathFn(f, fdmex, element, Prefix, var));
     } else if (operation == "toradians") {
-      auto f = [](const decltype(Parameters)& p)->double {
-                 return p[0]->GetValue()*M_PI/180.;
-               };
-      Parameters.push_back(new aFunc<decltype(f), 1>(f, PropertyManager, element, Prefix, var));
+      auto f = [](double x)->double { return x*M_PI/180.; };
+      Parameters.push_back(make_MathFn(f, fdmex, element, Prefix, var));
     } else if (operation == "todegrees") {
-      auto f = [](const decltype(Parameters)& p)->double {
-                 return p[0]->GetValue()*180./M_PI;
-               };
-      Parameters.push_back(new aFunc<decltype(f), 1>(f, PropertyManager, element, Prefix, var));
+      auto f = [](double x)->double { return x*180./M_PI; };
+      Parameters.push_back(make_MathFn(f, fdmex, element, Prefix, var));
     } else if (operation == "sqrt") {
-      auto f = [](const decltype(Parameters)& p)->double {
-                 double x = p[0]->GetValue();
-                 return x >= 0.0 ? sqrt(x) : -HUGE_VAL;
-               };
-      Parameters.push_back(new aFunc<decltype(f), 1>(f, PropertyManager, element, Prefix, var));
+      auto f = [](double x)->double { return x >= 0.0 ? sqrt(x) : -HUGE_VAL; };
+      Parameters.push_back(make_MathFn(f, fdmex, element, Prefix, var));
     } else if (operation == "log2") {
-      auto f = [](const decltype(Parameters)& p)->double {
-                 double x = p[0]->GetValue();
+      auto f = [](double x)->double {
                  return x > 0.0 ? log10(x)*invlog2val : -HUGE_VAL;
                };
-      Parameters.push_back(new aFunc<decltype(f), 1>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(make_MathFn(f, fdmex, element, Prefix, var));
     } else if (operation == "ln") {
-      auto f = [](const decltype(Parameters)& p)->double {
-                 double x = p[0]->GetValue();
-                 return x > 0.0 ? log(x) : -HUGE_VAL;
-               };
-      Parameters.push_back(new aFunc<decltype(f), 1>(f, PropertyManager, element, Prefix, var));
+      auto f = [](double x)->double { return x > 0.0 ? log(x) : -HUGE_VAL; };
+      Parameters.push_back(make_MathFn(f, fdmex, element, Prefix, var));
     } else if (operation == "log10") {
-      auto f = [](const decltype(Parameters)& p)->double {
-                 double x = p[0]->GetValue();
-                 return x > 0.0 ? log10(x) : -HUGE_VAL;
-               };
-      Parameters.push_back(new aFunc<decltype(f), 1>(f, PropertyManager, element, Prefix, var));
+      auto f = [](double x)->double { return x > 0.0 ? log10(x) : -HUGE_VAL; };
+      Parameters.push_back(make_MathFn(f, fdmex, element, Prefix, var));
     } else if (operation == "sign") {
-      auto f = [](const decltype(Parameters)& p)->double {
-                 return p[0]->GetValue() < 0.0 ? -1 : 1; // 0.0 counts as positive.
+      auto f = [](double x)->double {
+                 return x < 0.0 ? -1 : 1; // 0.0 counts as positive.
                };
-      Parameters.push_back(new aFunc<decltype(f), 1>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(make_MathFn(f, fdmex, element, Prefix, var));
     } else if (operation == "exp") {
-      Parameters.push_back(make_MathFn(exp, PropertyManager, element, Prefix, var));
+      Parameters.push_back(make_MathFn(exp, fdmex, element, Prefix, var));
     } else if (operation == "abs") {
-      Parameters.push_back(make_MathFn(fabs, PropertyManager, element, Prefix, var));
+      Parameters.push_back(make_MathFn(fabs, fdmex, element, Prefix, var));
     } else if (operation == "sin") {
-      Parameters.push_back(make_MathFn(sin, PropertyManager, element, Prefix, var));
+      Parameters.push_back(make_MathFn(sin, fdmex, element, Prefix, var));
     } else if (operation == "cos") {
-      Parameters.push_back(make_MathFn(cos, PropertyManager, element, Prefix, var));
+      Parameters.push_back(make_MathFn(cos, fdmex, element, Prefix, var));
     } else if (operation == "tan") {
-      Parameters.push_back(make_MathFn(tan, PropertyManager, element, Prefix, var));
+      Parameters.push_back(make_MathFn(tan, fdmex, element, Prefix, var));
     } else if (operation == "asin") {
-      Parameters.push_back(make_MathFn(asin, PropertyManager, element, Prefix, var));
+      Parameters.push_back(make_MathFn(asin, fdmex, element, Prefix, var));
     } else if (operation == "acos") {
-      Parameters.push_back(make_MathFn(acos, PropertyManager, element, Prefix, var));
+      Parameters.push_back(make_MathFn(acos, fdmex, element, Prefix, var));
     } else if (operation == "atan") {
-      Parameters.push_back(make_MathFn(atan, PropertyManager, element, Prefix, var));
+      Parameters.push_back(make_MathFn(atan, fdmex, element, Prefix, var));
     } else if (operation == "floor") {
-      Parameters.push_back(make_MathFn(floor, PropertyManager, element, Prefix, var));
+      Parameters.push_back(make_MathFn(floor, fdmex, element, Prefix, var));
     } else if (operation == "ceil") {
-      Parameters.push_back(make_MathFn(ceil, PropertyManager, element, Prefix, var));
+      Parameters.push_back(make_MathFn(ceil, fdmex, element, Prefix, var));
     } else if (operation == "fmod") {
-      auto f = [](const decltype(Parameters)& p)->double {
-                 double y = p[1]->GetValue();
-                 return y != 0.0 ? fmod(p[0]->GetValue(), y) : HUGE_VAL;
-               };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, PropertyManager, element, Prefix, var));
+      auto f = [](double x, double y)->double { return fmod(x, y); };
+      Parameters.push_back(make_GuardedFn(f, fdmex, element, Prefix, var));
     } else if (operation == "atan2") {
-      auto f = [](const decltype(Parameters)& p)->double {
-                 return atan2(p[0]->GetValue(), p[1]->GetValue());
-               };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, PropertyManager, element, Prefix, var));
+      auto f = [](double x, double y)->double { return atan2(x, y); };
+      Parameters.push_back(make_MathFn(f, fdmex, element, Prefix, var));
     } else if (operation == "mod") {
-      auto f = [](const decltype(Parameters)& p)->double {
-                 return static_cast<int>(p[0]->GetValue()) % static_cast<int>(p[1]->GetValue());
+      auto f = [](double x, double y)->double {
+                 return static_cast<int>(x) % static_cast<int>(y);
                };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(make_MathFn(f, fdmex, element, Prefix, var));
     } else if (operation == "fraction") {
-      auto f = [](const decltype(Parameters)& p)->double {
+      auto f = [](double x)->double {
                  double scratch;
-                 return modf(p[0]->GetValue(), &scratch);
+                 return modf(x, &scratch);
                };
-      Parameters.push_back(new aFunc<decltype(f), 1>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(make_MathFn(f, fdmex, element, Prefix, var));
     } else if (operation == "integer") {
-      auto f = [](const decltype(Parameters)& p)->double {
+      auto f = [](double x)->double {
                  double result;
-                 modf(p[0]->GetValue(), &result);
+                 modf(x, &result);
                  return result;
                };
-      Parameters.push_back(new aFunc<decltype(f), 1>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(make_MathFn(f, fdmex, element, Prefix, var));
     } else if (operation == "lt") {
-      auto f = [](const decltype(Parameters)& p)->double {
-                 return p[0]->GetValue() < p[1]->GetValue() ? 1.0 : 0.0;
-               };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, PropertyManager, element, Prefix, var));
+      auto f = [](double x, double y)->double { return x < y ? 1.0 : 0.0; };
+      Parameters.push_back(make_MathFn(f, fdmex, element, Prefix, var));
     } else if (operation == "le") {
-      auto f = [](const decltype(Parameters)& p)->double {
-                 return p[0]->GetValue() <= p[1]->GetValue() ? 1.0 : 0.0;
-               };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, PropertyManager, element, Prefix, var));
+      auto f = [](double x, double y)->double { return x <= y ? 1.0 : 0.0; };
+      Parameters.push_back(make_MathFn(f, fdmex, element, Prefix, var));
     } else if (operation == "gt") {
-      auto f = [](const decltype(Parameters)& p)->double {
-                 return p[0]->GetValue() > p[1]->GetValue() ? 1.0 : 0.0;
-               };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, PropertyManager, element, Prefix, var));
+      auto f = [](double x, double y)->double { return x > y ? 1.0 : 0.0; };
+      Parameters.push_back(make_MathFn(f, fdmex, element, Prefix, var));
     } else if (operation == "ge") {
-      auto f = [](const decltype(Parameters)& p)->double {
-                 return p[0]->GetValue() >= p[1]->GetValue() ? 1.0 : 0.0;
-               };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, PropertyManager, element, Prefix, var));
+      auto f = [](double x, double y)->double { return x >= y ? 1.0 : 0.0; };
+      Parameters.push_back(make_MathFn(f, fdmex, element, Prefix, var));
     } else if (operation == "eq") {
-      auto f = [](const decltype(Parameters)& p)->double {
-                 return p[0]->GetValue() == p[1]->GetValue() ? 1.0 : 0.0;
-               };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, PropertyManager, element, Prefix, var));
+      auto f = [](double x, double y)->double { return x == y ? 1.0 : 0.0; };
+      Parameters.push_back(make_MathFn(f, fdmex, element, Prefix, var));
     } else if (operation == "nq") {
-      auto f = [](const decltype(Parameters)& p)->double {
-                 return p[0]->GetValue() != p[1]->GetValue() ? 1.0 : 0.0;
-               };
-      Parameters.push_back(new aFunc<decltype(f), 2>(f, PropertyManager, element, Prefix, var));
+      auto f = [](double x, double y)->double { return x != y ? 1.0 : 0.0; };
+      Parameters.push_back(make_MathFn(f, fdmex, element, Prefix, var));
     } else if (operation == "not") {
       string ctxMsg = element->ReadFrom();
       auto f = [ctxMsg](const decltype(Parameters)& p)->double {
                  return GetBinary(p[0]->GetValue(), ctxMsg) ? 0.0 : 1.0;
                };
-      Parameters.push_back(new aFunc<decltype(f), 1>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(new aFunc<decltype(f), 1>(f, fdmex, element, Prefix, var,
+                                                     Operation(Operation::Not, ctxMsg)));
     } else if (operation == "ifthen") {
       string ctxMsg = element->ReadFrom();
       auto f = [ctxMsg](const decltype(Parameters)& p)->double {
@@ -504,17 +517,22 @@ void FGFunction::Load(FGPropertyManager* PropertyManager, Element* el,
                  else
                    return p[2]->GetValue();
                };
-      Parameters.push_back(new aFunc<decltype(f), 3>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(new aFunc<decltype(f), 3>(f, fdmex, element, Prefix, var,
+                                                     Operation(Operation::IfThen, ctxMsg)));
     } else if (operation == "random") {
-      auto f = [](const decltype(Parameters)& p)->double {
-                 return GaussianRandomNumber();
+      auto generator(fdmex->GetRandomGenerator());
+      auto f = [generator](const decltype(Parameters)& p)->double {
+                 return generator->GetNormalRandomNumber();
                };
-      Parameters.push_back(new aFunc<decltype(f), 0>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(new aFunc<decltype(f), 0>(f, fdmex, element, Prefix, var,
+                                                     Operation::Random));
     } else if (operation == "urandom") {
-      auto f = [](const decltype(Parameters)& p)->double {
-                 return -1.0 + (((double)rand()/double(RAND_MAX))*2.0);
+      auto generator(fdmex->GetRandomGenerator());
+      auto f = [generator](const decltype(Parameters)& p)->double {
+                 return generator->GetUniformRandomNumber();
                };
-      Parameters.push_back(new aFunc<decltype(f), 0>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(new aFunc<decltype(f), 0>(f, fdmex, element, Prefix, var,
+                                                     Operation::Random));
     } else if (operation == "switch") {
       string ctxMsg = element->ReadFrom();
       auto f = [ctxMsg](const decltype(Parameters)& p)->double {
@@ -539,7 +557,8 @@ void FGFunction::Load(FGPropertyManager* PropertyManager, Element* el,
                    throw("Fatal error");
                  }
                };
-      Parameters.push_back(new aFunc<decltype(f), 2, MaxArgs>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(new aFunc<decltype(f), 2, MaxArgs>(f, fdmex, element, Prefix, var,
+                                                              Operation::Switch));
     } else if (operation == "interpolate1d") {
       auto f = [](const decltype(Parameters)& p)->double {
                  // This is using the bisection algorithm. Special care has been
@@ -575,7 +594,7 @@ void FGFunction::Load(FGPropertyManager* PropertyManager, Element* el,
 
                  return ymin + (x-xmin)*(ymax-ymin)/(xmax-xmin);
                };
-      Parameters.push_back(new aFunc<decltype(f), 5, MaxArgs, OddEven::Odd>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(new aFunc<decltype(f), 5, MaxArgs, OddEven::Odd>(f, fdmex, element, Prefix, var));
     } else if (operation == "rotation_alpha_local") {
       // Calculates local angle of attack for skydiver body component.
       // Euler angles from the intermediate body frame to the local body frame
@@ -598,7 +617,7 @@ void FGFunction::Load(FGPropertyManager* PropertyManager, Element* el,
                  else
                    return atan2(wind_local(eZ), wind_local(eX))*radtodeg;
                };
-      Parameters.push_back(new aFunc<decltype(f), 6>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(new aFunc<decltype(f), 6>(f, fdmex, element, Prefix, var));
     } else if (operation == "rotation_beta_local") {
       // Calculates local angle of sideslip for skydiver body component.
       // Euler angles from the intermediate body frame to the local body frame
@@ -630,7 +649,7 @@ void FGFunction::Load(FGPropertyManager* PropertyManager, Element* el,
 
                  return atan2(wind_local(eY), cosb)*radtodeg;
                };
-      Parameters.push_back(new aFunc<decltype(f), 6>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(new aFunc<decltype(f), 6>(f, fdmex, element, Prefix, var));
     } else if (operation == "rotation_gamma_local") {
       // Calculates local roll angle for skydiver body component.
       // Euler angles from the intermediate body frame to the local body frame
@@ -677,7 +696,7 @@ void FGFunction::Load(FGPropertyManager* PropertyManager, Element* el,
 
                  return atan2(sinc, cosc)*radtodeg;
                };
-      Parameters.push_back(new aFunc<decltype(f), 6>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(new aFunc<decltype(f), 6>(f, fdmex, element, Prefix, var));
     } else if (operation == "rotation_bf_to_wf") {
       // Transforms the input vector from a body frame to a wind frame. The
       // origin of the vector remains the same.
@@ -705,7 +724,7 @@ void FGFunction::Load(FGPropertyManager* PropertyManager, Element* el,
 
                  return r(idx);
                };
-      Parameters.push_back(new aFunc<decltype(f), 7>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(new aFunc<decltype(f), 7>(f, fdmex, element, Prefix, var));
     } else if (operation == "rotation_wf_to_bf") {
       // Transforms the input vector from q wind frame to a body frame. The
       // origin of the vector remains the same.
@@ -734,7 +753,7 @@ void FGFunction::Load(FGPropertyManager* PropertyManager, Element* el,
 
                  return r(idx);
                };
-      Parameters.push_back(new aFunc<decltype(f), 7>(f, PropertyManager, element, Prefix, var));
+      Parameters.push_back(new aFunc<decltype(f), 7>(f, fdmex, element, Prefix, var));
     } else if (operation != "description") {
       cerr << element->ReadFrom() << fgred << highint
            << "Bad operation <" << operation
@@ -743,6 +762,8 @@ void FGFunction::Load(FGPropertyManager* PropertyManager, Element* el,
     element = el->GetNextElement();
   }
 
+  Simplify(fdmex);
+
   bind(el, PropertyManager, Prefix); // Allow any function to save its value
 
   Debug(0);
@@ -750,6 +771,112 @@ void FGFunction::Load(FGPropertyManager* PropertyManager, Element* el,
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGFunction::IsConstant(void) const
+{
+  if (operation.kind == Operation::Random) return false;
+
+  for (auto p: Parameters)
+    if (!p->IsConstant()) return false;
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGFunction::CountNodes(const FGParameter* p)
+{
+  unsigned int n = 1;
+  auto f = dynamic_cast<const FGFunction*>(p);
+
+  if (f) {
+    for (auto param: f->Parameters)
+      n += CountNodes(param);
+  }
+
+  return n;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Simplifies the parameters of the function once they are loaded. Since the
+// parameters have already simplified their own parameters, the whole tree is
+// simplified bottom-up.
+// - The <ifthen> and <switch> operations which condition or index is constant
+//   are replaced by the parameter they select: the other branches are dead.
+// - The constant parameters are replaced by their value.
+// The functions that have a name are tied to a property: they must be kept
+// alive and are therefore never replaced.
+
+void FGFunction::Simplify(FGFDMExec* fdmex)
+{
+  FGFDMExec::FunctionStatistics& stats = fdmex->GetFunctionStatistics();
+
+  stats.nodes += Parameters.size();
+
+  for (auto& p: Parameters) {
+    auto f = dynamic_cast<FGFunction*>(p.ptr());
+
+    if (f && !f->Name.empty()) continue;
+
+    if (f && (f->operation.kind == Operation::IfThen
+              || f->operation.kind == Operation::Switch)
+        && f->Parameters[0]->IsConstant()) {
+      FGParameter_ptr live;
+
+      try {
+        switch (f->operation.kind) {
+        case Operation::IfThen:
+          live = f->Parameters[GetBinary(f->Parameters[0]->GetValue(),
+                                         f->operation.ctxMsg) ? 1 : 2];
+          break;
+        case Operation::Switch:
+          {
+            double index = f->Parameters[0]->GetValue();
+            size_t i = static_cast<size_t>(index+0.5);
+            // Out of range indices are reported at run time.
+            if (index >= 0.0 && i < f->Parameters.size()-1)
+              live = f->Parameters[i+1];
+          }
+          break;
+        default:
+          break;
+        }
+      } catch (...) {
+        // The malformed conditions are reported at run time.
+      }
+
+      if (live) {
+        stats.eliminated += CountNodes(f) - CountNodes(live);
+        p = live;
+        f = dynamic_cast<FGFunction*>(p.ptr());
+        if (f && !f->Name.empty()) continue;
+      }
+    }
+
+    if (p->IsConstant() && !dynamic_cast<FGRealValue*>(p.ptr())) {
+      try {
+        double value = p->GetValue();
+        stats.folded++;
+        stats.eliminated += CountNodes(p) - 1;
+        p = new FGRealValue(value);
+      } catch (...) {
+        // The error will be raised again at run time.
+      }
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFunction::Compile(FGFDMExec* fdmex)
+{
+  if (fdmex->GetCompileFunctions())
+    Program.reset(new FGFunctionProgram(Parameters[0]));
+  else
+    Program.reset();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFunction::cacheValue(bool cache)
 {
   cached = false; // Must set cached to false prior to calling GetValue(), else
@@ -759,18 +886,50 @@ void FGFunction::cacheValue(bool cache)
     cached = true;
   }
 }
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFunction::SerializeState(FGStateArchive& archive)
+{
+  archive.Sync(cached, cachedValue);
+}
   
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGFunction::GetDependencies(vector<FGPropertyNode*>& nodes) const
+{
+  if (operation.kind == Operation::Random) return false;
+
+  for (auto p: Parameters)
+    if (!p->GetDependencies(nodes)) return false;
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 double FGFunction::GetValue(void) const
 {
   if (cached) return cachedValue;
 
-  double val = Parameters[0]->GetValue();
+  if (!Inputs.IsResolved()) {
+    lastValue = Program ? Program->Execute() : Parameters[0]->GetValue();
+    Inputs.Track(Parameters[0]);
+    Inputs.Changed();
+  } else {
+    try {
+      if (Inputs.Changed())
+        lastValue = Program ? Program->Execute() : Parameters[0]->GetValue();
+    } catch (...) {
+      // Make sure the error is raised again at the next evaluation.
+      Inputs.Invalidate();
+      throw;
+    }
+  }
 
-  if (pCopyTo) pCopyTo->setDoubleValue(val);
+  if (pCopyTo) pCopyTo->setDoubleValue(lastValue);
 
-  return val;
+  return lastValue;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -34,10 +34,13 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <memory>
 #include <vector>
 #include <string>
 #include "FGParameter.h"
+#include "FGFunctionProgram.h"
 #include "input_output/FGPropertyManager.h"
+#include "input_output/FGPropertyDependencies.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -47,6 +50,8 @@ namespace JSBSim {
 
 class Element;
 class FGPropertyValue;
+class FGFDMExec;
+class FGStateArchive;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -156,6 +161,19 @@ an operation (such as sum) which can contain other items. The point to keep in
 mind is that it evaluates to a single value - which is just what the trigonometric
 functions require (except atan2, which takes two arguments).
 
+Once loaded, the tree of operations is simplified: the operations which
+arguments are all constant (values or properties flagged as constant such as
+metrics/bw-ft) are replaced by their result and the branches of <ifthen> and
+<switch> that can never be selected are removed. The tree is then compiled
+into a flat program (see FGFunctionProgram). The tree interpreter remains available for debugging: it is used
+when the environment variable JSBSIM_FUNCTION_INTERPRETER is set to a non zero
+value.
+
+The value of a top-level function is memoized: the function records the
+properties it reads and is only evaluated again when one of them has changed
+(see FGPropertyDependencies). The functions that draw random numbers or that
+call a template function are always evaluated.
+
 <h2>Specific Function Definitions</h2>
 
 Note: In the definitions below, a "property" refers to a single property specified
@@ -722,7 +740,8 @@ class FGFunction : public FGParameter, public FGJSBBase
 public:
   /// Default constructor.
   FGFunction()
-    : cached(false), cachedValue(-HUGE_VAL), pCopyTo(nullptr) {}
+    : cached(false), cachedValue(-HUGE_VAL), pCopyTo(nullptr),
+      lastValue(-HUGE_VAL) { Inputs.Disable(); }
 
   /** Constructor.
     When this constructor is called, the XML element pointed to in memory by the
@@ -735,14 +754,14 @@ public:
     so on. At runtime, each object evaluates its child parameters, which each
     may have its own child parameters to evaluate.
 
-    @param PropertyManager a pointer to the property manager instance.
+    @param fdmex a pointer to the FGFDMExec instance.
     @param element a pointer to the Element object containing the function
                    definition.
     @param prefix an optional prefix to prepend to the name given to the
                   property that represents this function (if given).
 */
-  FGFunction(FGPropertyManager* PropertyManager, Element* element,
-             const std::string& prefix="", FGPropertyValue* var=0L);
+  FGFunction(FGFDMExec* fdmex, Element* element, const std::string& prefix="",
+             FGPropertyValue* var=0L);
 
 /** Retrieves the value of the function object.
     @return the total value of the function. */
@@ -755,6 +774,16 @@ public:
 /// Retrieves the name of the function.
   std::string GetName(void) const {return Name;}
 
+/** Returns true if the function only depends on constant parameters. The
+    functions that draw random numbers are never constant. */
+  bool IsConstant(void) const;
+
+  bool GetDependencies(std::vector<FGPropertyNode*>& nodes) const;
+
+/** Returns true if the value of the function is memoized i.e. it is only
+    evaluated again when one of the properties it depends on has changed. */
+  bool IsMemoized(void) const { return Inputs.IsTracked(); }
+
 /** Specifies whether to cache the value of the function, so it is calculated only
     once per frame.
     If shouldCache is true, then the value of the function is calculated, and
@@ -763,15 +792,50 @@ public:
     @param shouldCache specifies whether the function should cache the computed value. */
   void cacheValue(bool shouldCache);
 
+/// Saves or restores the value cached for the current frame.
+  void SerializeState(FGStateArchive& archive);
+
   enum class OddEven {Either, Odd, Even};
 
+  /** Describes the operation applied by a function to its parameters. This
+      is used by FGFunctionProgram to translate the function into bytecode:
+      the operations that are not described (Opaque) are evaluated by calling
+      their GetValue() method. */
+  struct Operation {
+    enum Kind {Opaque, Random, Sum, Product, Difference, Avg, Min, Max, And,
+               Or, Not, IfThen, Switch, Unary, Binary, Guarded};
+
+    Operation(Kind k=Opaque, const std::string& ctx="")
+      : kind(k), unary(nullptr), binary(nullptr), ctxMsg(ctx) {}
+    Operation(double (*fn)(double))
+      : kind(Unary), unary(fn), binary(nullptr) {}
+    /** Binary operation. A Guarded operation evaluates its second argument
+        first and only evaluates its first argument when the second one is not
+        null. It returns HUGE_VAL otherwise. */
+    Operation(double (*fn)(double, double), Kind k=Binary)
+      : kind(k), unary(nullptr), binary(fn) {}
+
+    Kind kind;
+    double (*unary)(double);
+    double (*binary)(double, double);
+    std::string ctxMsg; // Context of the error messages of logical operations
+  };
+
+  /// Returns true if the function is evaluated by a compiled program.
+  bool IsCompiled(void) const { return Program != nullptr; }
+
 protected:
   bool cached;
   double cachedValue;
   std::vector <FGParameter_ptr> Parameters;
-
-  void Load(FGPropertyManager* PropertyManager, Element* element,
-            FGPropertyValue* var, const std::string& prefix="");
+  Operation operation;
+
+  void Load(FGFDMExec* fdmex, Element* element, FGPropertyValue* var,
+            const std::string& prefix="");
+  /** Translates the function into a program unless the tree interpreter has
+      been requested (see FGFDMExec::SetCompileFunctions). */
+  void Compile(FGFDMExec* fdmex);
+  static bool GetBinary(double val, const std::string& ctxMsg);
   virtual void bind(Element*, FGPropertyManager*, const std::string&);
   void CheckMinArguments(Element* el, unsigned int _min);
   void CheckMaxArguments(Element* el, unsigned int _max);
@@ -780,8 +844,15 @@ protected:
 private:
   std::string Name;
   FGPropertyNode_ptr pCopyTo; // Property node for CopyTo property string
+  std::unique_ptr<FGFunctionProgram> Program;
+  mutable FGPropertyDependencies Inputs;
+  mutable double lastValue;
 
+  void Simplify(FGFDMExec* fdmex);
+  static unsigned int CountNodes(const FGParameter* p);
   void Debug(int from);
+
+  friend class FGFunctionProgram;
 };
 
 } // namespace JSBSim
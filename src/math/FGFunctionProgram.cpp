@@ -0,0 +1,351 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGFunctionProgram.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+ Purpose:      Evaluates functions from a flat list of instructions
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/2026   Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cmath>
+
+#include "FGFunctionProgram.h"
+#include "FGFunction.h"
+#include "FGRealValue.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGFunctionProgram::FGFunctionProgram(const FGParameter* root)
+  : NumFolded(0)
+{
+  Result = Emit(root);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGFunctionProgram::NewRegister(double value)
+{
+  Registers.push_back(value);
+  return Registers.size()-1;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGFunctionProgram::Add(OpCode op, unsigned int dst,
+                                    unsigned int arg0, unsigned int arg1)
+{
+  Instruction instr;
+  instr.op = op;
+  instr.dst = dst;
+  instr.arg0 = arg0;
+  instr.arg1 = arg1;
+  instr.node = nullptr;
+  Code.push_back(instr);
+  return Code.size()-1;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// A parameter is pure when its evaluation has no side effect i.e. it does not
+// draw random numbers. Only pure parameters can be evaluated in a different
+// order than the tree does.
+
+bool FGFunctionProgram::IsPure(const FGParameter* node)
+{
+  auto f = dynamic_cast<const FGFunction*>(node);
+  if (!f) return true;
+  if (f->operation.kind == FGFunction::Operation::Random) return false;
+
+  for (auto p: f->Parameters)
+    if (!IsPure(p)) return false;
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGFunctionProgram::EmitArguments(const FGFunction* f)
+{
+  vector<unsigned int> args;
+
+  for (auto p: f->Parameters)
+    args.push_back(Emit(p));
+
+  unsigned int first = Arguments.size();
+  Arguments.insert(Arguments.end(), args.begin(), args.end());
+  return first;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Emits the instructions that evaluate 'node' and returns the register where
+// its value is stored.
+
+unsigned int FGFunctionProgram::Emit(const FGParameter* node)
+{
+  typedef FGFunction::Operation Operation;
+
+  auto f = dynamic_cast<const FGFunction*>(node);
+
+  if (!f) {
+    if (dynamic_cast<const FGRealValue*>(node))
+      return NewRegister(node->GetValue());
+
+    // Properties, tables, etc.
+    unsigned int dst = NewRegister();
+    Code[Add(OpCode::Call, dst)].node = node;
+    return dst;
+  }
+
+  if (f->IsConstant()) {
+    try {
+      double value = f->GetValue();
+      ++NumFolded;
+      return NewRegister(value);
+    } catch (...) {
+      // The error will be raised again at run time.
+    }
+  }
+
+  const vector<FGParameter_ptr>& p = f->Parameters;
+  unsigned int dst;
+
+  switch (f->operation.kind) {
+  case Operation::Sum:
+  case Operation::Product:
+  case Operation::Difference:
+  case Operation::Avg:
+  case Operation::Min:
+  case Operation::Max:
+    {
+      static const OpCode opcodes[] = {OpCode::Sum, OpCode::Product,
+                                       OpCode::Difference, OpCode::Avg,
+                                       OpCode::Min, OpCode::Max};
+      unsigned int first = EmitArguments(f);
+      dst = NewRegister();
+      Add(opcodes[f->operation.kind - Operation::Sum], dst, first, p.size());
+    }
+    break;
+  case Operation::Unary:
+    {
+      unsigned int x = Emit(p[0]);
+      dst = NewRegister();
+      Code[Add(OpCode::Unary, dst, x)].unary = f->operation.unary;
+    }
+    break;
+  case Operation::Binary:
+    {
+      unsigned int x = Emit(p[0]);
+      unsigned int y = Emit(p[1]);
+      dst = NewRegister();
+      Code[Add(OpCode::Binary, dst, x, y)].binary = f->operation.binary;
+    }
+    break;
+  case Operation::Guarded:
+    // The tree skips the evaluation of the first argument when the second is
+    // null: the program can only evaluate both if the first one is pure.
+    if (!IsPure(p[0])) {
+      dst = NewRegister();
+      Code[Add(OpCode::Call, dst)].node = f;
+    }
+    else {
+      unsigned int y = Emit(p[1]);
+      unsigned int x = Emit(p[0]);
+      dst = NewRegister();
+      Code[Add(OpCode::Guarded, dst, x, y)].binary = f->operation.binary;
+    }
+    break;
+  case Operation::Not:
+    {
+      unsigned int x = Emit(p[0]);
+      dst = NewRegister();
+      Code[Add(OpCode::Not, dst, x)].ctxMsg = &f->operation.ctxMsg;
+    }
+    break;
+  case Operation::And:
+  case Operation::Or:
+    {
+      // The evaluation stops as soon as the result is known.
+      OpCode jump = f->operation.kind == Operation::And ? OpCode::JumpIfFalse
+                                                         : OpCode::JumpIfTrue;
+      double shortcut = f->operation.kind == Operation::And ? 0.0 : 1.0;
+      vector<unsigned int> jumps;
+
+      dst = NewRegister();
+      for (auto param: p) {
+        unsigned int x = Emit(param);
+        unsigned int j = Add(jump, dst, x);
+        Code[j].ctxMsg = &f->operation.ctxMsg;
+        jumps.push_back(j);
+      }
+      Code[Add(OpCode::Set, dst)].value = 1.0 - shortcut;
+      unsigned int end = Add(OpCode::Jump, dst);
+      for (auto j: jumps)
+        Code[j].arg1 = Code.size();
+      Code[Add(OpCode::Set, dst)].value = shortcut;
+      Code[end].arg1 = Code.size();
+    }
+    break;
+  case Operation::IfThen:
+    {
+      unsigned int cond = Emit(p[0]);
+      unsigned int jelse = Add(OpCode::JumpIfFalse, 0, cond);
+      Code[jelse].ctxMsg = &f->operation.ctxMsg;
+      unsigned int x = Emit(p[1]);
+      unsigned int move = Add(OpCode::Move, 0, x);
+      unsigned int end = Add(OpCode::Jump, 0);
+      Code[jelse].arg1 = Code.size();
+      unsigned int y = Emit(p[2]);
+      dst = NewRegister();
+      Add(OpCode::Move, dst, y);
+      Code[move].dst = dst;
+      Code[end].arg1 = Code.size();
+    }
+    break;
+  default:
+    // Opaque operations and random number generators.
+    dst = NewRegister();
+    Code[Add(OpCode::Call, dst)].node = f;
+    break;
+  }
+
+  return dst;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGFunctionProgram::Execute(void) const
+{
+  double* reg = Registers.data();
+  const unsigned int* args = Arguments.data();
+  const Instruction* code = Code.data();
+  const size_t size = Code.size();
+  size_t pc = 0;
+
+  while (pc < size) {
+    const Instruction& instr = code[pc++];
+
+    switch(instr.op) {
+    case OpCode::Call:
+      reg[instr.dst] = instr.node->GetValue();
+      break;
+    case OpCode::Unary:
+      reg[instr.dst] = instr.unary(reg[instr.arg0]);
+      break;
+    case OpCode::Binary:
+      reg[instr.dst] = instr.binary(reg[instr.arg0], reg[instr.arg1]);
+      break;
+    case OpCode::Guarded:
+      {
+        double y = reg[instr.arg1];
+        reg[instr.dst] = y != 0.0 ? instr.binary(reg[instr.arg0], y) : HUGE_VAL;
+      }
+      break;
+    case OpCode::Sum:
+    case OpCode::Avg:
+      {
+        const unsigned int* a = args + instr.arg0;
+        double temp = 0.0;
+        for (unsigned int i=0; i < instr.arg1; ++i)
+          temp += reg[a[i]];
+        reg[instr.dst] = instr.op == OpCode::Sum ? temp : temp / instr.arg1;
+      }
+      break;
+    case OpCode::Product:
+      {
+        const unsigned int* a = args + instr.arg0;
+        double temp = 1.0;
+        for (unsigned int i=0; i < instr.arg1; ++i)
+          temp *= reg[a[i]];
+        reg[instr.dst] = temp;
+      }
+      break;
+    case OpCode::Difference:
+      {
+        const unsigned int* a = args + instr.arg0;
+        double temp = reg[a[0]];
+        for (unsigned int i=1; i < instr.arg1; ++i)
+          temp -= reg[a[i]];
+        reg[instr.dst] = temp;
+      }
+      break;
+    case OpCode::Min:
+      {
+        const unsigned int* a = args + instr.arg0;
+        double _min = HUGE_VAL;
+        for (unsigned int i=0; i < instr.arg1; ++i) {
+          double x = reg[a[i]];
+          if (x < _min)
+            _min = x;
+        }
+        reg[instr.dst] = _min;
+      }
+      break;
+    case OpCode::Max:
+      {
+        const unsigned int* a = args + instr.arg0;
+        double _max = -HUGE_VAL;
+        for (unsigned int i=0; i < instr.arg1; ++i) {
+          double x = reg[a[i]];
+          if (x > _max)
+            _max = x;
+        }
+        reg[instr.dst] = _max;
+      }
+      break;
+    case OpCode::Not:
+      reg[instr.dst] = FGFunction::GetBinary(reg[instr.arg0], *instr.ctxMsg)
+                       ? 0.0 : 1.0;
+      break;
+    case OpCode::Set:
+      reg[instr.dst] = instr.value;
+      break;
+    case OpCode::Move:
+      reg[instr.dst] = reg[instr.arg0];
+      break;
+    case OpCode::Jump:
+      pc = instr.arg1;
+      break;
+    case OpCode::JumpIfFalse:
+      if (!FGFunction::GetBinary(reg[instr.arg0], *instr.ctxMsg))
+        pc = instr.arg1;
+      break;
+    case OpCode::JumpIfTrue:
+      if (FGFunction::GetBinary(reg[instr.arg0], *instr.ctxMsg))
+        pc = instr.arg1;
+      break;
+    }
+  }
+
+  return reg[Result];
+}
+}
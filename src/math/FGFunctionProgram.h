@@ -0,0 +1,135 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGFunctionProgram.h
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/2026   Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGFUNCTIONPROGRAM_H
+#define FGFUNCTIONPROGRAM_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <string>
+#include <vector>
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGParameter;
+class FGFunction;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Evaluates a function from a flat list of instructions.
+    The tree of FGParameter objects built by FGFunction is translated into a
+    linear program which instructions read their operands from and store their
+    result to a contiguous array of registers. The evaluation of a function
+    then no longer requires a virtual call and a pointer dereference per node
+    of the tree, which improves the cache locality of the evaluation.
+
+    - The values (<tt>&lt;v&gt;</tt>, <tt>&lt;pi&gt;</tt>) are stored in
+      registers once for all. The operations which parameters are all constant
+      (see FGParameter::IsConstant) are evaluated once at compile time and
+      replaced by their result.
+    - The arithmetic, mathematical, comparison and logical operations are
+      translated into instructions. The logical operations (<tt>and</tt>,
+      <tt>or</tt>, <tt>ifthen</tt>) use jumps so that their parameters are
+      evaluated as lazily as in the tree.
+    - The properties, the tables and the other operations are evaluated by
+      calling their GetValue() method.
+
+    The program produces exactly the same results as the tree.
+
+    @author The JSBSim team
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGFunctionProgram
+{
+public:
+  /** Constructor.
+      @param root the parameter which value is computed by the program. */
+  explicit FGFunctionProgram(const FGParameter* root);
+
+  /// Evaluates the program and returns its result.
+  double Execute(void) const;
+
+  /// Returns the number of instructions of the program.
+  size_t GetNumInstructions(void) const { return Code.size(); }
+
+  /// Returns the number of operations that have been folded into a constant.
+  unsigned int GetNumFoldedOperations(void) const { return NumFolded; }
+
+private:
+  enum class OpCode : unsigned char {Call, Unary, Binary, Guarded, Sum,
+                                     Product, Difference, Avg, Min, Max, Not,
+                                     Set, Move, Jump, JumpIfFalse, JumpIfTrue};
+
+  struct Instruction {
+    OpCode op;
+    unsigned int dst;   // Register receiving the result
+    unsigned int arg0;  // First operand: register or index in Arguments
+    unsigned int arg1;  // Second operand: register, number of arguments or
+                        // jump target
+    union {
+      double (*unary)(double);
+      double (*binary)(double, double);
+      const FGParameter* node;  // Call
+      const std::string* ctxMsg; // Not, JumpIfFalse, JumpIfTrue
+      double value;             // Set
+    };
+  };
+
+  std::vector<Instruction> Code;
+  std::vector<unsigned int> Arguments;
+  mutable std::vector<double> Registers;
+  unsigned int Result;
+  unsigned int NumFolded;
+
+  unsigned int Emit(const FGParameter* node);
+  unsigned int EmitArguments(const FGFunction* f);
+  unsigned int NewRegister(double value=0.0);
+  unsigned int Add(OpCode op, unsigned int dst, unsigned int arg0=0,
+                   unsigned int arg1=0);
+  static bool IsPure(const FGParameter* node);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
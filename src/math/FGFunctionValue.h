@@ -65,6 +65,8 @@ public:
     :FGPropertyValue(propName, propertyManager), function(f) {}
 
   double GetValue(void) const { return function->GetValue(GetNode()); }
+  bool IsConstant(void) const { return false; }
+  bool GetDependencies(std::vector<FGPropertyNode*>&) const { return false; }
 
   std::string GetName(void) const {
     return function->GetName() + "(" + FGPropertyValue::GetName() + ")";
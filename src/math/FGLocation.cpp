@@ -47,15 +47,12 @@ INCLUDES
 
 namespace JSBSim {
 
-// Set up the default ground callback object.
-FGGroundCallback_ptr FGLocation::GroundCallback = NULL;
-
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 FGLocation::FGLocation(void)
-  : mECLoc(1.0, 0.0, 0.0), mCacheValid(false)
+  : mECLoc(1.0, 0.0, 0.0), mCacheValid(false), GroundCallback(nullptr)
 {
   e2 = c = 0.0;
   a = ec = ec2 = 1.0;
@@ -75,7 +72,7 @@ FGLocation::FGLocation(void)
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 FGLocation::FGLocation(double lon, double lat, double radius)
-  : mCacheValid(false)
+  : mCacheValid(false), GroundCallback(nullptr)
 {
   e2 = c = 0.0;
   a = ec = ec2 = 1.0;
@@ -103,7 +100,7 @@ FGLocation::FGLocation(double lon, double lat, double radius)
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 FGLocation::FGLocation(const FGColumnVector3& lv)
-  : mECLoc(lv), mCacheValid(false)
+  : mECLoc(lv), mCacheValid(false), GroundCallback(nullptr)
 {
   e2 = c = 0.0;
   a = ec = ec2 = 1.0;
@@ -123,7 +120,8 @@ FGLocation::FGLocation(const FGColumnVector3& lv)
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 FGLocation::FGLocation(const FGLocation& l)
-  : mECLoc(l.mECLoc), mCacheValid(l.mCacheValid)
+  : mECLoc(l.mECLoc), mCacheValid(l.mCacheValid),
+    GroundCallback(l.GroundCallback)
 {
   a = l.a;
   e2 = l.e2;
@@ -161,6 +159,7 @@ const FGLocation& FGLocation::operator=(const FGLocation& l)
 {
   mECLoc = l.mECLoc;
   mCacheValid = l.mCacheValid;
+  if (!GroundCallback) GroundCallback = l.GroundCallback;
 
   a = l.a;
   e2 = l.e2;
@@ -318,9 +318,9 @@ public:
   /** @name Functions that rely on the ground callback
       The following functions allow to set and get the vehicle position above
       the sea or the ground. The sea and the ground levels are obtained by
-      interrogating an FGGroundCallback instance. A ground callback must
-      therefore be set with SetGroundCallback() before calling any of these
-      functions. */
+      interrogating an FGGroundCallback instance. The location must therefore
+      be bound to a ground callback with SetGroundCallback() before calling
+      any of these functions. */
   ///@{
   /** Set the altitude above sea level.
       @param altitudeASL altitude above Sea Level in feet.
@@ -338,25 +338,26 @@ public:
       @return the sea level radius at the location in feet.
       @see SetGroundCallback */
   double GetSeaLevelRadius(void) const
-  { ComputeDerived(); return GroundCallback->GetSeaLevelRadius(*this); }
+  { ComputeDerived(); return (*GroundCallback)->GetSeaLevelRadius(*this); }
 
   /** Get the local terrain radius
       @return the terrain level radius at the location in feet.
       @see SetGroundCallback */
   double GetTerrainRadius(void) const
-  { ComputeDerived(); return GroundCallback->GetTerrainGeoCentRadius(*this); }
+  { ComputeDerived(); return (*GroundCallback)->GetTerrainGeoCentRadius(*this); }
 
   /** Get the altitude above sea level.
       @return the altitude ASL in feet.
       @see SetGroundCallback */
   double GetAltitudeASL(void) const
-  { ComputeDerived(); return GroundCallback->GetAltitude(*this); }
+  { ComputeDerived(); return (*GroundCallback)->GetAltitude(*this); }
 
   /** Get the altitude above ground level.
       @return the altitude AGL in feet.
       @see SetGroundCallback */
   double GetAltitudeAGL(void) const {
     FGLocation c;
+    c.GroundCallback = GroundCallback;
     FGColumnVector3 n,v,w;
     return GetContactPoint(c,n,v,w);
   }
@@ -370,31 +371,40 @@ public:
       @see SetGroundCallback */
   double GetContactPoint(FGLocation& contact, FGColumnVector3& normal,
                          FGColumnVector3& v, FGColumnVector3& w) const
-  { ComputeDerived(); return GroundCallback->GetAGLevel(*this, contact, normal, v, w); }
+  {
+    ComputeDerived();
+    return (*GroundCallback)->GetAGLevel(*this, contact, normal, v, w);
+  }
   ///@}
 
-  /** Sets the ground callback pointer. The FGGroundCallback instance will be
-      interrogated by FGLocation each time some terrain informations are needed.
-      This will mainly occur when altitudes above the sea level or above the
-      ground level are needed. A 'smart pointer' is used internally to prevent
-      the FGGroundCallback instance against accidental deletion. This can only
-      work if the calling application also make use of FGGroundCallback_ptr
-      'smart pointers' to manage their copy of the ground callback.
-      @param gc A pointer to a ground callback object
+  /** Binds the location to a ground callback. The FGGroundCallback instance
+      will be interrogated by FGLocation each time some terrain informations
+      are needed. This will mainly occur when altitudes above the sea level or
+      above the ground level are needed. The location refers to the smart
+      pointer which holds the ground callback (normally the one of
+      FGFDMExec), so that it follows the changes of the ground callback. The
+      smart pointer must outlive the location.
+
+      The copies of the location and the locations computed from it are bound
+      to the same ground callback. A location which is already bound keeps
+      its ground callback when another location is assigned to it.
+      @param gc A pointer to the smart pointer of a ground callback object
       @see FGGroundCallback
    */
-  static void SetGroundCallback(FGGroundCallback* gc) { GroundCallback = gc; }
+  void SetGroundCallback(const FGGroundCallback_ptr* gc) { GroundCallback = gc; }
 
-  /** Get a pointer to the ground callback currently used. Since the
+  /** Get a pointer to the ground callback used by the location. Since the
       FGGroundcallback instance might have been created outside JSBSim, it is
       recommanded to store the returned pointer in a 'smart pointer'
       FGGroundCallback_ptr. This pointer maintains a reference counter and
       protects the returned pointer against an accidental deletion of the object
       it is pointing to.
-      @return A pointer to the current ground callback object.
+      @return A pointer to the ground callback object or null if the location
+              is not bound to a ground callback.
       @see FGGroundCallback
    */
-  static FGGroundCallback* GetGroundCallback(void) { return GroundCallback; }
+  FGGroundCallback* GetGroundCallback(void) const
+  { return GroundCallback ? GroundCallback->ptr() : nullptr; }
 
   /** Transform matrix from local horizontal to earth centered frame.
       @return a const reference to the rotation matrix of the transform from
@@ -458,7 +468,10 @@ public:
       @param lvec Vector in the local horizontal coordinate frame
       @return The location in the earth centered and fixed frame */
   FGLocation LocalToLocation(const FGColumnVector3& lvec) const {
-    ComputeDerived(); return mTl2ec*lvec + mECLoc;
+    ComputeDerived();
+    FGLocation l(mTl2ec*lvec + mECLoc);
+    l.GroundCallback = GroundCallback;
+    return l;
   }
 
   /** Conversion from a location in the earth centered and fixed frame
@@ -582,14 +595,18 @@ public:
       A new object is returned that defines a position which is the sum of the
       cartesian coordinates of the two positions provided. */
   FGLocation operator+(const FGLocation& l) const {
-    return FGLocation(mECLoc + l.mECLoc);
+    FGLocation result(mECLoc + l.mECLoc);
+    result.GroundCallback = GroundCallback;
+    return result;
   }
 
   /** This operator substracts two ECEF position vectors.
       A new object is returned that defines a position which is the difference
       of the cartesian coordinates of the two positions provided. */
   FGLocation operator-(const FGLocation& l) const {
-    return FGLocation(mECLoc - l.mECLoc);
+    FGLocation result(mECLoc - l.mECLoc);
+    result.GroundCallback = GroundCallback;
+    return result;
   }
 
   /** This operator scales an ECEF position vector.
@@ -597,7 +614,9 @@ public:
       coordinates of the provided ECEF position scaled by the supplied scalar
       value. */
   FGLocation operator*(double scalar) const {
-    return FGLocation(scalar*mECLoc);
+    FGLocation result(scalar*mECLoc);
+    result.GroundCallback = GroundCallback;
+    return result;
   }
 
   /** Cast to a simple 3d vector */
@@ -663,8 +682,9 @@ private:
       allowed to change during a const member function. */
   mutable bool mCacheValid;
 
-  /** The ground callback object pointer */
-  static FGGroundCallback_ptr GroundCallback;
+  /** The smart pointer of the ground callback to which the location is
+      bound. */
+  const FGGroundCallback_ptr* GroundCallback;
 };
 
 /** Scalar multiplication.
@@ -43,7 +43,9 @@ INCLUDES
 
 #include "FGModelFunctions.h"
 #include "FGFunction.h"
+#include "FGFDMExec.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGStateArchive.h"
 
 using namespace std;
 
@@ -72,17 +74,17 @@ bool FGModelFunctions::InitModel(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-bool FGModelFunctions::Load(Element* el, FGPropertyManager* PM, string prefix)
+bool FGModelFunctions::Load(Element* el, FGFDMExec* fdmex, string prefix)
 {
-  LocalProperties.Load(el, PM, false);
-  PreLoad(el, PM, prefix);
+  LocalProperties.Load(el, fdmex->GetPropertyManager(), false);
+  PreLoad(el, fdmex, prefix);
 
   return true; // TODO: Need to make this value mean something.
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-void FGModelFunctions::PreLoad(Element* el, FGPropertyManager* PM, string prefix)
+void FGModelFunctions::PreLoad(Element* el, FGFDMExec* fdmex, string prefix)
 {
   // Load model post-functions, if any
 
@@ -91,7 +93,7 @@ void FGModelFunctions::PreLoad(Element* el, FGPropertyManager* PM, string prefix
   while (function) {
     string fType = function->GetAttributeValue("type");
     if (fType.empty() || fType == "pre")
-      PreFunctions.push_back(new FGFunction(PM, function, prefix));
+      PreFunctions.push_back(new FGFunction(fdmex, function, prefix));
 
     function = el->FindNextElement("function");
   }
@@ -99,14 +101,14 @@ void FGModelFunctions::PreLoad(Element* el, FGPropertyManager* PM, string prefix
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-void FGModelFunctions::PostLoad(Element* el, FGPropertyManager* PM, string prefix)
+void FGModelFunctions::PostLoad(Element* el, FGFDMExec* fdmex, string prefix)
 {
   // Load model post-functions, if any
 
   Element *function = el->FindElement("function");
   while (function) {
     if (function->GetAttributeValue("type") == "post") {
-      PostFunctions.push_back(new FGFunction(PM, function, prefix));
+      PostFunctions.push_back(new FGFunction(fdmex, function, prefix));
     }
     function = el->FindNextElement("function");
   }
@@ -142,6 +144,16 @@ void FGModelFunctions::RunPostFunctions(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGModelFunctions::SerializeState(FGStateArchive& archive)
+{
+  archive.SyncCount(PreFunctions.size() + PostFunctions.size(), "functions");
+
+  for (auto f: PreFunctions) f->SerializeState(archive);
+  for (auto f: PostFunctions) f->SerializeState(archive);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 FGFunction* FGModelFunctions::GetPreFunction(const std::string& name)
 {
   FGFunction* result;
@@ -206,4 +218,15 @@ string FGModelFunctions::GetFunctionValues(const string& delimeter) const
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGModelFunctions::GetFunctionValues(vector<double>& values) const
+{
+  for (auto function: PreFunctions)
+    values.push_back(function->GetValue());
+
+  for (auto function: PostFunctions)
+    values.push_back(function->GetValue());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 }
@@ -50,6 +50,8 @@ namespace JSBSim {
 class FGFunction;
 class Element;
 class FGPropertyManager;
+class FGFDMExec;
+class FGStateArchive;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -78,9 +80,9 @@ public:
   virtual ~FGModelFunctions();
   void RunPreFunctions(void);
   void RunPostFunctions(void);
-  bool Load(Element* el, FGPropertyManager* PropertyManager, std::string prefix="");
-  void PreLoad(Element* el, FGPropertyManager* PropertyManager, std::string prefix="");
-  void PostLoad(Element* el, FGPropertyManager* PropertyManager, std::string prefix="");
+  bool Load(Element* el, FGFDMExec* fdmex, std::string prefix="");
+  void PreLoad(Element* el, FGFDMExec* fdmex, std::string prefix="");
+  void PostLoad(Element* el, FGFDMExec* fdmex, std::string prefix="");
 
   /** Gets the strings for the current set of functions.
       @param delimeter either a tab or comma string depending on output type
@@ -93,12 +95,20 @@ public:
       functions */
   std::string GetFunctionValues(const std::string& delimeter) const;
 
+  /** Gets the function values as numbers.
+      @param values the vector to which the values are appended, in the same
+                    order as the values of GetFunctionValues(). */
+  void GetFunctionValues(std::vector<double>& values) const;
+
   /** Get one of the "pre" function
       @param name the name of the requested function.
       @return a pointer to the function (NULL if not found)
    */
   FGFunction* GetPreFunction(const std::string& name);
 
+  /// Saves or restores the values of the functions cached for the frame.
+  virtual void SerializeState(FGStateArchive& archive);
+
 protected:
   std::vector <FGFunction*> PreFunctions;
   std::vector <FGFunction*> PostFunctions;
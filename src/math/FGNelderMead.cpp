@@ -35,8 +35,10 @@ FGNelderMead::FGNelderMead(Function * f, const std::vector<double> & initialGues
                            const std::vector<double> & initialStepSize, int iterMax,
                            double rtol, double abstol, double speed, double randomization,
                            bool showConvergeStatus,
-                           bool showSimplex, bool pause, Callback * callback) :
-        m_f(f), m_callback(callback), m_randomization(randomization),
+                           bool showSimplex, bool pause, Callback * callback,
+                           std::shared_ptr<RandomNumberGenerator> generator) :
+        m_f(f), m_callback(callback), m_generator(generator),
+        m_randomization(randomization),
         m_lowerBound(lowerBound), m_upperBound(upperBound),
         m_nDim(initialGuess.size()), m_nVert(m_nDim+1),
         m_iMax(1), m_iNextMax(1), m_iMin(1),
@@ -48,7 +50,9 @@ FGNelderMead::FGNelderMead(Function * f, const std::vector<double> & initialGues
         pause(pause), rtolI(), minCostPrevResize(1), minCost(), minCostPrev(), maxCost(),
         nextMaxCost()
 {
-    srand ( time(NULL) ); // seed random number generator
+    // without a generator, seed a private one from the clock
+    if (!m_generator)
+        m_generator = std::make_shared<RandomNumberGenerator>(time(NULL));
 }
 
 void FGNelderMead::update()
@@ -256,7 +260,7 @@ int FGNelderMead::status()
 
 double FGNelderMead::getRandomFactor()
 {
-    double randFact = 1+(float(rand() % 1000)/500-1)*m_randomization;
+    double randFact = 1+m_generator->GetUniformRandomNumber()*m_randomization;
     //std::cout << "random factor: " << randFact << std::endl;;
     return randFact;
 }
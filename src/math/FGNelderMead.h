@@ -22,6 +22,9 @@
 #include <vector>
 #include <limits>
 #include <cstddef>
+#include <memory>
+
+#include "FGJSBBase.h"
 
 namespace JSBSim
 {
@@ -52,7 +55,8 @@ public:
                  double randomization=0.1,
                  bool showConvergeStatus=true,bool showSimplex=false,
                  bool pause=false,
-                 Callback * callback=NULL);
+                 Callback * callback=NULL,
+                 std::shared_ptr<RandomNumberGenerator> generator=nullptr);
     std::vector<double> getSolution();
 
     void update();
@@ -62,6 +66,7 @@ private:
     // attributes
     Function * m_f;
     Callback * m_callback;
+    std::shared_ptr<RandomNumberGenerator> m_generator;
     double m_randomization;
     const std::vector<double> & m_lowerBound;
     const std::vector<double> & m_upperBound;
@@ -35,6 +35,7 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include <string>
+#include <vector>
 #include "simgear/structure/SGSharedPtr.hxx"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -43,6 +44,8 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
+class FGPropertyNode;
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -61,6 +64,16 @@ public:
   virtual ~FGParameter(void) {};
   virtual double GetValue(void) const = 0;
   virtual std::string GetName(void) const = 0;
+  /** Returns true if the value of the parameter never changes. Constant
+      parameters can be evaluated once for all when a function is loaded. */
+  virtual bool IsConstant(void) const { return false; }
+  /** Appends the property nodes which the value of the parameter depends on.
+      @param nodes the list to which the nodes are appended.
+      @return false if the value of the parameter does not only depend on
+              property nodes (random numbers, templates, etc.) and can
+              therefore not be memoized. */
+  virtual bool GetDependencies(std::vector<FGPropertyNode*>& nodes) const
+  { return false; }
 
   // SGPropertyNode impersonation.
   double getDoubleValue(void) const { return GetValue(); }
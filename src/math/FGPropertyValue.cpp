@@ -39,15 +39,16 @@ CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 FGPropertyValue::FGPropertyValue(FGPropertyNode* propNode)
-  : PropertyManager(0L), PropertyNode(propNode)
+  : PropertyManager(0L), PropertyNode(propNode), ValuePtr(0L)
 {
   Sign = 1;
+  if (propNode) ValuePtr = propNode->getTiedDoublePointer();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 FGPropertyValue::FGPropertyValue(std::string propName, FGPropertyManager* propertyManager)
-  : PropertyManager(propertyManager), PropertyNode(0L)
+  : PropertyManager(propertyManager), PropertyNode(0L), ValuePtr(0L)
 {
   if (propName[0] == '-') {
     propName.erase(0,1);
@@ -71,6 +72,7 @@ FGPropertyNode* FGPropertyValue::GetNode(void) const
                         PropertyName + " does not exist."));
 
     PropertyNode = node;
+    ValuePtr = node->getTiedDoublePointer();
   }
 
   return PropertyNode;
@@ -80,12 +82,48 @@ FGPropertyNode* FGPropertyValue::GetNode(void) const
 
 double FGPropertyValue::GetValue(void) const
 {
+  if (ValuePtr) return *ValuePtr*Sign;
 
   return GetNode()->getDoubleValue()*Sign;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGPropertyValue::IsConstant(void) const
+{
+  FGPropertyNode* node = FindNode();
+
+  return node && node->getAttribute(SGPropertyNode::CONSTANT);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGPropertyValue::GetDependencies(std::vector<FGPropertyNode*>& nodes) const
+{
+  FGPropertyNode* node = FindNode();
+
+  if (!node) return false;
+
+  nodes.push_back(node);
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Same as GetNode() but silently returns a null pointer when the property does
+// not exist (yet).
+
+FGPropertyNode* FGPropertyValue::FindNode(void) const
+{
+  FGPropertyNode* node = PropertyNode;
+
+  if (!node && PropertyManager && PropertyManager->HasNode(PropertyName))
+    node = PropertyManager->GetNode(PropertyName);
+
+  return node;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 std::string FGPropertyValue::GetName(void) const
 {
   if (PropertyNode)
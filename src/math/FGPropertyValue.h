@@ -49,6 +49,11 @@ CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
   /** Represents a property value which can use late binding.
+
+      When the property is tied to a double variable with
+      FGPropertyManager::Tie(name, double*), the value is read directly from
+      the variable once the property is bound, bypassing the type dispatch of
+      SGPropertyNode.
       @author Jon Berndt, Anders Gidenstam
   */
 
@@ -64,7 +69,12 @@ public:
   FGPropertyValue(std::string propName, FGPropertyManager* propertyManager);
 
   virtual double GetValue(void) const;
-  void SetNode(FGPropertyNode* node) {PropertyNode = node;}
+  /** Returns true if the property has been flagged with the attribute
+      SGPropertyNode::CONSTANT i.e. its value is no longer modified once the
+      model is loaded. */
+  virtual bool IsConstant(void) const;
+  virtual bool GetDependencies(std::vector<FGPropertyNode*>& nodes) const;
+  void SetNode(FGPropertyNode* node) {PropertyNode = node; ValuePtr = 0L;}
 
   virtual std::string GetName(void) const;
   virtual std::string GetNameWithSign(void) const;
@@ -75,8 +85,12 @@ protected:
   FGPropertyNode* GetNode(void) const;
 
 private:
+  FGPropertyNode* FindNode(void) const;
+
   FGPropertyManager* PropertyManager; // Property root used to do late binding.
   mutable FGPropertyNode_ptr PropertyNode;
+  // The variable the property is tied to, when it is read directly from it.
+  mutable const double* ValuePtr;
   std::string PropertyName;
   int Sign;
 };
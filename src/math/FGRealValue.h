@@ -63,6 +63,8 @@ public:
 
   double GetValue(void) const;
   std::string GetName(void) const;
+  bool IsConstant(void) const { return true; }
+  bool GetDependencies(std::vector<FGPropertyNode*>&) const { return true; }
 
 private:
   double Value;
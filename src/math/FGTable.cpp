@@ -42,6 +42,7 @@ INCLUDES
 #include <iostream>
 #include <sstream>
 #include <cstdlib>
+#include <algorithm>
 
 using namespace std;
 
@@ -58,9 +59,10 @@ FGTable::FGTable(int NRows) : nRows(NRows), nCols(1), PropertyManager(0)
   rowCounter = 1;
   nTables = 0;
 
-  Data = Allocate();
+  Allocate();
   Debug(0);
   lastRowIndex=lastColumnIndex=2;
+  lastValue = 0.0;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -72,9 +74,10 @@ FGTable::FGTable(int NRows, int NCols) : nRows(NRows), nCols(NCols), PropertyMan
   rowCounter = 0;
   nTables = 0;
 
-  Data = Allocate();
+  Allocate();
   Debug(0);
   lastRowIndex=lastColumnIndex=2;
+  lastValue = 0.0;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -96,15 +99,12 @@ FGTable::FGTable(const FGTable& t) : PropertyManager(t.PropertyManager)
   lookupProperty[2] = t.lookupProperty[2];
 
   Tables = t.Tables;
-  Data = Allocate();
-  for (unsigned int r=0; r<=nRows; r++) {
-    for (unsigned int c=0; c<=nCols; c++) {
-      Data[r][c] = t.Data[r][c];
-    }
-  }
+  Data = t.Data;
+  RowBreakpoints = t.RowBreakpoints;
   lastRowIndex = t.lastRowIndex;
   lastColumnIndex = t.lastColumnIndex;
   lastTableIndex = t.lastTableIndex;
+  lastValue = t.lastValue;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -129,6 +129,7 @@ FGTable::FGTable(FGPropertyManager* propMan, Element* el,
                            "pow, abs, sin, cos, asin, acos, tan, atan, table";
 
   nTables = 0;
+  lastValue = 0.0;
 
   // Is this an internal lookup table?
 
@@ -248,7 +249,7 @@ FGTable::FGTable(FGPropertyManager* propMan, Element* el,
     Type = tt1D;
     colCounter = 0;
     rowCounter = 1;
-    Data = Allocate();
+    Allocate();
     Debug(0);
     lastRowIndex = lastColumnIndex = 2;
     *this << buf;
@@ -267,7 +268,7 @@ FGTable::FGTable(FGPropertyManager* propMan, Element* el,
     colCounter = 1;
     rowCounter = 0;
 
-    Data = Allocate();
+    Allocate();
     lastRowIndex = lastColumnIndex = 2;
     *this << buf;
     break;
@@ -280,12 +281,12 @@ FGTable::FGTable(FGPropertyManager* propMan, Element* el,
     rowCounter = 1;
     lastRowIndex = lastColumnIndex = 2;
 
-    Data = Allocate(); // this data array will contain the keys for the associated tables
+    Allocate(); // this data array will contain the keys for the associated tables
     Tables.reserve(nTables); // necessary?
     tableData = el->FindElement("tableData");
     for (i=0; i<nTables; i++) {
       Tables.push_back(new FGTable(PropertyManager, tableData));
-      Data[i+1][1] = tableData->GetAttributeValueAsNumber("breakPoint");
+      SetElement(i+1, 1, tableData->GetAttributeValueAsNumber("breakPoint"));
       Tables[i]->SetRowIndexProperty(lookupProperty[eRow]);
       Tables[i]->SetColumnIndexProperty(lookupProperty[eColumn]);
       tableData = el->FindNextElement("tableData");
@@ -310,14 +311,14 @@ FGTable::FGTable(FGPropertyManager* propMan, Element* el,
   // check breakpoints, if applicable
   if (dimension > 2) {
     for (b=2; b<=nTables; ++b) {
-      if (Data[b][1] <= Data[b-1][1]) {
+      if (GetElement(b, 1) <= GetElement(b-1, 1)) {
         stringstream errormsg;
         errormsg << fgred << highint << endl
              << "  FGTable: breakpoint lookup is not monotonically increasing" << endl
              << "  in breakpoint " << b;
         if (nameel != 0) errormsg << " of table in " << nameel->GetAttributeValue("name");
         errormsg << ":" << reset << endl
-                 << "  " << Data[b][1] << "<=" << Data[b-1][1] << endl;
+                 << "  " << GetElement(b, 1) << "<=" << GetElement(b-1, 1) << endl;
         throw(errormsg.str());
       }
     }
@@ -326,14 +327,14 @@ FGTable::FGTable(FGPropertyManager* propMan, Element* el,
   // check columns, if applicable
   if (dimension > 1) {
     for (c=2; c<=nCols; ++c) {
-      if (Data[0][c] <= Data[0][c-1]) {
+      if (GetElement(0, c) <= GetElement(0, c-1)) {
         stringstream errormsg;
         errormsg << fgred << highint << endl
              << "  FGTable: column lookup is not monotonically increasing" << endl
              << "  in column " << c;
         if (nameel != 0) errormsg << " of table in " << nameel->GetAttributeValue("name");
         errormsg << ":" << reset << endl
-                 << "  " << Data[0][c] << "<=" << Data[0][c-1] << endl;
+                 << "  " << GetElement(0, c) << "<=" << GetElement(0, c-1) << endl;
         throw(errormsg.str());
       }
     }
@@ -342,14 +343,14 @@ FGTable::FGTable(FGPropertyManager* propMan, Element* el,
   // check rows
   if (dimension < 3) { // in 3D tables, check only rows of subtables
     for (r=2; r<=nRows; ++r) {
-      if (Data[r][0]<=Data[r-1][0]) {
+      if (GetElement(r, 0) <= GetElement(r-1, 0)) {
         stringstream errormsg;
         errormsg << fgred << highint << endl
              << "  FGTable: row lookup is not monotonically increasing" << endl
              << "  in row " << r;
         if (nameel != 0) errormsg << " of table in " << nameel->GetAttributeValue("name");
         errormsg << ":" << reset << endl
-                 << "  " << Data[r][0] << "<=" << Data[r-1][0] << endl;
+                 << "  " << GetElement(r, 0) << "<=" << GetElement(r-1, 0) << endl;
         throw(errormsg.str());
       }
     }
@@ -362,16 +363,20 @@ FGTable::FGTable(FGPropertyManager* propMan, Element* el,
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-double** FGTable::Allocate(void)
+void FGTable::Allocate(void)
 {
-  Data = new double*[nRows+1];
-  for (unsigned int r=0; r<=nRows; r++) {
-    Data[r] = new double[nCols+1];
-    for (unsigned int c=0; c<=nCols; c++) {
-      Data[r][c] = 0.0;
-    }
-  }
-  return Data;
+  Data.assign((nRows+1)*(nCols+1), 0.0);
+  RowBreakpoints.assign(nRows+1, 0.0);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The row breakpoints are stored in the first column of 1D and 2D tables and in
+// the second column of 3D tables.
+
+void FGTable::SetElement(unsigned int r, unsigned int c, double value)
+{
+  Data[r*(nCols+1)+c] = value;
+  if (c == (Type == tt3D ? 1u : 0u)) RowBreakpoints[r] = value;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -382,9 +387,6 @@ FGTable::~FGTable()
     for (unsigned int i=0; i<nTables; i++) delete Tables[i];
     Tables.clear();
   }
-  for (unsigned int r=0; r<=nRows; r++) delete[] Data[r];
-  delete[] Data;
-
   Debug(1);
 }
 
@@ -406,89 +408,306 @@ unsigned int FGTable::FindNumColumns(const string& test_line)
 
 double FGTable::GetValue(void) const
 {
-  double temp = 0;
-  double temp2 = 0;
+  if (!Inputs.IsResolved()) Inputs.Track(this);
+
+  if (!Inputs.Changed()) return lastValue;
 
   switch (Type) {
   case tt1D:
-    temp = lookupProperty[eRow]->getDoubleValue();
-    temp2 = GetValue(temp);
-    return temp2;
+    lastValue = GetValue(lookupProperty[eRow]->getDoubleValue());
+    break;
   case tt2D:
-    return GetValue(lookupProperty[eRow]->getDoubleValue(),
-                    lookupProperty[eColumn]->getDoubleValue());
+    lastValue = GetValue(lookupProperty[eRow]->getDoubleValue(),
+                         lookupProperty[eColumn]->getDoubleValue());
+    break;
   case tt3D:
-    return GetValue(lookupProperty[eRow]->getDoubleValue(),
-                    lookupProperty[eColumn]->getDoubleValue(),
-                    lookupProperty[eTable]->getDoubleValue());
+    lastValue = GetValue(lookupProperty[eRow]->getDoubleValue(),
+                         lookupProperty[eColumn]->getDoubleValue(),
+                         lookupProperty[eTable]->getDoubleValue());
+    break;
   default:
+    Inputs.Invalidate();
     cerr << "Attempted to GetValue() for invalid/unknown table type" << endl;
     throw(string("Attempted to GetValue() for invalid/unknown table type"));
   }
+
+  return lastValue;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGTable::GetDependencies(vector<FGPropertyNode*>& nodes) const
+{
+  unsigned int n = 0;
+
+  switch (Type) {
+  case tt1D: n = 1; break;
+  case tt2D: n = 2; break;
+  case tt3D: n = 3; break;
+  }
+
+  for (unsigned int i=0; i<n; i++) {
+    if (!lookupProperty[i]) return false;
+    nodes.push_back(lookupProperty[i]);
+  }
+
+  return n > 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+// Finds the interval [keys[r-1], keys[r]] that contains key, starting from the
+// interval found by the previous lookup. The result is the same as walking the
+// breakpoints one by one from the hint: the walk is used when the key has moved
+// by one interval at most and a binary search is used otherwise.
+// The breakpoints are indexed from 1 to n and the result is within [2, n].
+
+unsigned int FGTable::FindInterval(const double* keys, unsigned int n,
+                                   double key, unsigned int r)
+{
+  if (r > 2 && keys[r-1] > key) {
+    if (r == 3 || keys[r-2] <= key) return r-1;
+    // First breakpoint which is greater than the key.
+    r = upper_bound(keys+1, keys+r-1, key) - keys;
+    return r > 2 ? r : 2;
+  } else if (r < n && keys[r] < key) {
+    if (r+1 == n || keys[r+1] >= key) return r+1;
+    // First breakpoint which is greater than or equal to the key.
+    r = lower_bound(keys+r+2, keys+n+1, key) - keys;
+    return r < n ? r : n;
+  }
+
+  return r;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 double FGTable::GetValue(double key) const
 {
+  const double* rowKeys = RowBreakpoints.data();
+  const double* y = Data.data() + 1; // Values are stored in the 2nd column
   double Factor, Value, Span;
-  unsigned int r = lastRowIndex;
 
   //if the key is off the end of the table, just return the
   //end-of-table value, do not extrapolate
-  if( key <= Data[1][0] ) {
+  if( key <= rowKeys[1] ) {
     lastRowIndex=2;
-    //cout << "Key underneath table: " << key << endl;
-    return Data[1][1];
-  } else if ( key >= Data[nRows][0] ) {
+    return y[2];
+  } else if ( key >= rowKeys[nRows] ) {
     lastRowIndex=nRows;
-    //cout << "Key over table: " << key << endl;
-    return Data[nRows][1];
+    return y[2*nRows];
   }
 
   // the key is somewhere in the middle, search for the right breakpoint
-  // The search is particularly efficient if 
-  // the correct breakpoint has not changed since last frame or
-  // has only changed very little
-
-  while (r > 2     && Data[r-1][0] > key) { r--; }
-  while (r < nRows && Data[r][0]   < key) { r++; }
+  unsigned int r = FindInterval(rowKeys, nRows, key, lastRowIndex);
 
   lastRowIndex=r;
   // make sure denominator below does not go to zero.
 
-  Span = Data[r][0] - Data[r-1][0];
+  Span = rowKeys[r] - rowKeys[r-1];
   if (Span != 0.0) {
-    Factor = (key - Data[r-1][0]) / Span;
+    Factor = (key - rowKeys[r-1]) / Span;
     if (Factor > 1.0) Factor = 1.0;
   } else {
     Factor = 1.0;
   }
 
-  Value = Factor*(Data[r][1] - Data[r-1][1]) + Data[r-1][1];
+  Value = Factor*(y[2*r] - y[2*(r-1)]) + y[2*(r-1)];
 
   return Value;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The keys are processed by blocks: the intervals are searched first, then the
+// interpolation is applied to the whole block by a loop without branches nor
+// indirections which the compiler is able to vectorize. The keys that are off
+// the table use a null factor so that the end-of-table value is returned as is
+// (dy is set to -0.0 so that the sign of a zero value is also preserved).
 
-double FGTable::GetValue(double rowKey, double colKey) const
+void FGTable::GetValues(const double* keys, double* values, size_t n) const
 {
-  double rFactor, cFactor, col1temp, col2temp, Value;
+  const size_t blockSize = 64;
+  const double* rowKeys = RowBreakpoints.data();
+  const double* y = Data.data() + 1;
+  double dx[blockSize], span[blockSize], y0[blockSize], dy[blockSize];
+  unsigned int r = lastRowIndex;
+
+  for (size_t start=0; start < n; start += blockSize) {
+    size_t count = min(blockSize, n-start);
+    const double* key = keys + start;
+
+    for (size_t i=0; i<count; i++) {
+      if (key[i] <= rowKeys[1]) {
+        r = 2;
+        dx[i] = 0.0; span[i] = 1.0; y0[i] = y[2]; dy[i] = -0.0;
+      } else if (key[i] >= rowKeys[nRows]) {
+        r = nRows;
+        dx[i] = 0.0; span[i] = 1.0; y0[i] = y[2*nRows]; dy[i] = -0.0;
+      } else {
+        r = FindInterval(rowKeys, nRows, key[i], r);
+        dx[i] = key[i] - rowKeys[r-1];
+        span[i] = rowKeys[r] - rowKeys[r-1];
+        y0[i] = y[2*(r-1)];
+        dy[i] = y[2*r] - y0[i];
+        if (span[i] == 0.0) dx[i] = span[i] = 1.0; // Factor = 1.0
+      }
+    }
+
+    for (size_t i=0; i<count; i++) {
+      double Factor = dx[i] / span[i];
+      Factor = Factor > 1.0 ? 1.0 : Factor;
+      values[start+i] = Factor*dy[i] + y0[i];
+    }
+  }
+
+  lastRowIndex = r;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTable::GetValues(const double* rowKeys, const double* colKeys,
+                        double* values, size_t n) const
+{
+  const size_t blockSize = 64;
+  const unsigned int stride = nCols+1;
+  const double* colBreakpoints = Data.data();
+  const double* rowBreakpoints = RowBreakpoints.data();
+  double drow[blockSize], rowSpan[blockSize], dcol[blockSize], colSpan[blockSize];
+  double z00[blockSize], z01[blockSize], z10[blockSize], z11[blockSize];
   unsigned int r = lastRowIndex;
   unsigned int c = lastColumnIndex;
 
-  while(r > 2     && Data[r-1][0] > rowKey) { r--; }
-  while(r < nRows && Data[r]  [0] < rowKey) { r++; }
+  for (size_t start=0; start < n; start += blockSize) {
+    size_t count = min(blockSize, n-start);
+    const double* rowKey = rowKeys + start;
+    const double* colKey = colKeys + start;
+
+    for (size_t i=0; i<count; i++) {
+      r = FindInterval(rowBreakpoints, nRows, rowKey[i], r);
+      c = FindInterval(colBreakpoints, nCols, colKey[i], c);
+      drow[i] = rowKey[i] - rowBreakpoints[r-1];
+      rowSpan[i] = rowBreakpoints[r] - rowBreakpoints[r-1];
+      dcol[i] = colKey[i] - colBreakpoints[c-1];
+      colSpan[i] = colBreakpoints[c] - colBreakpoints[c-1];
+
+      const double* row0 = Data.data() + (r-1)*stride;
+      const double* row1 = row0 + stride;
+      z00[i] = row0[c-1];
+      z01[i] = row0[c];
+      z10[i] = row1[c-1];
+      z11[i] = row1[c];
+    }
+
+    for (size_t i=0; i<count; i++) {
+      double rFactor = drow[i] / rowSpan[i];
+      double cFactor = dcol[i] / colSpan[i];
+      rFactor = rFactor > 1.0 ? 1.0 : (rFactor < 0.0 ? 0.0 : rFactor);
+      cFactor = cFactor > 1.0 ? 1.0 : (cFactor < 0.0 ? 0.0 : cFactor);
+      double col1temp = rFactor*(z10[i] - z00[i]) + z00[i];
+      double col2temp = rFactor*(z11[i] - z01[i]) + z01[i];
+      values[start+i] = col1temp + cFactor*(col2temp - col1temp);
+    }
+  }
+
+  lastRowIndex = r;
+  lastColumnIndex = c;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The keys are binned by sub-table: each sub-table is evaluated in a single
+// call for all the keys that need it, in the order of the keys, so that its
+// breakpoint searches go through the same intervals as with GetValue().
+
+void FGTable::GetValues(const double* rowKeys, const double* colKeys,
+                        const double* tableKeys, double* values, size_t n) const
+{
+  const double* tableBreakpoints = RowBreakpoints.data();
+  vector<unsigned int> lower(n), upper(n);
+  vector<double> factor(n), lowerValue(n), upperValue(n);
+  unsigned int r = lastRowIndex;
+
+  for (size_t i=0; i<n; i++) {
+    double tableKey = tableKeys[i];
+
+    if (tableKey <= tableBreakpoints[1]) {
+      r = 2;
+      lower[i] = upper[i] = 0;
+      factor[i] = 0.0;
+    } else if (tableKey >= tableBreakpoints[nRows]) {
+      r = nRows;
+      lower[i] = upper[i] = nRows-1;
+      factor[i] = 0.0;
+    } else {
+      r = FindInterval(tableBreakpoints, nRows, tableKey, r);
+      lower[i] = r-2;
+      upper[i] = r-1;
+      double Span = tableBreakpoints[r] - tableBreakpoints[r-1];
+      if (Span != 0.0) {
+        factor[i] = (tableKey - tableBreakpoints[r-1]) / Span;
+        if (factor[i] > 1.0) factor[i] = 1.0;
+      } else {
+        factor[i] = 1.0;
+      }
+    }
+  }
 
-  while(c > 2     && Data[0][c-1] > colKey) { c--; }
-  while(c < nCols && Data[0][c]   < colKey) { c++; }
+  lastRowIndex = r;
+
+  vector<size_t> index;
+  vector<double> rowKey, colKey, result;
+  index.reserve(n);
+  rowKey.reserve(n);
+  colKey.reserve(n);
+
+  for (unsigned int t=0; t<nRows; t++) {
+    index.clear();
+    rowKey.clear();
+    colKey.clear();
+
+    for (size_t i=0; i<n; i++) {
+      if (lower[i] == t || upper[i] == t) {
+        index.push_back(i);
+        rowKey.push_back(rowKeys[i]);
+        colKey.push_back(colKeys[i]);
+      }
+    }
+
+    if (index.empty()) continue;
+
+    result.resize(index.size());
+    Tables[t]->GetValues(rowKey.data(), colKey.data(), result.data(),
+                         index.size());
+
+    for (size_t k=0; k<index.size(); k++) {
+      size_t i = index[k];
+      if (lower[i] == t) lowerValue[i] = result[k];
+      if (upper[i] == t) upperValue[i] = result[k];
+    }
+  }
+
+  for (size_t i=0; i<n; i++) {
+    double v0 = lowerValue[i];
+    values[i] = lower[i] == upper[i] ? v0
+                                     : factor[i]*(upperValue[i] - v0) + v0;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGTable::GetValue(double rowKey, double colKey) const
+{
+  const unsigned int stride = nCols+1;
+  const double* colKeys = Data.data(); // The first row
+  const double* rowKeys = RowBreakpoints.data();
+  double rFactor, cFactor, col1temp, col2temp, Value;
+  unsigned int r = FindInterval(rowKeys, nRows, rowKey, lastRowIndex);
+  unsigned int c = FindInterval(colKeys, nCols, colKey, lastColumnIndex);
 
   lastRowIndex=r;
   lastColumnIndex=c;
 
-  rFactor = (rowKey - Data[r-1][0]) / (Data[r][0] - Data[r-1][0]);
-  cFactor = (colKey - Data[0][c-1]) / (Data[0][c] - Data[0][c-1]);
+  rFactor = (rowKey - rowKeys[r-1]) / (rowKeys[r] - rowKeys[r-1]);
+  cFactor = (colKey - colKeys[c-1]) / (colKeys[c] - colKeys[c-1]);
 
   if (rFactor > 1.0) rFactor = 1.0;
   else if (rFactor < 0.0) rFactor = 0.0;
@@ -496,8 +715,11 @@ double FGTable::GetValue(double rowKey, double colKey) const
   if (cFactor > 1.0) cFactor = 1.0;
   else if (cFactor < 0.0) cFactor = 0.0;
 
-  col1temp = rFactor*(Data[r][c-1] - Data[r-1][c-1]) + Data[r-1][c-1];
-  col2temp = rFactor*(Data[r][c] - Data[r-1][c]) + Data[r-1][c];
+  const double* row0 = Data.data() + (r-1)*stride;
+  const double* row1 = row0 + stride;
+
+  col1temp = rFactor*(row1[c-1] - row0[c-1]) + row0[c-1];
+  col2temp = rFactor*(row1[c] - row0[c]) + row0[c];
 
   Value = col1temp + cFactor*(col2temp - col1temp);
 
@@ -508,34 +730,29 @@ double FGTable::GetValue(double rowKey, double colKey) const
 
 double FGTable::GetValue(double rowKey, double colKey, double tableKey) const
 {
+  const double* tableKeys = RowBreakpoints.data();
   double Factor, Value, Span;
-  unsigned int r = lastRowIndex;
 
   //if the key is off the end  (or before the beginning) of the table,
   // just return the boundary-table value, do not extrapolate
 
-  if( tableKey <= Data[1][1] ) {
+  if( tableKey <= tableKeys[1] ) {
     lastRowIndex=2;
     return Tables[0]->GetValue(rowKey, colKey);
-  } else if ( tableKey >= Data[nRows][1] ) {
+  } else if ( tableKey >= tableKeys[nRows] ) {
     lastRowIndex=nRows;
     return Tables[nRows-1]->GetValue(rowKey, colKey);
   }
 
   // the key is somewhere in the middle, search for the right breakpoint
-  // The search is particularly efficient if 
-  // the correct breakpoint has not changed since last frame or
-  // has only changed very little
-
-  while(r > 2     && Data[r-1][1] > tableKey) { r--; }
-  while(r < nRows && Data[r]  [1] < tableKey) { r++; }
+  unsigned int r = FindInterval(tableKeys, nRows, tableKey, lastRowIndex);
 
   lastRowIndex=r;
   // make sure denominator below does not go to zero.
 
-  Span = Data[r][1] - Data[r-1][1];
+  Span = tableKeys[r] - tableKeys[r-1];
   if (Span != 0.0) {
-    Factor = (tableKey - Data[r-1][1]) / Span;
+    Factor = (tableKey - tableKeys[r-1]) / Span;
     if (Factor > 1.0) Factor = 1.0;
   } else {
     Factor = 1.0;
@@ -560,7 +777,9 @@ void FGTable::operator<<(istream& in_stream)
   for (unsigned int r=startRow; r<=nRows; r++) {
     for (unsigned int c=startCol; c<=nCols; c++) {
       if (r != 0 || c != 0) {
-        in_stream >> Data[r][c];
+        double value = 0.0;
+        in_stream >> value;
+        SetElement(r, c, value);
       }
     }
   }
@@ -572,7 +791,7 @@ void FGTable::operator<<(istream& in_stream)
 
 FGTable& FGTable::operator<<(const double n)
 {
-  Data[rowCounter][colCounter] = n;
+  SetElement(rowCounter, colCounter, n);
   if (colCounter == (int)nCols) {
     colCounter = 0;
     rowCounter++;
@@ -626,7 +845,7 @@ void FGTable::Print(void)
       if (r == 0 && c == 0) {
         cout << "	";
       } else {
-        cout << Data[r][c] << "	";
+        cout << GetElement(r, c) << "	";
         if (Type == tt3D) {
           cout << endl;
           Tables[r-1]->Print();
@@ -43,6 +43,7 @@ INCLUDES
 #include <string>
 #include "FGParameter.h"
 #include "input_output/FGPropertyManager.h"
+#include "input_output/FGPropertyDependencies.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -226,6 +227,16 @@ referring to combustion efficiency). Later on, the table is used like this:
 combustion_efficiency = Lookup_Combustion_Efficiency->GetValue(equivalence_ratio);
 @endcode
 
+The table data is stored in a single contiguous row-major buffer. The row
+breakpoints (or the table breakpoints of a 3D table) are also copied to a
+separate array so that they can be searched without striding through the data.
+The column breakpoints are the first row of the buffer and are therefore
+already contiguous.
+
+A lookup starts from the interval found by the previous lookup: when the key
+lies in the same interval or in a neighbouring one, the interval is found in
+constant time. Otherwise a binary search is used.
+
 @author Jon S. Berndt
 */
 
@@ -247,10 +258,33 @@ public:
   FGTable (FGPropertyManager* propMan, Element* el, const std::string& prefix="");
   FGTable (int );
   FGTable (int, int);
+  /** Returns the value of the table at the current values of its lookup
+      properties. The value is memoized: the table lookup is skipped as long as
+      the lookup properties have not changed. */
   double GetValue(void) const;
   double GetValue(double key) const;
   double GetValue(double rowKey, double colKey) const;
   double GetValue(double rowKey, double colKey, double TableKey) const;
+  /** @name Batch evaluation
+      These methods evaluate a table for several keys at once. They are meant
+      for sweeps, trims and linearizations which evaluate the same table many
+      times. The result is the same as calling GetValue() for each set of keys
+      in turn but the interpolation is applied to blocks of keys so that the
+      compiler can vectorize it. The breakpoints are searched from the
+      interval of the previous key: sorting the keys beforehand makes the
+      search faster but is not required.
+      @param n the number of keys
+      @param values the array receiving the n values of the table */
+  //@{
+  /// Evaluates a 1D table.
+  void GetValues(const double* keys, double* values, size_t n) const;
+  /// Evaluates a 2D table.
+  void GetValues(const double* rowKeys, const double* colKeys, double* values,
+                 size_t n) const;
+  /// Evaluates a 3D table.
+  void GetValues(const double* rowKeys, const double* colKeys,
+                 const double* tableKeys, double* values, size_t n) const;
+  //@}
   /** Read the table in.
       Data in the config file should be in matrix format with the row
       independents as the first column and the column independents in
@@ -277,14 +311,20 @@ public:
   FGTable& operator<<(const double n);
   FGTable& operator<<(const int n);
 
-  inline double GetElement(int r, int c) const {return Data[r][c];}
+  inline double GetElement(int r, int c) const {return Data[r*(nCols+1)+c];}
 //  inline double GetElement(int r, int c, int t);
 
   double operator()(unsigned int r, unsigned int c) const {return GetElement(r, c);}
 //  double operator()(unsigned int r, unsigned int c, unsigned int t) {GetElement(r, c, t);}
 
-  void SetRowIndexProperty(FGPropertyNode *node) {lookupProperty[eRow] = node;}
-  void SetColumnIndexProperty(FGPropertyNode *node) {lookupProperty[eColumn] = node;}
+  void SetRowIndexProperty(FGPropertyNode *node) {
+    lookupProperty[eRow] = node;
+    Inputs = FGPropertyDependencies();
+  }
+  void SetColumnIndexProperty(FGPropertyNode *node) {
+    lookupProperty[eColumn] = node;
+    Inputs = FGPropertyDependencies();
+  }
 
   unsigned int GetNumRows() const {return nRows;}
 
@@ -292,17 +332,25 @@ public:
 
   std::string GetName(void) const {return Name;}
 
+  bool GetDependencies(std::vector<FGPropertyNode*>& nodes) const;
+
 private:
   enum type {tt1D, tt2D, tt3D} Type;
   enum axis {eRow=0, eColumn, eTable};
   bool internal;
   FGPropertyNode_ptr lookupProperty[3];
-  double** Data;
+  std::vector<double> Data; // (nRows+1)x(nCols+1) elements, row-major
+  std::vector<double> RowBreakpoints; // Indexed from 1 to nRows
   std::vector <FGTable*> Tables;
   unsigned int nRows, nCols, nTables, dimension;
   int colCounter, rowCounter, tableCounter;
   mutable int lastRowIndex, lastColumnIndex, lastTableIndex;
-  double** Allocate(void);
+  mutable FGPropertyDependencies Inputs;
+  mutable double lastValue;
+  void Allocate(void);
+  void SetElement(unsigned int r, unsigned int c, double value);
+  static unsigned int FindInterval(const double* keys, unsigned int n,
+                                   double key, unsigned int hint);
   FGPropertyManager* const PropertyManager;
   std::string Prefix;
   std::string Name;
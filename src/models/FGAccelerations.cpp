@@ -104,6 +104,22 @@ bool FGAccelerations::InitModel(void)
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAccelerations::SerializeState(FGStateArchive& archive)
+{
+  FGModel::SerializeState(archive);
+
+  archive.Sync(vPQRdot, vPQRidot, vUVWdot, vUVWidot, vBodyAccel, vGravAccel,
+               vFrictionForces, vFrictionMoments, gravType, gravTorque);
+
+  archive.Sync(in.J, in.Jinv, in.Ti2b, in.Tb2i, in.Tec2b, in.Tec2i, in.Moment,
+               in.GroundMoment, in.Force, in.GroundForce, in.J2Grav, in.vPQRi,
+               in.vPQR, in.vUVW, in.vInertialPosition, in.vOmegaPlanet,
+               in.TerrainVelocity, in.TerrainAngularVel, in.DeltaT, in.Mass,
+               in.GAccel);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 /*
 Purpose: Called on a schedule to calculate derivatives.
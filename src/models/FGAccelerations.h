@@ -116,6 +116,8 @@ public:
       other FGModel objects (and others).  */
   bool InitModel(void);
 
+  void SerializeState(FGStateArchive& archive);
+
   /** Runs the state propagation model; called by the Executive
       Can pass in a value indicating if the executive is directing the simulation to Hold.
       @param Holding if true, the executive has been directed to hold the sim from
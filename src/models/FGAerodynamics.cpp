@@ -134,6 +134,29 @@ bool FGAerodynamics::InitModel(void)
   vMoments.InitMatrix();
   return true;
 }
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAerodynamics::SerializeState(FGStateArchive& archive)
+{
+  FGModel::SerializeState(archive);
+
+  archive.Sync(Ts2b, Tb2s, vFnative, vFw, vForces, vFnativeAtCG, vForcesAtCG,
+               vMoments, vMomentsMRC, vMomentsMRCBodyXYZ, vDXYZcg, vDeltaRP);
+  archive.Sync(impending_stall, stall_hyst, bi2vel, ci2vel, alphaw, clsq, lod,
+               qbar_area);
+
+  archive.Sync(in.Alpha, in.Beta, in.Vt, in.Qbar, in.Wingarea, in.Wingspan,
+               in.Wingchord, in.Wingincidence, in.RPBody, in.Tb2w, in.Tw2b);
+
+  for (unsigned int i=0; i<6; i++) {
+    archive.SyncCount(AeroFunctions[i].size() + AeroFunctionsAtCG[i].size(),
+                      "aerodynamic functions");
+    for (auto f: AeroFunctions[i]) f->SerializeState(archive);
+    for (auto f: AeroFunctionsAtCG[i]) f->SerializeState(archive);
+  }
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 bool FGAerodynamics::Run(bool Holding)
@@ -361,7 +384,7 @@ bool FGAerodynamics::Load(Element *document)
 
   if ((temp_element = document->FindElement("aero_ref_pt_shift_x"))) {
     function_element = temp_element->FindElement("function");
-    AeroRPShift = new FGFunction(PropertyManager, function_element);
+    AeroRPShift = new FGFunction(FDMExec, function_element);
   }
 
   axis_element = document->FindElement("axis");
@@ -378,7 +401,7 @@ bool FGAerodynamics::Load(Element *document)
       }
       if (!apply_at_cg) {
       try {
-        ca.push_back( new FGFunction(PropertyManager, function_element) );
+        ca.push_back( new FGFunction(FDMExec, function_element) );
       } catch (const string& str) {
         cerr << endl << axis_element->ReadFrom()
              << endl << fgred << "Error loading aerodynamic function in "
@@ -387,7 +410,7 @@ bool FGAerodynamics::Load(Element *document)
       }
       } else {
         try {
-          ca_atCG.push_back( new FGFunction(PropertyManager, function_element) );
+          ca_atCG.push_back( new FGFunction(FDMExec, function_element) );
         } catch (const string& str) {
           cerr << endl << axis_element->ReadFrom()
                << endl << fgred << "Error loading aerodynamic function in "
@@ -402,7 +425,7 @@ bool FGAerodynamics::Load(Element *document)
     axis_element = document->FindNextElement("axis");
   }
 
-  PostLoad(document, PropertyManager); // Perform base class Post-Load
+  PostLoad(document, FDMExec); // Perform base class Post-Load
 
   return true;
 }
@@ -567,6 +590,18 @@ string FGAerodynamics::GetAeroFunctionValues(const string& delimeter) const
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGAerodynamics::GetAeroFunctionValues(vector<double>& values) const
+{
+  for (unsigned int axis = 0; axis < 6; axis++) {
+    for (unsigned int sd = 0; sd < AeroFunctions[axis].size(); sd++)
+      values.push_back(AeroFunctions[axis][sd]->GetValue());
+  }
+
+  FGModelFunctions::GetFunctionValues(values);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGAerodynamics::bind(void)
 {
   typedef double (FGAerodynamics::*PMF)(int) const;
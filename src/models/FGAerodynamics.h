@@ -121,6 +121,8 @@ public:
 
   bool InitModel(void);
 
+  void SerializeState(FGStateArchive& archive);
+
   /** Runs the Aerodynamics model; called by the Executive
       Can pass in a value indicating if the executive is directing the simulation to Hold.
       @param Holding if true, the executive has been directed to hold the sim from 
@@ -232,6 +234,11 @@ public:
       aero functions */
   std::string GetAeroFunctionValues(const std::string& delimeter) const;
 
+  /** Gets the aero function values as numbers.
+      @param values the vector to which the values are appended, in the same
+                    order as the values of GetAeroFunctionValues(). */
+  void GetAeroFunctionValues(std::vector<double>& values) const;
+
   std::vector <FGFunction*> * GetAeroFunctions(void) const { return AeroFunctions; }
 
   struct Inputs {
@@ -94,6 +94,19 @@ bool FGAircraft::InitModel(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGAircraft::SerializeState(FGStateArchive& archive)
+{
+  FGModel::SerializeState(archive);
+
+  archive.Sync(vMoments, vForces, vDXYZcg);
+
+  archive.Sync(in.AeroForce, in.PropForce, in.GroundForce, in.ExternalForce,
+               in.BuoyantForce, in.AeroMoment, in.PropMoment, in.GroundMoment,
+               in.ExternalMoment, in.BuoyantMoment);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGAircraft::Run(bool Holding)
 {
   if (FGModel::Run(Holding)) return true;
@@ -168,7 +181,18 @@ bool FGAircraft::Load(Element* el)
     }
   }
 
-  PostLoad(el, PropertyManager);
+  // The read only metrics are no longer modified from now on: the functions
+  // loaded afterwards can use their value as a constant. The wing area can be
+  // modified and is therefore excluded.
+  const char* constants[] = {"bw-ft", "cbarw-ft", "iw-rad", "iw-deg",
+                             "Sh-sqft", "lh-ft", "Sv-sqft", "lv-ft",
+                             "lh-norm", "lv-norm", "vbarh-norm", "vbarv-norm"};
+  for (auto name: constants) {
+    FGPropertyNode* node = PropertyManager->GetNode(string("metrics/")+name);
+    if (node) node->setAttribute(SGPropertyNode::CONSTANT, true);
+  }
+
+  PostLoad(el, FDMExec);
 
   Debug(2);
 
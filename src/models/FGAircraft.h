@@ -120,6 +120,8 @@ public:
 
   bool InitModel(void);
 
+  void SerializeState(FGStateArchive& archive);
+
   /** Loads the aircraft.
       The executive calls this method to load the aircraft into JSBSim.
       @param el a pointer to the element tree
@@ -105,6 +105,17 @@ bool FGAtmosphere::InitModel(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGAtmosphere::SerializeState(FGStateArchive& archive)
+{
+  FGModel::SerializeState(archive);
+
+  archive.Sync(SLtemperature, SLdensity, SLpressure, SLsoundspeed, Temperature,
+               Density, Pressure, Soundspeed, PressureAltitude,
+               DensityAltitude, Viscosity, KinematicViscosity, in.altitudeASL);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGAtmosphere::Run(bool Holding)
 {
   if (FGModel::Run(Holding)) return true;
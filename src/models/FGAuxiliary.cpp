@@ -123,6 +123,28 @@ bool FGAuxiliary::InitModel(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGAuxiliary::SerializeState(FGStateArchive& archive)
+{
+  FGModel::SerializeState(archive);
+
+  archive.Sync(vcas, veas, pt, tat, tatc, mTw2b, mTb2w, vPilotAccel,
+               vPilotAccelN, vNcg, vNwcg, vAeroPQR, vAeroUVW, vEulerRates,
+               vMachUVW, vLocationVRP);
+  archive.Sync(Vt, Vground, Mach, MachU, qbar, qbarUW, qbarUV, Re, alpha, beta,
+               adot, bdot, psigt, gamma, Nz, Ny, seconds_in_day, day_of_year,
+               hoverbcg, hoverbmac);
+
+  archive.Sync(in.Pressure, in.Density, in.DensitySL, in.PressureSL,
+               in.Temperature, in.SoundSpeed, in.KinematicViscosity,
+               in.DistanceAGL, in.Wingspan, in.Wingchord, in.SLGravity,
+               in.Mass, in.Tl2b, in.Tb2l, in.vPQR, in.vPQRi, in.vPQRidot);
+  archive.Sync(in.vUVW, in.vUVWdot, in.vVel, in.vBodyAccel, in.ToEyePt,
+               in.RPBody, in.VRPBody, in.vFw, in.vLocation, in.CosTht,
+               in.SinTht, in.CosPhi, in.SinPhi, in.TotalWindNED, in.TurbPQR);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 FGAuxiliary::~FGAuxiliary()
 {
   Debug(1);
@@ -89,6 +89,21 @@ bool FGBuoyantForces::InitModel(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGBuoyantForces::SerializeState(FGStateArchive& archive)
+{
+  FGModel::SerializeState(archive);
+
+  archive.Sync(vTotalForces, vTotalMoments, gasCellJ, vGasCellXYZ,
+               vXYZgasCell_arm);
+  archive.Sync(in.Pressure, in.Temperature, in.Density, in.gravity);
+
+  archive.SyncCount(Cells.size(), "gas cells");
+  for (auto cell: Cells)
+    cell->SerializeState(archive);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGBuoyantForces::Run(bool Holding)
 {
   if (FGModel::Run(Holding)) return true;
@@ -130,7 +145,7 @@ bool FGBuoyantForces::Load(Element *document)
     gas_cell_element = document->FindNextElement("gas_cell");
   }
   
-  PostLoad(document, PropertyManager);
+  PostLoad(document, FDMExec);
 
   if (!NoneDefined) {
     bind();
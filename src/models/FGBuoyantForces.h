@@ -107,6 +107,8 @@ public:
 
   bool InitModel(void);
 
+  void SerializeState(FGStateArchive& archive);
+
   /** Runs the Buoyant forces model; called by the Executive
       Can pass in a value indicating if the executive is directing the simulation to Hold.
       @param Holding if true, the executive has been directed to hold the sim from 
@@ -84,7 +84,7 @@ bool FGExternalReactions::Load(Element* el)
     moment_element = el->FindNextElement("moment");
   }
 
-  PostLoad(el, PropertyManager);
+  PostLoad(el, FDMExec);
 
   if (!Forces.empty()) bind();
 
@@ -114,6 +114,19 @@ bool FGExternalReactions::InitModel(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGExternalReactions::SerializeState(FGStateArchive& archive)
+{
+  FGModel::SerializeState(archive);
+
+  archive.Sync(vTotalForces, vTotalMoments);
+
+  archive.SyncCount(Forces.size(), "external forces");
+  for (auto force: Forces)
+    force->SerializeState(archive);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGExternalReactions::Run(bool Holding)
 {
   if (FGModel::Run(Holding)) return true;
@@ -37,6 +37,7 @@ HISTORY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <cctype>
 #include <fstream>
 #include <sstream>
 #include <iomanip>
@@ -147,6 +148,24 @@ bool FGFCS::InitModel(void)
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFCS::SerializeState(FGStateArchive& archive)
+{
+  FGModel::SerializeState(archive);
+
+  archive.Sync(DaCmd, DeCmd, DrCmd, DfCmd, DsbCmd, DspCmd, PTrimCmd, YTrimCmd,
+               RTrimCmd);
+  archive.Sync(DePos, DaLPos, DaRPos, DrPos, DfPos, DsbPos, DspPos);
+  archive.Sync(ThrottleCmd, ThrottlePos, MixtureCmd, MixturePos,
+               PropAdvanceCmd, PropAdvance, PropFeatherCmd, PropFeather);
+  archive.Sync(BrakePos, GearCmd, GearPos, TailhookPos, WingFoldPos);
+
+  archive.SyncCount(SystemChannels.size(), "channels");
+  for (auto channel: SystemChannels)
+    channel->SerializeState(archive);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 // Notes: In this logic the default engine commands are set. This is simply a
 // sort of safe-mode method in case the user has not defined control laws for
@@ -170,9 +189,11 @@ bool FGFCS::Run(bool Holding)
   for (i=0; i<PropFeather.size(); i++) PropFeather[i] = PropFeatherCmd[i];
 
   // Execute system channels in order
+  FGProfiler& profiler = FDMExec->GetProfiler();
   for (i=0; i<SystemChannels.size(); i++) {
     if (debug_lvl & 4) cout << "    Executing System Channel: " << SystemChannels[i]->GetName() << endl;
     ChannelRate = SystemChannels[i]->GetRate();
+    FGProfiler::Sample sample(profiler, SystemChannels[i]->GetProfileTimer());
     SystemChannels[i]->Execute();
   }
   ChannelRate = 1;
@@ -522,6 +543,33 @@ bool FGFCS::Load(Element* document)
     } else
       newChannel = new FGFCSChannel(this, sChannelName, ChannelRate);
 
+    // Channels without a name are timed by their index. The characters of the
+    // names which are not allowed in a property name are replaced and the
+    // channels whose names end up the same are told apart by their index.
+    FGProfiler& profiler = FDMExec->GetProfiler();
+    string timerName;
+    if (sChannelName.empty())
+      timerName = CreateIndexedPropertyName("fcs/channel",
+                                            SystemChannels.size());
+    else {
+      string name = PropertyManager->mkPropertyName(sChannelName, true);
+      for (auto& c: name)
+        if (!isalnum(static_cast<unsigned char>(c)) && c != '_' && c != '-'
+            && c != '.')
+          c = '-';
+      if (!isalpha(static_cast<unsigned char>(name[0])) && name[0] != '_')
+        name = "_" + name;
+      timerName = "fcs/" + name;
+      for (unsigned int i=0; i<profiler.GetNumTimers(); i++) {
+        if (profiler.GetTimerName(i) == timerName) {
+          timerName = CreateIndexedPropertyName(timerName,
+                                                SystemChannels.size());
+          break;
+        }
+      }
+    }
+    newChannel->SetProfileTimer(profiler.AddTimer(timerName));
+
     SystemChannels.push_back(newChannel);
 
     if (debug_lvl > 0)
@@ -597,7 +645,7 @@ bool FGFCS::Load(Element* document)
     channel_element = document->FindNextElement("channel");
   }
 
-  PostLoad(document, PropertyManager);
+  PostLoad(document, FDMExec);
 
   return true;
 }
@@ -671,6 +719,16 @@ string FGFCS::GetComponentValues(const string& delimiter) const
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFCS::GetComponentValues(vector<double>& values) const
+{
+  for (unsigned int i=0; i<SystemChannels.size(); i++) {
+    for (unsigned int c=0; c<SystemChannels[i]->GetNumComponents(); c++)
+      values.push_back(SystemChannels[i]->GetComponent(c)->GetOutput());
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFCS::AddThrottle(void)
 {
   ThrottleCmd.push_back(0.0);
@@ -196,6 +196,8 @@ public:
 
   bool InitModel(void);
 
+  void SerializeState(FGStateArchive& archive);
+
   /** Runs the Flight Controls model; called by the Executive
       Can pass in a value indicating if the executive is directing the simulation to Hold.
       @param Holding if true, the executive has been directed to hold the sim from 
@@ -366,6 +368,11 @@ public:
       component outputs */
   std::string GetComponentValues(const std::string& delimiter) const;
 
+  /** Retrieves all component outputs as numbers
+      @param values the vector to which the outputs are appended, in the same
+                    order as the values of GetComponentValues(). */
+  void GetComponentValues(std::vector<double>& values) const;
+
   /// @name Pilot input command setting
   //@{
   /** Sets the aileron command
@@ -74,7 +74,7 @@ public:
   /// Constructor
   FGFCSChannel(FGFCS* FCS, const std::string &name, int execRate,
                FGPropertyNode* node=0)
-    : fcs(FCS), OnOffNode(node), Name(name)
+    : fcs(FCS), OnOffNode(node), Name(name), ProfileTimer(0)
   {
     ExecRate = execRate < 1 ? 1 : execRate;
     // Set ExecFrameCountSinceLastRun so that each components are initialized
@@ -113,6 +113,13 @@ public:
     // after a reset.
     ExecFrameCountSinceLastRun = ExecRate;
   }
+  /// Saves or restores the frame counter and the states of the components.
+  void SerializeState(FGStateArchive& archive) {
+    archive.Sync(ExecFrameCountSinceLastRun);
+    archive.SyncCount(FCSComponents.size(), "components");
+    for (auto comp: FCSComponents)
+      comp->SerializeState(archive);
+  }
   /// Executes all the components in a channel.
   void Execute() {
     // If there is an on/off property supplied for this channel, check
@@ -137,12 +144,17 @@ public:
   }
   /// Get the channel rate
   int GetRate(void) const { return ExecRate; }
+  /// Sets the index of the profiler timer of this channel.
+  void SetProfileTimer(unsigned int timer) { ProfileTimer = timer; }
+  /// Returns the index of the profiler timer of this channel.
+  unsigned int GetProfileTimer(void) const { return ProfileTimer; }
 
   private:
     FGFCS* fcs;
     FCSCompVec FCSComponents;
     FGConstPropertyNode_ptr OnOffNode;
     std::string Name;
+    unsigned int ProfileTimer;
 
     int ExecRate;        // rate at which this system executes, 0 or 1 every frame, 2 every second frame etc..
     int ExecFrameCountSinceLastRun;
@@ -220,7 +220,7 @@ FGGasCell::FGGasCell(FGFDMExec* exec, Element* el, unsigned int num,
   if (Element* heat = el->FindElement("heat")) {
     Element* function_element = heat->FindElement("function");
     while (function_element) {
-      HeatTransferCoeff.push_back(new FGFunction(PropertyManager,
+      HeatTransferCoeff.push_back(new FGFunction(exec,
                                                  function_element));
       function_element = heat->FindNextElement("function");
     }
@@ -256,6 +256,20 @@ FGGasCell::~FGGasCell()
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGGasCell::SerializeState(FGStateArchive& archive)
+{
+  FGForce::SerializeState(archive);
+
+  archive.Sync(Pressure, Contents, Volume, dVolumeIdeal, Temperature, Buoyancy,
+               ValveOpen, Mass, gasCellJ, gasCellM);
+
+  archive.SyncCount(Ballonet.size(), "ballonets");
+  for (auto ballonet: Ballonet)
+    ballonet->SerializeState(archive);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGGasCell::Calculate(double dt)
 {
   const double AirTemperature = in.Temperature;  // [Rankine]
@@ -654,7 +668,7 @@ FGBallonet::FGBallonet(FGFDMExec* exec, Element* el, unsigned int num,
   if (Element* heat = el->FindElement("heat")) {
     Element* function_element = heat->FindElement("function");
     while (function_element) {
-      HeatTransferCoeff.push_back(new FGFunction(PropertyManager,
+      HeatTransferCoeff.push_back(new FGFunction(exec,
                                                  function_element));
       function_element = heat->FindNextElement("function");
     }
@@ -662,7 +676,7 @@ FGBallonet::FGBallonet(FGFDMExec* exec, Element* el, unsigned int num,
   // Read blower input function
   if (Element* blower = el->FindElement("blower_input")) {
     Element* function_element = blower->FindElement("function");
-    BlowerInput = new FGFunction(PropertyManager,
+    BlowerInput = new FGFunction(exec,
                                  function_element);
   }
 }
@@ -684,6 +698,14 @@ FGBallonet::~FGBallonet()
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGBallonet::SerializeState(FGStateArchive& archive)
+{
+  archive.Sync(Pressure, Contents, Volume, dVolumeIdeal, dU, Temperature,
+               ValveOpen, ballonetJ);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGBallonet::Calculate(double dt)
 {
   const double ParentPressure = Parent->GetPressure(); // [lbs/ft^2]
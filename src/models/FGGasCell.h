@@ -185,6 +185,9 @@ public:
    */
   void Calculate(double dt);
 
+  /// Saves or restores the gas and the ballonets of the cell.
+  void SerializeState(FGStateArchive& archive);
+
   /** Get the index of this gas cell
       @return gas cell index. */
   int GetIndex(void) const {return CellNum;}
@@ -310,6 +313,9 @@ public:
    */
   void Calculate(double dt);
 
+  /// Saves or restores the air in the ballonet.
+  void SerializeState(FGStateArchive& archive);
+
 
   /** Get the center of gravity location of the ballonet
       @return CoG location in the structural frame in inches. */
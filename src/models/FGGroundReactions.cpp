@@ -94,6 +94,24 @@ bool FGGroundReactions::InitModel(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGGroundReactions::SerializeState(FGStateArchive& archive)
+{
+  FGModel::SerializeState(archive);
+
+  archive.Sync(vForces, vMoments, DsCmd);
+
+  archive.Sync(in.Vground, in.VcalibratedKts, in.Temperature, in.DistanceAGL,
+               in.DistanceASL, in.TotalDeltaT, in.TakeoffThrottle, in.WOW,
+               in.Tb2l, in.Tec2l, in.Tec2b, in.PQR, in.UVW, in.vXYZcg);
+  archive.Sync(in.Location, in.BrakePos, in.FCSGearPos, in.EmptyWeight);
+
+  archive.SyncCount(lGear.size(), "contacts");
+  for (auto gear: lGear)
+    gear->SerializeState(archive);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGGroundReactions::Run(bool Holding)
 {
   if (FGModel::Run(Holding)) return true;
@@ -168,7 +186,7 @@ bool FGGroundReactions::Load(Element* document)
 
   for (unsigned int i=0; i<lGear.size();i++) lGear[i]->bind();
 
-  PostLoad(document, PropertyManager);
+  PostLoad(document, FDMExec);
 
   return true;
 }
@@ -259,6 +277,37 @@ string FGGroundReactions::GetGroundReactionValues(string delimeter) const
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGGroundReactions::GetGroundReactionValues(vector<double>& values) const
+{
+  for (unsigned int i=0;i<lGear.size();i++) {
+    FGLGear *gear = lGear[i];
+    values.push_back(gear->GetWOW() ? 1.0 : 0.0);
+    values.push_back(gear->GetCompLen());
+    values.push_back(gear->GetCompVel());
+    values.push_back(gear->GetCompForce());
+    if (gear->IsBogey()) {
+      values.push_back(gear->GetWheelSideForce());
+      values.push_back(gear->GetWheelRollForce());
+      values.push_back(gear->GetBodyXForce());
+      values.push_back(gear->GetBodyYForce());
+      values.push_back(gear->GetWheelVel(eX));
+      values.push_back(gear->GetWheelVel(eY));
+      values.push_back(gear->GetWheelRollVel());
+      values.push_back(gear->GetWheelSideVel());
+      values.push_back(gear->GetWheelSlipAngle());
+    }
+  }
+
+  FGAccelerations* Accelerations = FDMExec->GetAccelerations();
+
+  for (int i=eX; i<=eZ; i++)
+    values.push_back(Accelerations->GetGroundForces(i));
+  for (int i=eX; i<=eZ; i++)
+    values.push_back(Accelerations->GetGroundMoments(i));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGGroundReactions::bind(void)
 {
   eSurfaceType = ctGROUND;
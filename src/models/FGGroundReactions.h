@@ -83,6 +83,8 @@ public:
   ~FGGroundReactions(void);
 
   bool InitModel(void);
+
+  void SerializeState(FGStateArchive& archive);
   /** Runs the Ground Reactions model; called by the Executive
       Can pass in a value indicating if the executive is directing the simulation to Hold.
       @param Holding if true, the executive has been directed to hold the sim from 
@@ -98,6 +100,9 @@ public:
   double GetMoments(int idx) const {return vMoments(idx);}
   std::string GetGroundReactionStrings(std::string delimeter) const;
   std::string GetGroundReactionValues(std::string delimeter) const;
+  /** Appends the values of GetGroundReactionValues() to a vector as numbers.
+      @param values the vector to which the values are appended. */
+  void GetGroundReactionValues(std::vector<double>& values) const;
   bool GetWOW(void) const;
 
   int GetNumGearUnits(void) const { return (int)lGear.size(); }
@@ -42,7 +42,8 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "input_output/FGInputSocket.h"
 #include "input_output/FGUDPInputSocket.h"
-#include "input_output/FGXMLFileRead.h"
+#include "input_output/FGInputSharedMemory.h"
+#include "input_output/FGXMLDocumentCache.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGModelLoader.h"
  
@@ -87,7 +88,7 @@ bool FGInput::Load(Element* el)
 
   if (!element) return false;
   
-  FGModel::PreLoad(element, PropertyManager);
+  FGModel::PreLoad(element, FDMExec);
 
   size_t idx = InputTypes.size();
   string type = element->GetAttributeValue("type");
@@ -101,6 +102,8 @@ bool FGInput::Load(Element* el)
     Input = new FGInputSocket(FDMExec);
   } else if (type == "QTJSBSIM") {
     Input = new FGUDPInputSocket(FDMExec);
+  } else if (type == "SHARED_MEMORY") {
+    Input = new FGInputSharedMemory(FDMExec);
   } else if (type != string("NONE")) {
     cerr << element->ReadFrom()
          << "Unknown type of input specified in config file" << endl;
@@ -110,7 +113,7 @@ bool FGInput::Load(Element* el)
 
   Input->SetIdx(idx);
   Input->Load(element);
-  PostLoad(element, PropertyManager);
+  PostLoad(element, FDMExec);
 
   InputTypes.push_back(Input);
 
@@ -135,6 +138,17 @@ bool FGInput::InitModel(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGInput::SerializeState(FGStateArchive& archive)
+{
+  FGModel::SerializeState(archive);
+
+  archive.SyncCount(InputTypes.size(), "inputs");
+  for (auto input: InputTypes)
+    input->SerializeState(archive);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGInput::Run(bool Holding)
 {
   if (FDMExec->GetTrimStatus()) return true;
@@ -152,8 +166,7 @@ bool FGInput::Run(bool Holding)
 
 bool FGInput::SetDirectivesFile(const SGPath& fname)
 {
-  FGXMLFileRead XMLFile;
-  Element* document = XMLFile.LoadXMLDocument(fname);
+  Element_ptr document = FDMExec->GetDocumentCache()->Load(fname);
   bool result = Load(document);
 
   if (!result)
@@ -63,6 +63,12 @@ CLASS DOCUMENTATION
       SOCKET      Will eventually send data to a socket input, where NAME
                   would then be the IP address of the machine the data should
                   be sent to. DON'T USE THIS YET!
+                  The optional attribute format="BINARY" reads framed binary
+                  messages which set and get properties by ids instead of
+                  text commands (see FGSocketMessage).
+      SHARED_MEMORY The properties listed in the input directives are read
+                  from the shared memory segment NAME which is written by
+                  another process on the same host (see FGInputSharedMemory).
       NONE        Specifies to do nothing. This setting makes it easy to turn on and
                   off the data input without having to mess with anything else.
 
@@ -101,6 +107,10 @@ public:
       @result true if the execution succeeded. */
   bool InitModel(void);
 
+  /** Saves or restores the frame counters of the model and of its inputs,
+      which schedule their execution. */
+  void SerializeState(FGStateArchive& archive);
+
   /** Runs the Input model; called by the Executive
       Can pass in a value indicating if the executive is directing the simulation to Hold.
       @param Holding if true, the executive has been directed to hold the sim from
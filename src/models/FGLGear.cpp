@@ -111,7 +111,7 @@ FGLGear::FGLGear(Element* el, FGFDMExec* fdmex, int number, const struct Inputs&
   Element* strutForce = el->FindElement("strut_force");
   if (strutForce) {
     Element* springFunc = strutForce->FindElement("function");
-    fStrutForce = new FGFunction(PropertyManager, springFunc);
+    fStrutForce = new FGFunction(fdmex, springFunc);
   }
   else {
     if (el->FindElement("spring_coeff"))
@@ -273,6 +273,31 @@ void FGLGear::ResetToIC(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGLGear::SerializeState(FGStateArchive& archive)
+{
+  FGForce::SerializeState(archive);
+
+  // The surface under the gear
+  archive.Sync(eSurfaceType, staticFFactor, rollingFFactor, maximumForce,
+               bumpiness, isSolid, staticFCoeff, dynamicFCoeff);
+
+  archive.Sync(mTGear, vLocalGear, vWhlVelVec, vGroundWhlVel, vGroundNormal);
+  archive.Sync(SteerAngle, compressLength, compressSpeed, rollingFCoeff,
+               BrakeFCoeff, SinkRate, GroundSpeed, TakeoffDistanceTraveled,
+               TakeoffDistanceTraveled50ft, LandingDistanceTraveled,
+               MaximumStrutForce, StrutForce, MaximumStrutTravel, FCoeff,
+               WheelSlip, GearPos);
+  archive.Sync(WOW, lastWOW, FirstContact, StartedGroundRun, LandingReported,
+               TakeoffReported, ReportEnable, Castered, StaticFriction,
+               useFCSGearPos);
+
+  for (auto& multiplier: LMultiplier)
+    archive.Sync(multiplier.ForceJacobian, multiplier.LeverArm, multiplier.Min,
+                 multiplier.Max, multiplier.value);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 const FGColumnVector3& FGLGear::GetBodyForces(FGSurface *surface)
 {
   double gearPos = 1.0;
@@ -530,7 +555,7 @@ void FGLGear::ReportTakeoffOrLanding(void)
   {
     ostringstream buf;
     buf << "GEAR_CONTACT: " << fdmex->GetSimTime() << " seconds: " << name;
-    PutMessage(buf.str(), WOW);
+    fdmex->PutMessage(buf.str(), WOW);
   }
 }
 
@@ -546,7 +571,7 @@ void FGLGear::CrashDetect(void)
   {
     ostringstream buf;
     buf << "*CRASH DETECTED* " << fdmex->GetSimTime() << " seconds: " << name;
-    PutMessage(buf.str());
+    fdmex->PutMessage(buf.str());
     // fdmex->SuspendIntegration();
   }
 }
@@ -320,6 +320,9 @@ public:
   const struct Inputs& in;
 
   void ResetToIC(void);
+  /** Saves or restores the compression and the contact of the gear, its
+      friction and the progress of the takeoff and landing reports. */
+  void SerializeState(FGStateArchive& archive);
   void bind(void);
 
 private:
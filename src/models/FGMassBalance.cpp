@@ -99,6 +99,24 @@ bool FGMassBalance::InitModel(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGMassBalance::SerializeState(FGStateArchive& archive)
+{
+  FGModel::SerializeState(archive);
+
+  archive.Sync(Weight, EmptyWeight, Mass, mJ, mJinv, pmJ, baseJ);
+  archive.Sync(vXYZcg, vLastXYZcg, vDeltaXYZcg, vDeltaXYZcgBody, vXYZtank,
+               vbaseXYZcg, vPMxyz, PointMassCG);
+
+  archive.SyncCount(PointMasses.size(), "point masses");
+  for (auto pm: PointMasses)
+    archive.Sync(pm->Weight, pm->Location, pm->mPMInertia);
+
+  archive.Sync(in.GasMass, in.TanksWeight, in.GasMoment, in.GasInertia,
+               in.TanksMoment, in.TankInertia);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 static FGMatrix33 ReadInertiaMatrix(Element* document)
 {
   double bixx, biyy, bizz, bixy, bixz, biyz;
@@ -167,7 +185,7 @@ bool FGMassBalance::Load(Element* document)
 
   Mass = lbtoslug*Weight;
 
-  PostLoad(document, PropertyManager);
+  PostLoad(document, FDMExec);
 
   Debug(2);
   return true;
@@ -113,6 +113,8 @@ public:
 
   virtual bool Load(Element* el);
   bool InitModel(void);
+
+  void SerializeState(FGStateArchive& archive);
   /** Runs the Mass Balance model; called by the Executive
       Can pass in a value indicating if the executive is directing the simulation to Hold.
       @param Holding if true, the executive has been directed to hold the sim from 
@@ -86,6 +86,14 @@ bool FGModel::InitModel(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGModel::SerializeState(FGStateArchive& archive)
+{
+  FGModelFunctions::SerializeState(archive);
+  archive.Sync(exe_ctr);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGModel::Run(bool Holding)
 {
   if (debug_lvl & 4) cout << "Entering Run() for model " << Name << endl;
@@ -124,7 +132,7 @@ bool FGModel::Load(Element* el, bool preLoad)
   bool result = true;
 
   if (preLoad)
-    result = FGModelFunctions::Load(document, PropertyManager);
+    result = FGModelFunctions::Load(document, FDMExec);
 
   if (document != el) {
     el->MergeAttributes(document);
@@ -41,6 +41,7 @@ INCLUDES
 #include <string>
 
 #include "math/FGModelFunctions.h"
+#include "input_output/FGStateArchive.h"
 #include "simgear/misc/sg_path.hxx"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -88,11 +89,17 @@ public:
   virtual bool Run(bool Holding);
 
   virtual bool InitModel(void);
+
+  /** Saves or restores the state of the model. The models which hold a state
+      override this method, calling the base class method first.
+      @see FGFDMExec::SaveState, FGFDMExec::RestoreState */
+  virtual void SerializeState(FGStateArchive& archive);
+
   /// Set the ouput rate for the model in frames
   void SetRate(unsigned int tt) {rate = tt;}
   /// Get the output rate for the model in frames
   unsigned int GetRate(void)   {return rate;}
-  FGFDMExec* GetExec(void)     {return FDMExec;}
+  FGFDMExec* GetExec(void) const {return FDMExec;}
 
   void SetPropertyManager(FGPropertyManager *fgpm) { PropertyManager=fgpm;}
   virtual SGPath FindFullPathName(const SGPath& path) const;
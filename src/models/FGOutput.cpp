@@ -43,8 +43,11 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "input_output/FGOutputSocket.h"
 #include "input_output/FGOutputTextFile.h"
+#include "input_output/FGOutputBinaryFile.h"
+#include "input_output/FGOutputCompressedFile.h"
+#include "input_output/FGOutputSharedMemory.h"
 #include "input_output/FGOutputFG.h"
-#include "input_output/FGXMLFileRead.h"
+#include "input_output/FGXMLDocumentCache.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGModelLoader.h"
 #include "math/FGTemplateFunc.h"
@@ -74,8 +77,11 @@ FGOutput::FGOutput(FGFDMExec* fdmex) : FGModel(fdmex)
 FGOutput::~FGOutput()
 {
   vector<FGOutputType*>::iterator itv;
-  for (itv = OutputTypes.begin(); itv != OutputTypes.end(); ++itv)
+  for (itv = OutputTypes.begin(); itv != OutputTypes.end(); ++itv) {
+    // The writer thread must be stopped while the output still exists.
+    (*itv)->SetAsync(false);
     delete (*itv);
+  }
 
   Debug(1);
 }
@@ -97,6 +103,17 @@ bool FGOutput::InitModel(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGOutput::SerializeState(FGStateArchive& archive)
+{
+  FGModel::SerializeState(archive);
+
+  archive.SyncCount(OutputTypes.size(), "outputs");
+  for (auto output: OutputTypes)
+    output->SerializeState(archive);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGOutput::Run(bool Holding)
 {
   if (FDMExec->GetTrimStatus()) return true;
@@ -181,8 +198,7 @@ string FGOutput::GetOutputName(unsigned int idx) const
 
 bool FGOutput::SetDirectivesFile(const SGPath& fname)
 {
-  FGXMLFileRead XMLFile;
-  Element* document = XMLFile.LoadXMLDocument(fname);
+  Element_ptr document = FDMExec->GetDocumentCache()->Load(fname);
   bool result = Load(document);
 
   if (!result)
@@ -212,6 +228,12 @@ bool FGOutput::Load(int subSystems, std::string protocol, std::string type,
     FGOutputTextFile* OutputTextFile = new FGOutputTextFile(FDMExec);
     OutputTextFile->SetDelimiter("\t");
     Output = OutputTextFile;
+  } else if (type == "BINARY") {
+    Output = new FGOutputBinaryFile(FDMExec);
+  } else if (type == "COMPRESSED") {
+    Output = new FGOutputCompressedFile(FDMExec);
+  } else if (type == "SHARED_MEMORY") {
+    Output = new FGOutputSharedMemory(FDMExec);
   } else if (type == "SOCKET") {
     Output = new FGOutputSocket(FDMExec);
     name += ":" + port + "/" + protocol;
@@ -256,7 +278,7 @@ bool FGOutput::Load(Element* document, const SGPath& dir)
 
     if (fType == "template") {
       string name = function->GetAttributeValue("name");
-      TemplateFunctions[name] = new FGTemplateFunc(PropertyManager, function);
+      TemplateFunctions[name] = new FGTemplateFunc(FDMExec, function);
     }
 
     function = document->FindNextElement("function");
@@ -274,6 +296,12 @@ bool FGOutput::Load(Element* document, const SGPath& dir)
     Output = new FGOutputTextFile(FDMExec);
   } else if (type == "TABULAR") {
     Output = new FGOutputTextFile(FDMExec);
+  } else if (type == "BINARY") {
+    Output = new FGOutputBinaryFile(FDMExec);
+  } else if (type == "COMPRESSED") {
+    Output = new FGOutputCompressedFile(FDMExec);
+  } else if (type == "SHARED_MEMORY") {
+    Output = new FGOutputSharedMemory(FDMExec);
   } else if (type == "SOCKET") {
     Output = new FGOutputSocket(FDMExec);
   } else if (type == "FLIGHTGEAR") {
@@ -287,9 +315,9 @@ bool FGOutput::Load(Element* document, const SGPath& dir)
   if (!Output) return false;
 
   Output->SetIdx(idx);
-  Output->PreLoad(document, PropertyManager);
+  Output->PreLoad(document, FDMExec);
   Output->Load(document);
-  Output->PostLoad(document, PropertyManager);
+  Output->PostLoad(document, FDMExec);
 
   OutputTypes.push_back(Output);
 
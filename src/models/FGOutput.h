@@ -69,10 +69,23 @@ CLASS DOCUMENTATION
       SOCKET      Will eventually send data to a socket output, where NAME
                   would then be the IP address of the machine the data should
                   be sent to. DON'T USE THIS YET!
+                  The optional attribute format="BINARY" sends framed binary
+                  messages instead of text (see FGSocketMessage).
       FLIGHTGEAR  A socket is created for sending binary data packets to
                   an external instance of FlightGear for visuals.  Parameters
                   defining the socket are given on the \<output> line.
       TABULAR     Columnar data.
+      BINARY      Raw little-endian numbers preceded by a header describing
+                  the columns (see FGOutputBinaryFile). The optional
+                  attribute precision="single" writes floats instead of
+                  doubles.
+      COMPRESSED  The columns of the CSV output compressed without loss in
+                  chunks indexed by time (see FGOutputCompressedFile). The
+                  optional attribute chunk sets the number of output steps
+                  per chunk.
+      SHARED_MEMORY The columns of the CSV output are written to the
+                  shared memory segment NAME which can be read by other
+                  processes on the same host (see FGOutputSharedMemory).
       TERMINAL    Output to terminal. NOT IMPLEMENTED YET!
       NONE        Specifies to do nothing. This setting makes it easy to turn on and
                   off the data output without having to mess with anything else.
@@ -96,6 +109,12 @@ CLASS DOCUMENTATION
                 value may not be *exactly* what you want, due to the dependence
                 on dt, the cycle rate for the FDM.
 
+    ASYNC       When set to "true", the output is formatted and written by a
+                background thread so that a slow disk or network peer does
+                not stall the simulation (see FGOutputType). The attributes
+                QUEUE and OVERFLOW (block, drop-oldest or drop-newest) set
+                the size of the queue and what to do when it is full.
+
     The following parameters tell which subsystems of data to output:
 
     simulation       ON|OFF
@@ -135,6 +154,11 @@ public:
       properly.
       @result true if the execution succeeded. */
   bool InitModel(void);
+
+  /** Saves or restores the frame counters of the model and of its outputs,
+      which schedule their execution. */
+  void SerializeState(FGStateArchive& archive);
+
   /** Runs the Output model; called by the Executive.
       Can pass in a value indicating if the executive is directing the
       simulation to Hold.
@@ -102,6 +102,8 @@ FGPropagate::FGPropagate(FGFDMExec* fdmex)
   VState.dqInertialVelocity.resize(5, FGColumnVector3(0.0,0.0,0.0));
   VState.dqQtrndot.resize(5, FGQuaternion(0.0,0.0,0.0));
 
+  VState.vLocation.SetGroundCallback(fdmex->GetGroundCallbackPtr());
+
   bind();
   Debug(0);
 }
@@ -190,6 +192,29 @@ void FGPropagate::InitializeDerivatives()
   VState.dqQtrndot.assign(5, VState.vQtrndot);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropagate::SerializeState(FGStateArchive& archive)
+{
+  FGModel::SerializeState(archive);
+
+  archive.Sync(VState.vLocation, VState.vUVW, VState.vPQR, VState.vPQRi,
+               VState.qAttitudeLocal, VState.qAttitudeECI, VState.vQtrndot,
+               VState.vInertialVelocity, VState.vInertialPosition);
+  archive.Sync(VState.dqPQRidot, VState.dqUVWidot, VState.dqInertialVelocity,
+               VState.dqQtrndot);
+
+  archive.Sync(vVel, Tec2b, Tb2ec, Tl2b, Tb2l, Tl2ec, Tec2l, Tec2i, Ti2ec, Ti2b,
+               Tb2i, Ti2l, Tl2i, Qec2b);
+  archive.Sync(LocalTerrainVelocity, LocalTerrainAngularVelocity);
+  archive.Sync(integrator_rotational_rate, integrator_translational_rate,
+               integrator_rotational_position,
+               integrator_translational_position);
+
+  archive.Sync(in.vPQRidot, in.vUVWidot, in.vOmegaPlanet, in.SemiMajor,
+               in.SemiMinor, in.DeltaT);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 /*
 Purpose: Called on a schedule to perform EOM integration
@@ -162,6 +162,10 @@ public:
 
   void InitializeDerivatives();
 
+  /** Saves or restores the state vector, the past values of the derivatives
+      used by the multi-step integrators and the transformation matrices. */
+  void SerializeState(FGStateArchive& archive);
+
   /** Runs the state propagation model; called by the Executive
       Can pass in a value indicating if the executive is directing the simulation to Hold.
       @param Holding if true, the executive has been directed to hold the sim from
@@ -128,6 +128,31 @@ bool FGPropulsion::InitModel(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGPropulsion::SerializeState(FGStateArchive& archive)
+{
+  FGModel::SerializeState(archive);
+
+  archive.Sync(ActiveEngine, vForces, vMoments, vTankXYZ, vXYZtank_arm, tankJ,
+               FuelFreeze, DumpRate, RefuelRate);
+
+  archive.Sync(in.Pressure, in.PressureRatio, in.Temperature, in.Density,
+               in.DensityRatio, in.Soundspeed, in.TotalPressure, in.TAT_c,
+               in.Vt, in.Vc, in.qbar, in.alpha, in.beta, in.H_agl,
+               in.AeroUVW, in.AeroPQR, in.PQRi);
+  archive.Sync(in.ThrottleCmd, in.MixtureCmd, in.ThrottlePos, in.MixturePos,
+               in.PropAdvance, in.PropFeather, in.TotalDeltaT);
+
+  archive.SyncCount(Tanks.size(), "tanks");
+  for (auto tank: Tanks)
+    tank->SerializeState(archive);
+
+  archive.SyncCount(Engines.size(), "engines");
+  for (auto engine: Engines)
+    engine->SerializeState(archive);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGPropulsion::Run(bool Holding)
 {
   unsigned int i;
@@ -140,7 +165,9 @@ bool FGPropulsion::Run(bool Holding)
   vForces.InitMatrix();
   vMoments.InitMatrix();
 
+  FGProfiler& profiler = FDMExec->GetProfiler();
   for (i=0; i<numEngines; i++) {
+    FGProfiler::Sample sample(profiler, EngineTimers[i]);
     Engines[i]->Calculate();
     ConsumeFuel(Engines[i]);
     vForces  += Engines[i]->GetBodyForces();  // sum body frame forces
@@ -434,6 +461,8 @@ bool FGPropulsion::Load(Element* el)
       return false;
     }
 
+    EngineTimers.push_back(FDMExec->GetProfiler().AddTimer(
+                   CreateIndexedPropertyName("propulsion/engine", numEngines)));
     numEngines++;
 
     engine_element = el->FindNextElement("engine");
@@ -452,7 +481,7 @@ bool FGPropulsion::Load(Element* el)
   }
 
 
-  PostLoad(el, PropertyManager);
+  PostLoad(el, FDMExec);
 
   return true;
 }
@@ -526,6 +555,17 @@ string FGPropulsion::GetPropulsionValues(const string& delimiter) const
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGPropulsion::GetPropulsionValues(vector<double>& values) const
+{
+  for (auto engine: Engines)
+    engine->GetEngineValues(values);
+
+  for (auto tank: Tanks)
+    values.push_back(tank->GetContents());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 string FGPropulsion::GetPropulsionTankReport()
 {
   string out="";
@@ -117,6 +117,8 @@ public:
 
   bool InitModel(void);
 
+  void SerializeState(FGStateArchive& archive);
+
   /** Loads the propulsion system (engine[s] and tank[s]).
       Characteristics of the propulsion system are read in from the config file.
       @param el pointer to an XML element that contains the engine information.
@@ -159,6 +161,9 @@ public:
 
   std::string GetPropulsionStrings(const std::string& delimiter) const;
   std::string GetPropulsionValues(const std::string& delimiter) const;
+  /** Appends the values of GetPropulsionValues() to a vector as numbers.
+      @param values the vector to which the values are appended. */
+  void GetPropulsionValues(std::vector<double>& values) const;
   std::string GetPropulsionTankReport();
 
   const FGColumnVector3& GetForces(void) const {return vForces; }
@@ -191,6 +196,7 @@ public:
 private:
   std::vector <FGEngine*>   Engines;
   std::vector <FGTank*>     Tanks;
+  std::vector <unsigned int> EngineTimers;
   unsigned int numSelectedFuelTanks;
   unsigned int numSelectedOxiTanks;
   unsigned int numFuelTanks;
@@ -150,6 +150,17 @@ bool FGStandardAtmosphere::InitModel(void)
 
   return true;
 }
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStandardAtmosphere::SerializeState(FGStateArchive& archive)
+{
+  FGAtmosphere::SerializeState(archive);
+
+  archive.Sync(TemperatureBias, TemperatureDeltaGradient,
+               GradientFadeoutAltitude, VaporPressure, SaturatedVaporPressure,
+               LapseRates, PressureBreakpoints);
+}
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGStandardAtmosphere::Calculate(double altitude)
@@ -103,6 +103,8 @@ public:
 
   bool InitModel(void);
 
+  void SerializeState(FGStateArchive& archive);
+
   //  *************************************************************************
   /// @name Temperature access functions.
   /// There are several ways to get the temperature, and several modeled temperature
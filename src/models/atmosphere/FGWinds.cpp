@@ -83,6 +83,13 @@ FGWinds::FGWinds(FGFDMExec* fdmex) : FGModel(fdmex)
   spike = target_time = strength = 0.0;
   wind_from_clockwise = 0.0;
   psiw = 0.0;
+  generator = fdmex->GetRandomGenerator();
+
+  xi_u_km1 = nu_u_km1 = 0.0;
+  xi_v_km1 = xi_v_km2 = nu_v_km1 = nu_v_km2 = 0.0;
+  xi_w_km1 = xi_w_km2 = nu_w_km1 = nu_w_km2 = 0.0;
+  xi_p_km1 = nu_p_km1 = 0.0;
+  xi_q_km1 = xi_r_km1 = 0.0;
 
   vGustNED.InitMatrix();
   vTurbulenceNED.InitMatrix();
@@ -136,6 +143,35 @@ bool FGWinds::InitModel(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGWinds::SerializeState(FGStateArchive& archive)
+{
+  FGModel::SerializeState(archive);
+
+  archive.Sync(MagnitudedAccelDt, MagnitudeAccel, Magnitude, TurbDirection,
+               TurbGain, TurbRate, Rhythmicity, wind_from_clockwise, spike,
+               target_time, strength, turbType);
+  archive.Sync(vTurbulenceGrad, vBodyTurbGrad, vTurbPQR);
+  archive.Sync(windspeed_at_20ft, probability_of_exceedence_index);
+  archive.Sync(xi_u_km1, nu_u_km1, xi_v_km1, xi_v_km2, nu_v_km1, nu_v_km2,
+               xi_w_km1, xi_w_km2, nu_w_km1, nu_w_km2, xi_p_km1, nu_p_km1,
+               xi_q_km1, xi_r_km1);
+  archive.Sync(psiw, vTotalWindNED, vWindNED, vGustNED, vCosineGust,
+               vBurstGust, vTurbulenceNED);
+
+  archive.Sync(oneMinusCosineGust.vWind, oneMinusCosineGust.vWindTransformed,
+               oneMinusCosineGust.magnitude, oneMinusCosineGust.gustFrame,
+               oneMinusCosineGust.gustProfile);
+
+  archive.SyncCount(UpDownBurstCells.size(), "downburst cells");
+  for (auto cell: UpDownBurstCells)
+    archive.Sync(*cell);
+
+  archive.Sync(in.V, in.wingspan, in.DistanceAGL, in.AltitudeASL, in.longitude,
+               in.latitude, in.planetRadius, in.Tl2b, in.Tw2b, in.totalDeltaT);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGWinds::Run(bool Holding)
 {
   if (FGModel::Run(Holding)) return true;
@@ -213,7 +249,7 @@ void FGWinds::Turbulence(double h)
 
     double random = 0.0;
     if (target_time == 0.0) {
-      strength = random = 1 - 2.0*(double(rand())/double(RAND_MAX));
+      strength = random = generator->GetUniformRandomNumber();
       target_time = time + 0.71 + (random * 0.5);
     }
     if (time > target_time) {
@@ -278,16 +314,6 @@ void FGWinds::Turbulence(double h)
       sig_u = sig_w = POE_Table->GetValue(probability_of_exceedence_index, h);
     }
 
-    // keep values from last timesteps
-    // TODO maybe use deque?
-    static double
-      xi_u_km1 = 0, nu_u_km1 = 0,
-      xi_v_km1 = 0, xi_v_km2 = 0, nu_v_km1 = 0, nu_v_km2 = 0,
-      xi_w_km1 = 0, xi_w_km2 = 0, nu_w_km1 = 0, nu_w_km2 = 0,
-      xi_p_km1 = 0, nu_p_km1 = 0,
-      xi_q_km1 = 0, xi_r_km1 = 0;
-
-
     double
       T_V = in.totalDeltaT, // for compatibility of nomenclature
       sig_p = 1.9/sqrt(L_w*b_w)*sig_w, // Yeager1998, eq. (8)
@@ -299,10 +325,10 @@ void FGWinds::Turbulence(double h)
       tau_p = L_p/in.V, // eq. (9)
       tau_q = 4*b_w/M_PI/in.V, // eq. (13)
       tau_r =3*b_w/M_PI/in.V, // eq. (17)
-      nu_u = GaussianRandomNumber(),
-      nu_v = GaussianRandomNumber(),
-      nu_w = GaussianRandomNumber(),
-      nu_p = GaussianRandomNumber(),
+      nu_u = generator->GetNormalRandomNumber(),
+      nu_v = generator->GetNormalRandomNumber(),
+      nu_w = generator->GetNormalRandomNumber(),
+      nu_p = generator->GetNormalRandomNumber(),
       xi_u=0, xi_v=0, xi_w=0, xi_p=0, xi_q=0, xi_r=0;
 
     // values of turbulence NED velocities
@@ -38,6 +38,8 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <memory>
+
 #include "models/FGModel.h"
 #include "math/FGColumnVector3.h"
 #include "math/FGMatrix33.h"
@@ -126,6 +128,8 @@ public:
       @return false if no error */
   bool Run(bool Holding);
   bool InitModel(void);
+
+  void SerializeState(FGStateArchive& archive);
   enum tType {ttNone, ttStandard, ttCulp, ttMilspec, ttTustin} turbType;
 
   // TOTAL WIND access functions (wind + gust + turbulence)
@@ -331,6 +335,15 @@ private:
   int probability_of_exceedence_index; ///< this is bound as the severity property
   FGTable *POE_Table; ///< probability of exceedence table
 
+  std::shared_ptr<RandomNumberGenerator> generator;
+
+  // values of the Dryden turbulence filters at the last timesteps
+  double xi_u_km1, nu_u_km1;
+  double xi_v_km1, xi_v_km2, nu_v_km1, nu_v_km2;
+  double xi_w_km1, xi_w_km2, nu_w_km1, nu_w_km2;
+  double xi_p_km1, nu_p_km1;
+  double xi_q_km1, xi_r_km1;
+
   double psiw;
   FGColumnVector3 vTotalWindNED;
   FGColumnVector3 vWindNED;
@@ -134,6 +134,7 @@ public:
   ~FGAccelerometer();
 
   bool Run (void);
+  void SerializeState(FGStateArchive& archive);
 
 private:
   FGPropagate* Propagate;
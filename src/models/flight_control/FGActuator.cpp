@@ -149,6 +149,17 @@ void FGActuator::ResetPastStates(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGActuator::SerializeState(FGStateArchive& archive)
+{
+  FGFCSComponent::SerializeState(archive);
+
+  archive.Sync(bias, PreviousOutput, PreviousHystOutput, PreviousRateLimOutput,
+               PreviousLagInput, PreviousLagOutput, fail_zero, fail_hardover,
+               fail_stuck, initialized, saturated);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGActuator::Run(void )
 {
   Input = InputNodes[0]->getDoubleValue();
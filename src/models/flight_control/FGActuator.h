@@ -133,6 +133,7 @@ public:
       limiting, etc. functions. */
   bool Run (void);
   void ResetPastStates(void);
+  void SerializeState(FGStateArchive& archive);
 
   // these may need to have the bool argument replaced with a double
   /** This function fails the actuator to zero. The motion to zero
@@ -215,6 +215,13 @@ void FGFCSComponent::ResetPastStates(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFCSComponent::SerializeState(FGStateArchive& archive)
+{
+  archive.Sync(Input, Output, output_array, index);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFCSComponent::SetOutput(void)
 {
   for (auto node: OutputNodes)
@@ -42,6 +42,7 @@ INCLUDES
 
 #include "FGJSBBase.h"
 #include "math/FGPropertyValue.h"
+#include "input_output/FGStateArchive.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -99,6 +100,10 @@ public:
   std::string GetType(void) const { return Type; }
   virtual double GetOutputPct(void) const { return 0; }
   virtual void ResetPastStates(void);
+  /** Saves or restores the past states of the component. The components
+      which hold more past states override this method, calling the base
+      class method first. */
+  virtual void SerializeState(FGStateArchive& archive);
 
 protected:
   FGFCS* fcs;
@@ -42,6 +42,7 @@ INCLUDES
 
 #include "FGFCSFunction.h"
 #include "input_output/FGXMLElement.h"
+#include "models/FGFCS.h"
 
 using namespace std;
 
@@ -58,7 +59,7 @@ FGFCSFunction::FGFCSFunction(FGFCS* fcs, Element* element) : FGFCSComponent(fcs,
   Element *function_element = element->FindElement("function");
 
   if (function_element)
-    function = new FGFunction(PropertyManager, function_element);
+    function = new FGFunction(fcs->GetExec(), function_element);
   else {
     cerr << "FCS Function should contain a \"function\" element" << endl;
     exit(-1);
@@ -91,6 +91,16 @@ void FGFilter::ResetPastStates(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFilter::SerializeState(FGStateArchive& archive)
+{
+  FGFCSComponent::SerializeState(archive);
+
+  archive.Sync(Initialize, PreviousInput1, PreviousInput2, PreviousOutput1,
+               PreviousOutput2);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFilter::ReadFilterCoefficients(Element* element, int index)
 {
   // index is known to be 1-7. 
@@ -221,6 +221,7 @@ public:
   bool Run (void);
 
   void ResetPastStates(void);
+  void SerializeState(FGStateArchive& archive);
 
 private:
   bool DynamicFilter;
@@ -111,6 +111,7 @@ public:
   ~FGGyro();
 
   bool Run (void);
+  void SerializeState(FGStateArchive& archive);
 
 private:
   FGAccelerations* Accelerations;
@@ -125,6 +125,7 @@ public:
   ~FGMagnetometer();
 
   bool Run (void);
+  void SerializeState(FGStateArchive& archive);
 
 private:
   FGPropagate* Propagate;
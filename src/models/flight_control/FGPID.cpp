@@ -155,6 +155,15 @@ void FGPID::ResetPastStates(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGPID::SerializeState(FGStateArchive& archive)
+{
+  FGFCSComponent::SerializeState(archive);
+
+  archive.Sync(I_out_total, Input_prev, Input_prev2);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGPID::Run(void )
 {
   double I_out_delta = 0.0;
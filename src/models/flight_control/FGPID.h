@@ -130,6 +130,7 @@ public:
 
   bool Run (void);
   void ResetPastStates(void);
+  void SerializeState(FGStateArchive& archive);
 
     /// These define the indices use to select the various integrators.
   enum eIntegrateType {eNone = 0, eRectEuler, eTrapezoidal, eAdamsBashforth2, eAdamsBashforth3};
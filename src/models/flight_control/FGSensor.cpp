@@ -42,6 +42,8 @@ INCLUDES
 
 #include "FGSensor.h"
 #include "input_output/FGXMLElement.h"
+#include "models/FGFCS.h"
+#include "FGFDMExec.h"
 
 using namespace std;
 
@@ -62,6 +64,7 @@ FGSensor::FGSensor(FGFCS* fcs, Element* element) : FGFCSComponent(fcs, element)
   granularity = 0.0;
   noise_type = 0;
   fail_low = fail_high = fail_stuck = false;
+  generator = fcs->GetExec()->GetRandomGenerator();
 
   Element* quantization_element = element->FindElement("quantization");
   if ( quantization_element) {
@@ -142,6 +145,16 @@ void FGSensor::ResetPastStates(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGSensor::SerializeState(FGStateArchive& archive)
+{
+  FGFCSComponent::SerializeState(archive);
+
+  archive.Sync(drift, PreviousOutput, PreviousInput, fail_low, fail_high,
+               fail_stuck);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGSensor::Run(void)
 {
   Input = InputNodes[0]->getDoubleValue();
@@ -186,9 +199,9 @@ void FGSensor::Noise(void)
   double random_value=0.0;
 
   if (DistributionType == eUniform) {
-    random_value = 2.0*(((double)rand()/(double)RAND_MAX) - 0.5);
+    random_value = generator->GetUniformRandomNumber();
   } else {
-    random_value = GaussianRandomNumber();
+    random_value = generator->GetNormalRandomNumber();
   }
 
   switch( NoiseType ) {
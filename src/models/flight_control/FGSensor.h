@@ -39,6 +39,7 @@ INCLUDES
 
 #include "FGFCSComponent.h"
 #include <string>
+#include <memory>
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -142,6 +143,7 @@ public:
 
   virtual bool Run (void);
   void ResetPastStates(void);
+  void SerializeState(FGStateArchive& archive);
 
 protected:
   enum eNoiseType {ePercent=0, eAbsolute} NoiseType;
@@ -167,6 +169,7 @@ protected:
   bool fail_high;
   bool fail_stuck;
   std::string quant_property;
+  std::shared_ptr<RandomNumberGenerator> generator;
 
   void ProcessSensorSignal(void);
   void Noise(void);
@@ -158,6 +158,15 @@ bool FGSwitch::Run(void )
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGSwitch::SerializeState(FGStateArchive& archive)
+{
+  FGFCSComponent::SerializeState(archive);
+
+  archive.Sync(initialized);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGSwitch::VerifyProperties(void)
 {
   for (auto test: tests) {
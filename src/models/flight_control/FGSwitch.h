@@ -143,6 +143,7 @@ public:
   /** Executes the switch logic.
       @return true - always*/
   bool Run(void);
+  void SerializeState(FGStateArchive& archive);
 
 private:
 
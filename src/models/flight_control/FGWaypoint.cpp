@@ -41,6 +41,7 @@ INCLUDES
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGPropertyManager.h"
 #include "math/FGLocation.h"
+#include "models/FGFCS.h"
 
 using namespace std;
 
@@ -123,6 +124,7 @@ FGWaypoint::FGWaypoint(FGFCS* fcs, Element* element) : FGFCSComponent(fcs, eleme
   else {
     FGLocation source(source_longitude * source_latitude_unit,
                       source_latitude * source_longitude_unit, 1.0);
+    source.SetGroundCallback(fcs->GetExec()->GetGroundCallbackPtr());
     radius = source.GetSeaLevelRadius(); // Radius of Earth in feet.
   }
 
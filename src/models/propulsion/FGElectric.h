@@ -73,10 +73,12 @@ public:
   ~FGElectric();
 
   void Calculate(void);
+  void SerializeState(FGStateArchive& archive);
   double GetPowerAvailable(void) {return (HP * hptoftlbssec);}
   double getRPM(void) {return RPM;}
   std::string GetEngineLabels(const std::string& delimiter);
   std::string GetEngineValues(const std::string& delimiter);
+  void GetEngineValues(std::vector<double>& values);
 
 private:
 
@@ -97,6 +97,19 @@ void FGEngine::ResetToIC(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGEngine::SerializeState(FGStateArchive& archive)
+{
+  FGModelFunctions::SerializeState(archive);
+
+  archive.Sync(FuelExpended, FuelFlowRate, PctPower, Starter, Starved, Running,
+               Cranking, FuelFreeze, FuelFlow_gph, FuelFlow_pph, FuelUsedLbs,
+               FuelDensity);
+
+  Thruster->SerializeState(archive);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 double FGEngine::CalcFuelNeed(void)
 {
   FuelFlowRate = SLFuelFlowMax*PctPower;
@@ -202,7 +215,7 @@ bool FGEngine::Load(FGFDMExec *exec, Element *engine_element)
 
   Name = engine_element->GetAttributeValue("name");
 
-  FGModelFunctions::Load(engine_element, PropertyManager, to_string((int)EngineNumber)); // Call ModelFunctions loader
+  FGModelFunctions::Load(engine_element, exec, to_string((int)EngineNumber)); // Call ModelFunctions loader
 
 // Find and set engine location
 
@@ -254,7 +267,7 @@ bool FGEngine::Load(FGFDMExec *exec, Element *engine_element)
   property_name = base_property_name + "/fuel-used-lbs";
   PropertyManager->Tie( property_name.c_str(), this, &FGEngine::GetFuelUsedLbs);
 
-  PostLoad(engine_element, PropertyManager, to_string((int)EngineNumber));
+  PostLoad(engine_element, exec, to_string((int)EngineNumber));
 
   Debug(0);
 
@@ -48,6 +48,7 @@ INCLUDES
 
 #include "math/FGModelFunctions.h"
 #include "math/FGColumnVector3.h"
+#include "input_output/FGStateArchive.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -178,6 +179,10 @@ public:
   /** Resets the Engine parameters to the initial conditions */
   virtual void ResetToIC(void);
 
+  /** Saves or restores the state of the engine and of its thruster. The
+      engines override this method, calling the base class method first. */
+  virtual void SerializeState(FGStateArchive& archive);
+
   /** Calculates the thrust of the engine, and other engine functions. */
   virtual void Calculate(void) = 0;
 
@@ -207,6 +212,9 @@ public:
 
   virtual std::string GetEngineLabels(const std::string& delimiter) = 0;
   virtual std::string GetEngineValues(const std::string& delimiter) = 0;
+  /** Appends the values of GetEngineValues() to a vector as numbers.
+      @param values the vector to which the values are appended. */
+  virtual void GetEngineValues(std::vector<double>& values) = 0;
 
   struct Inputs& in;
   void LoadThrusterInputs();
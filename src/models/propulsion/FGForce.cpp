@@ -84,6 +84,13 @@ FGForce::~FGForce()
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGForce::SerializeState(FGStateArchive& archive)
+{
+  archive.Sync(vFn, vMn, vOrient, vXYZn, vActingXYZn, mT, vFb, vM);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 const FGColumnVector3& FGForce::GetBodyForces(void)
 {
   vFb = Transform()*vFn;
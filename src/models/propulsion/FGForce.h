@@ -60,6 +60,7 @@ INCLUDES
 #include "FGJSBBase.h"
 #include "math/FGMatrix33.h"
 #include "math/FGColumnVector3.h"
+#include "input_output/FGStateArchive.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -230,6 +231,9 @@ public:
 
   virtual const FGColumnVector3& GetBodyForces(void);
 
+  /// Saves or restores the force, its location and its orientation.
+  virtual void SerializeState(FGStateArchive& archive);
+
   inline double GetBodyXForce(void) const { return vFb(eX); }
   inline double GetBodyYForce(void) const { return vFb(eY); }
   inline double GetBodyZForce(void) const { return vFb(eZ); }
@@ -472,6 +472,22 @@ void FGPiston::ResetToIC(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGPiston::SerializeState(FGStateArchive& archive)
+{
+  FGEngine::SerializeState(archive);
+
+  archive.Sync(crank_counter, IndicatedHorsePower, PMEP, FMEP, FMEPDynamic,
+               FMEPStatic, BoostSpeed, MAP, TMAP, ISFC, p_amb, p_ram, T_amb,
+               RPM, IAS, Magnetos, rho_air);
+  archive.Sync(volumetric_efficiency, volumetric_efficiency_reduced, m_dot_air,
+               v_dot_air, equivalence_ratio, m_dot_fuel, HP, BoostLossHP,
+               combustion_efficiency, ExhaustGasTemp_degK, EGT_degC,
+               ManifoldPressure_inHg, CylinderHeadTemp_degK, OilPressure_psi,
+               OilTemp_degK, MeanPistonSpeed_fps);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGPiston::Calculate(void)
 {
   // Input values.
@@ -992,6 +1008,17 @@ string FGPiston::GetEngineValues(const string& delimiter)
   return buf.str();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPiston::GetEngineValues(vector<double>& values)
+{
+  values.push_back(HP * hptoftlbssec);
+  values.push_back(HP);
+  values.push_back(equivalence_ratio);
+  values.push_back(ManifoldPressure_inHg);
+  Thruster->GetThrusterValues(values);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //
 //    The bitmasked value choices are as follows:
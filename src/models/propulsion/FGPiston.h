@@ -230,12 +230,14 @@ public:
 
   std::string GetEngineLabels(const std::string& delimiter);
   std::string GetEngineValues(const std::string& delimiter);
+  void GetEngineValues(std::vector<double>& values);
 
   void Calculate(void);
   double GetPowerAvailable(void) const {return (HP * hptoftlbssec);}
   double CalcFuelNeed(void);
 
   void ResetToIC(void);
+  void SerializeState(FGStateArchive& archive);
   void SetMagnetos(int magnetos) {Magnetos = magnetos;}
 
   double  GetEGT(void) const { return EGT_degC; }
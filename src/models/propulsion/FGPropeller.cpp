@@ -192,6 +192,16 @@ void FGPropeller::ResetToIC(void)
   Vinduced = 0.0;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropeller::SerializeState(FGStateArchive& archive)
+{
+  FGThruster::SerializeState(archive);
+
+  archive.Sync(J, RPM, Pitch, Advance, ExcessTorque, HelicalTipMach, Vinduced,
+               vTorque, CtFactor, CpFactor, Reversed, Reverse_coef, Feathered);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //
 // We must be getting the aerodynamic velocity here, NOT the inertial velocity.
@@ -407,6 +417,20 @@ string FGPropeller::GetThrusterValues(int id, const string& delimeter)
   return buf.str();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropeller::GetThrusterValues(vector<double>& values)
+{
+  FGColumnVector3 vPFactor = GetPFactor();
+  values.push_back(vTorque(eX));
+  values.push_back(vPFactor(ePitch));
+  values.push_back(vPFactor(eYaw));
+  values.push_back(Thrust);
+  if (IsVPitch())
+    values.push_back(Pitch);
+  values.push_back(RPM);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -180,6 +180,7 @@ public:
 
   /// Reset the initial conditions.
   void ResetToIC(void);
+  void SerializeState(FGStateArchive& archive);
 
   /** Sets the Revolutions Per Minute for the propeller. Normally the propeller
       instance will calculate its own rotational velocity, given the Torque
@@ -283,6 +284,7 @@ public:
   std::string GetThrusterLabels(int id, const std::string& delimeter);
   /// Generate the values for the thruster standard CSV output
   std::string GetThrusterValues(int id, const std::string& delimeter);
+  void GetThrusterValues(std::vector<double>& values);
   /** Set the propeller reverse pitch.
       @param c the reverse pitch command in percent (0.0 - 1.0)
   */
@@ -94,7 +94,7 @@ FGRocket::FGRocket(FGFDMExec* exec, Element *el, int engine_number, struct Input
   if (isp_el) {
     Element* isp_func_el = isp_el->FindElement("function");
     if (isp_func_el) {
-      isp_function = new FGFunction(exec->GetPropertyManager(),isp_func_el, strEngineNumber.str());
+      isp_function = new FGFunction(exec, isp_func_el, strEngineNumber.str());
     } else {
     Isp = el->FindElementValueAsNumber("isp");
     }
@@ -213,6 +213,18 @@ void FGRocket::Calculate(void)
   RunPostFunctions();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRocket::SerializeState(FGStateArchive& archive)
+{
+  FGEngine::SerializeState(archive);
+
+  archive.Sync(Isp, It, ItVac, ThrustVariation, TotalIspVariation, VacThrust,
+               previousFuelNeedPerTank, previousOxiNeedPerTank,
+               OxidizerExpended, TotalPropellantExpended, OxidizerFlowRate,
+               PropellantFlowRate, Flameout);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 // 
 // The FuelFlowRate can be affected by the TotalIspVariation value (settable
@@ -278,6 +290,21 @@ string FGRocket::GetEngineValues(const string& delimiter)
   return buf.str();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRocket::GetEngineValues(vector<double>& values)
+{
+  values.push_back(It);
+  values.push_back(ItVac);
+  FGColumnVector3 vMoments = GetMoments();
+  const FGColumnVector3& vForces = Thruster->GetBodyForces();
+  for (int i=eX; i<=eZ; i++)
+    values.push_back(vMoments(i));
+  for (int i=eX; i<=eZ; i++)
+    values.push_back(vForces(i));
+  Thruster->GetThrusterValues(values);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 // This function should tie properties to rocket engine specific properties
 // that are not bound in the base class (FGEngine) code.
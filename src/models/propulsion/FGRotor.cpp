@@ -56,6 +56,7 @@ using std::cout;
 using std::endl;
 using std::string;
 using std::ostringstream;
+using std::vector;
 
 namespace JSBSim {
 
@@ -687,6 +688,21 @@ double FGRotor::Calculate(double EnginePower)
   return Thrust;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRotor::SerializeState(FGStateArchive& archive)
+{
+  FGThruster::SerializeState(archive);
+
+  archive.Sync(dt, rho, damp_hagl, RPM, Omega, beta_orient, a0, a_1, b_1, a_dw,
+               a1s, b1s, H_drag, J_side, Torque, C_T, lambda, mu, nu,
+               v_induced, theta_downwash, phi_downwash);
+  archive.Sync(CollectiveCtrl, LateralCtrl, LongitudinalCtrl, EngineRPM,
+               GroundEffectScaleNorm);
+
+  if (Transmission) Transmission->SerializeState(archive);
+}
+
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
@@ -809,6 +825,13 @@ string FGRotor::GetThrusterValues(int id, const string& delimeter)
 
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRotor::GetThrusterValues(vector<double>& values)
+{
+  values.push_back(RPM);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -252,6 +252,7 @@ public:
 
   /// Returns the scalar thrust of the rotor, and adjusts the RPM value.
   double Calculate(double EnginePower);
+  void SerializeState(FGStateArchive& archive);
 
 
   /// Retrieves the RPMs of the rotor.
@@ -313,6 +314,7 @@ public:
   // Stubs. Only main rotor RPM is returned
   std::string GetThrusterLabels(int id, const std::string& delimeter);
   std::string GetThrusterValues(int id, const std::string& delimeter);
+  void GetThrusterValues(std::vector<double>& values);
 
 private:
 
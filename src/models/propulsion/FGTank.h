@@ -46,6 +46,7 @@ INCLUDES
 
 #include "FGJSBBase.h"
 #include "math/FGColumnVector3.h"
+#include "input_output/FGStateArchive.h"
 #include "math/FGFunction.h"
 #include <string>
 
@@ -230,6 +231,7 @@ public:
 
   /** Resets the tank parameters to the initial conditions */
   void ResetToIC(void);
+  void SerializeState(FGStateArchive& archive);
 
   /** If the tank is set to supply fuel, this function returns true.
       @return true if this tank is set to a non-zero priority.*/
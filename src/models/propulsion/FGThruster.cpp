@@ -134,6 +134,19 @@ void FGThruster::ResetToIC(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGThruster::SerializeState(FGStateArchive& archive)
+{
+  FGForce::SerializeState(archive);
+
+  archive.Sync(Thrust, PowerRequired, GearRatio, ThrustCoeff, ReverserAngle);
+
+  archive.Sync(in.TotalDeltaT, in.H_agl, in.PQRi, in.AeroPQR, in.AeroUVW,
+               in.Density, in.Pressure, in.Soundspeed, in.Alpha, in.Beta,
+               in.Vt);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 string FGThruster::GetThrusterLabels(int id, const string& delimeter)
 {
   std::ostringstream buf;
@@ -154,6 +167,13 @@ string FGThruster::GetThrusterValues(int id, const string& delimeter)
   return buf.str();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGThruster::GetThrusterValues(vector<double>& values)
+{
+  values.push_back(Thrust);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
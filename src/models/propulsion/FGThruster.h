@@ -103,8 +103,12 @@ public:
   double GetGearRatio(void) {return GearRatio; }
   virtual std::string GetThrusterLabels(int id, const std::string& delimeter);
   virtual std::string GetThrusterValues(int id, const std::string& delimeter);
+  /** Appends the values of GetThrusterValues() to a vector as numbers.
+      @param values the vector to which the values are appended. */
+  virtual void GetThrusterValues(std::vector<double>& values);
 
   virtual void ResetToIC(void);
+  virtual void SerializeState(FGStateArchive& archive);
 
   struct Inputs {
     double TotalDeltaT;
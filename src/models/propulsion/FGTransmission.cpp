@@ -135,6 +135,14 @@ void FGTransmission::Calculate(double EnginePower, double ThrusterTorque, double
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGTransmission::SerializeState(FGStateArchive& archive)
+{
+  archive.Sync(FreeWheelLag, FreeWheelTransmission, ClutchCtrlNorm,
+               BrakeCtrlNorm, EngineRPM, ThrusterRPM);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGTransmission::BindModel(int num)
 {
   string property_name, base_property_name;
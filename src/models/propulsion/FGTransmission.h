@@ -118,6 +118,7 @@ public:
   ~FGTransmission();
 
   void Calculate(double EnginePower, double ThrusterTorque, double dt);
+  void SerializeState(FGStateArchive& archive);
 
   void   SetMaxBrakePower(double x) {MaxBrakePower=x;}
   double GetMaxBrakePower() const {return MaxBrakePower;}
@@ -113,6 +113,20 @@ void FGTurbine::ResetToIC(void)
   OilTemp_degK = in.TAT_c + 273.0;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTurbine::SerializeState(FGStateArchive& archive)
+{
+  FGEngine::SerializeState(archive);
+
+  archive.Sync(phase, N1, N2, N2norm, ThrottlePos, AugmentCmd, Stalled, Seized,
+               Overtemp, Fire, Injection, Augmentation, Reversed, Cutoff,
+               Ignition);
+  archive.Sync(EGT_degC, EPR, OilPressure_psi, OilTemp_degK, BleedDemand,
+               InletPosition, NozzlePosition, correctedTSFC, InjectionTimer,
+               InjWaterNorm);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 // The main purpose of Calculate() is to determine what phase the engine should
 // be in, then call the corresponding function.
@@ -544,6 +558,15 @@ string FGTurbine::GetEngineValues(const string& delimiter)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGTurbine::GetEngineValues(vector<double>& values)
+{
+  values.push_back(N1);
+  values.push_back(N2);
+  Thruster->GetThrusterValues(values);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGTurbine::bindmodel(FGPropertyManager* PropertyManager)
 {
   string property_name, base_property_name;
@@ -232,9 +232,11 @@ public:
   
   int InitRunning(void);
   void ResetToIC(void);
+  void SerializeState(FGStateArchive& archive);
 
   std::string GetEngineLabels(const std::string& delimiter);
   std::string GetEngineValues(const std::string& delimiter);
+  void GetEngineValues(std::vector<double>& values);
 
 private:
 
@@ -298,6 +298,18 @@ void FGTurboProp::Calculate(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGTurboProp::SerializeState(FGStateArchive& archive)
+{
+  FGEngine::SerializeState(archive);
+
+  archive.Sync(phase, N1, ThrottlePos, Reversed, Cutoff, OilPressure_psi,
+               OilTemp_degK, Ielu_intervent, OldThrottle, RPM,
+               CombustionEfficiency, HP, StartTime, Eng_ITT_degC,
+               Eng_Temperature, EngStarting, GeneratorPower, Condition);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 double FGTurboProp::Off(void)
 {
   Running = false; EngStarting = false;
@@ -527,6 +539,15 @@ string FGTurboProp::GetEngineValues(const string& delimiter)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGTurboProp::GetEngineValues(vector<double>& values)
+{
+  values.push_back(N1);
+  values.push_back(HP);
+  Thruster->GetThrusterValues(values);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 int FGTurboProp::InitRunning(void)
 {
   double dt = in.TotalDeltaT;
@@ -103,6 +103,7 @@ public:
   enum phaseType { tpOff, tpRun, tpSpinUp, tpStart, tpTrim };
 
   void Calculate(void);
+  void SerializeState(FGStateArchive& archive);
   double CalcFuelNeed(void);
 
   double GetPowerAvailable(void) const { return (HP * hptoftlbssec); }
@@ -137,6 +138,7 @@ public:
   int InitRunning(void);
   std::string GetEngineLabels(const std::string& delimiter);
   std::string GetEngineValues(const std::string& delimiter);
+  void GetEngineValues(std::vector<double>& values);
 
 private:
 
@@ -15,6 +15,7 @@
 #include <limits>
 
 #include <set>
+#include <unordered_map>
 #include <sstream>
 #include <iomanip>
 #include <iterator>
@@ -385,14 +386,99 @@ first_unused_index( const char * name,
   return -1;
 }
 
+/**
+ * Hash index of the children of a node by name and index.
+ *
+ * The keys point to the names of the children (or to the name searched for)
+ * so that a lookup does not allocate: the name of a node never changes once
+ * it is created.
+ */
+struct SGPropertyNode::ChildIndex
+{
+  struct Key
+  {
+    Key(const char* _name, size_t _length, int _index)
+      : name(_name), length(_length), index(_index) {}
+    explicit Key(const SGPropertyNode* node)
+      : name(node->_name.data()), length(node->_name.size()),
+        index(node->_index) {}
+
+    bool operator==(const Key& key) const {
+      return index == key.index && length == key.length
+        && !memcmp(name, key.name, length);
+    }
+
+    const char* name;
+    size_t length;
+    int index;
+  };
+
+  struct Hash
+  {
+    size_t operator()(const Key& key) const {
+      // FNV-1a
+      size_t h = 2166136261u;
+      for (size_t i = 0; i < key.length; ++i)
+        h = (h ^ static_cast<unsigned char>(key.name[i])) * 16777619u;
+      return h ^ (static_cast<size_t>(key.index) * 0x9e3779b9u);
+    }
+  };
+
+  /// Number of children from which a node indexes them.
+  static const size_t threshold = 16;
+
+  explicit ChildIndex(const PropertyList& children) {
+    nodes.reserve(children.size());
+    for (size_t i = 0; i < children.size(); ++i)
+      insert(children[i]);
+  }
+
+  void insert(SGPropertyNode* node) { nodes.emplace(Key(node), node); }
+  void erase(const SGPropertyNode* node) { nodes.erase(Key(node)); }
+
+  std::unordered_map<Key, SGPropertyNode*, Hash> nodes;
+};
+
+const size_t SGPropertyNode::ChildIndex::threshold;
+
+/**
+ * Locate a child node by name and index. Small nodes are searched linearly,
+ * the larger ones through their child index which is built on first use.
+ */
+template<typename Itr>
+SGPropertyNode*
+SGPropertyNode::findChild (Itr begin, Itr end, int index) const
+{
+  if (!_child_index) {
+    if (_children.size() < ChildIndex::threshold) {
+      int pos = find_child(begin, end, index, _children);
+      return pos >= 0 ? _children[pos].ptr() : 0;
+    }
+    _child_index = new ChildIndex(_children);
+  }
+
+  size_t length = end - begin;
+  ChildIndex::Key key(length ? &*begin : "", length, index);
+  auto it = _child_index->nodes.find(key);
+  return it != _child_index->nodes.end() ? it->second : 0;
+}
+
+/**
+ * Append a child node and keep the child index up to date.
+ */
+void
+SGPropertyNode::appendChild (SGPropertyNode* node)
+{
+  _children.push_back(node);
+  if (_child_index)
+    _child_index->insert(node);
+}
+
 template<typename Itr>
 inline SGPropertyNode*
 SGPropertyNode::getExistingChild (Itr begin, Itr end, int index)
 {
-  int pos = find_child(begin, end, index, _children);
-  if (pos >= 0)
-    return _children[pos];
-  return 0;
+  return findChild(begin, end, index);
 }
 
 template<typename Itr>
@@ -405,7 +491,7 @@ SGPropertyNode::getChildImpl (Itr begin, Itr end, int index, bool create)
       return node;
     } else if (create) {
       node = new SGPropertyNode(begin, end, index, this);
-      _children.push_back(node);
+      appendChild(node);
       fireChildAdded(node);
       return node;
     } else {
@@ -613,6 +699,7 @@ SGPropertyNode::set_bool (bool val)
 {
   if (_tied) {
     if (static_cast<SGRawValue<bool>*>(_value.val)->setValue(val)) {
+      ++_version;
       fireValueChanged();
       return true;
     } else {
@@ -620,6 +707,7 @@ SGPropertyNode::set_bool (bool val)
     }
   } else {
     _local_val.bool_val = val;
+    ++_version;
     fireValueChanged();
     return true;
   }
@@ -630,6 +718,7 @@ SGPropertyNode::set_int (int val)
 {
   if (_tied) {
     if (static_cast<SGRawValue<int>*>(_value.val)->setValue(val)) {
+      ++_version;
       fireValueChanged();
       return true;
     } else {
@@ -637,6 +726,7 @@ SGPropertyNode::set_int (int val)
     }
   } else {
     _local_val.int_val = val;
+    ++_version;
     fireValueChanged();
     return true;
   }
@@ -647,6 +737,7 @@ SGPropertyNode::set_long (long val)
 {
   if (_tied) {
     if (static_cast<SGRawValue<long>*>(_value.val)->setValue(val)) {
+      ++_version;
       fireValueChanged();
       return true;
     } else {
@@ -654,6 +745,7 @@ SGPropertyNode::set_long (long val)
     }
   } else {
     _local_val.long_val = val;
+    ++_version;
     fireValueChanged();
     return true;
   }
@@ -664,6 +756,7 @@ SGPropertyNode::set_float (float val)
 {
   if (_tied) {
     if (static_cast<SGRawValue<float>*>(_value.val)->setValue(val)) {
+      ++_version;
       fireValueChanged();
       return true;
     } else {
@@ -671,6 +764,7 @@ SGPropertyNode::set_float (float val)
     }
   } else {
     _local_val.float_val = val;
+    ++_version;
     fireValueChanged();
     return true;
   }
@@ -681,6 +775,7 @@ SGPropertyNode::set_double (double val)
 {
   if (_tied) {
     if (static_cast<SGRawValue<double>*>(_value.val)->setValue(val)) {
+      ++_version;
       fireValueChanged();
       return true;
     } else {
@@ -688,6 +783,7 @@ SGPropertyNode::set_double (double val)
     }
   } else {
     _local_val.double_val = val;
+    ++_version;
     fireValueChanged();
     return true;
   }
@@ -698,6 +794,7 @@ SGPropertyNode::set_string (const char * val)
 {
   if (_tied) {
       if (static_cast<SGRawValue<const char*>*>(_value.val)->setValue(val)) {
+      ++_version;
       fireValueChanged();
       return true;
     } else {
@@ -706,6 +803,7 @@ SGPropertyNode::set_string (const char * val)
   } else {
     delete [] _local_val.string_val;
     _local_val.string_val = copy_string(val);
+    ++_version;
     fireValueChanged();
     return true;
   }
@@ -749,6 +847,7 @@ SGPropertyNode::clearValue ()
     }
     _tied = false;
     _type = props::NONE;
+    ++_version;
 }
 
 
@@ -831,7 +930,7 @@ SGPropertyNode::trace_read () const
  * Last used attribute
  * Update as needed when enum Attribute is changed
  */
-const int SGPropertyNode::LAST_USED_ATTRIBUTE = PRESERVE;
+const int SGPropertyNode::LAST_USED_ATTRIBUTE = CONSTANT;
 
 /**
  * Default constructor: always creates a root node.
@@ -842,7 +941,9 @@ SGPropertyNode::SGPropertyNode ()
     _type(props::NONE),
     _tied(false),
     _attr(READ|WRITE),
-    _listeners(0)
+    _version(0),
+    _listeners(0),
+    _child_index(0)
 {
   _local_val.string_val = 0;
   _value.val = 0;
@@ -860,7 +961,9 @@ SGPropertyNode::SGPropertyNode (const SGPropertyNode &node)
     _type(node._type),
     _tied(node._tied),
     _attr(node._attr),
-    _listeners(0)		// CHECK!!
+    _version(0),
+    _listeners(0),		// CHECK!!
+    _child_index(0)
 {
   _local_val.string_val = 0;
   _value.val = 0;
@@ -915,7 +1018,9 @@ SGPropertyNode::SGPropertyNode (Itr begin, Itr end,
     _type(props::NONE),
     _tied(false),
     _attr(READ|WRITE),
-    _listeners(0)
+    _version(0),
+    _listeners(0),
+    _child_index(0)
 {
   _local_val.string_val = 0;
   _value.val = 0;
@@ -932,7 +1037,9 @@ SGPropertyNode::SGPropertyNode( const std::string& name,
     _type(props::NONE),
     _tied(false),
     _attr(READ|WRITE),
-    _listeners(0)
+    _version(0),
+    _listeners(0),
+    _child_index(0)
 {
   _local_val.string_val = 0;
   _value.val = 0;
@@ -948,6 +1055,7 @@ SGPropertyNode::~SGPropertyNode ()
   // zero out all parent pointers, else they might be dangling
   for (unsigned i = 0; i < _children.size(); ++i)
     _children[i]->_parent = 0;
+  delete _child_index;
   clearValue();
 
   if (_listeners) {
@@ -1051,7 +1159,7 @@ SGPropertyNode::addChild(const char * name, int min_index, bool append)
 
   SGPropertyNode_ptr node;
   node = new SGPropertyNode(name, name + strlen(name), pos, this);
-  _children.push_back(node);
+  appendChild(node);
   fireChildAdded(node);
   return node;
 }
@@ -1094,7 +1202,7 @@ SGPropertyNode::addChildren( const std::string& name,
     {
       SGPropertyNode_ptr node;
       node = new SGPropertyNode(name, index, this);
-      _children.push_back(node);
+      appendChild(node);
       fireChildAdded(node);
       nodes.push_back(node);
     }
@@ -1144,17 +1252,15 @@ SGPropertyNode::getChild (const std::string& name, int index, bool create)
 {
 #if PROPS_STANDALONE
   const char *n = name.c_str();
-  int pos = find_child(n, n + strlen(n), index, _children);
-  if (pos >= 0) {
-    return _children[pos];
+  SGPropertyNode* node = findChild(n, n + strlen(n), index);
 #else
   SGPropertyNode* node = getExistingChild(name.begin(), name.end(), index);
+#endif
   if (node) {
       return node;
-#endif
     } else if (create) {
       SGPropertyNode* node = new SGPropertyNode(name, index, this);
-      _children.push_back(node);
+      appendChild(node);
       fireChildAdded(node);
       return node;
     } else {
@@ -1168,11 +1274,7 @@ SGPropertyNode::getChild (const std::string& name, int index, bool create)
 const SGPropertyNode *
 SGPropertyNode::getChild (const char * name, int index) const
 {
-  int pos = find_child(name, name + strlen(name), index, _children);
-  if (pos >= 0)
-    return _children[pos];
-  else
-    return 0;
+  return findChild(name, name + strlen(name), index);
 }
 
 
@@ -1224,10 +1326,9 @@ SGPropertyNode_ptr SGPropertyNode::removeChild(int pos)
 SGPropertyNode_ptr
 SGPropertyNode::removeChild(const char * name, int index)
 {
-  SGPropertyNode_ptr ret;
-  int pos = find_child(name, name + strlen(name), index, _children);
-  if (pos >= 0)
-    ret = removeChild(pos);
+  SGPropertyNode_ptr ret = findChild(name, name + strlen(name), index);
+  if (ret)
+    removeChild(ret.ptr());
   return ret;
 }
 
@@ -1261,6 +1362,8 @@ SGPropertyNode::removeAllChildren()
   }
 
   _children.clear();
+  delete _child_index;
+  _child_index = 0;
 }
 
 std::string
@@ -1471,6 +1574,18 @@ SGPropertyNode::getDoubleValue () const
   }
 }
 
+const double *
+SGPropertyNode::getTiedDoublePointer () const
+{
+  if (!_tied || _type != props::DOUBLE || !getAttribute(READ)
+      || getAttribute(TRACE_READ))
+    return 0;
+
+  const SGRawValuePointer<double>* raw =
+    dynamic_cast<const SGRawValuePointer<double>*>(_value.val);
+  return raw ? raw->getPointer() : 0;
+}
+
 const char *
 SGPropertyNode::getStringValue () const
 {
@@ -2026,6 +2141,7 @@ SGPropertyNode::untie ()
   }
 
   _tied = false;
+  ++_version;
   return true;
 }
 
@@ -2479,6 +2595,8 @@ SGPropertyNode::eraseChild(simgear::PropertyList::iterator child)
   node->clearValue();
   fireChildRemoved(node);
 
+  if (_child_index)
+    _child_index->erase(node);
   _children.erase(child);
   return node;
 }
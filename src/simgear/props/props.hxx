@@ -430,6 +430,11 @@ public:
     return new SGRawValuePointer(_ptr);
   }
 
+  /**
+   * Get the pointer to the variable.
+   */
+  T * getPointer () const { return _ptr; }
+
 private:
   T * _ptr;
 };
@@ -752,7 +757,8 @@ public:
     TRACE_READ = 16,
     TRACE_WRITE = 32,
     USERARCHIVE = 64,
-    PRESERVE = 128
+    PRESERVE = 128,
+    CONSTANT = 256  // The value is no longer modified once initialized
     // beware: if you add another attribute here,
     // also update value of "LAST_USED_ATTRIBUTE".
   };
@@ -1175,6 +1181,16 @@ public:
   double getDoubleValue () const;
 
 
+  /**
+   * Get the double variable this node is tied to through a pointer.
+   *
+   * Returns 0 unless the node is tied to a double variable and its value
+   * can be read directly from that variable. The pointer is only valid as
+   * long as the node remains tied.
+   */
+  const double * getTiedDoublePointer () const;
+
+
   /**
    * Get a string value for this node.
    */
@@ -1337,6 +1353,18 @@ public:
    */
   bool isTied () const { return _tied; }
 
+
+  /**
+   * Get the version of the node's value.
+   *
+   * The version is incremented each time a value is written to the node
+   * through the property tree, or when the node is tied, untied or
+   * cleared. It allows to check cheaply whether the value of an untied node
+   * has been modified. The value of a tied node can be modified by its
+   * owner without the version being incremented.
+   */
+  unsigned int getVersion () const { return _version; }
+
     /**
      * Bind this node to an external source.
      */
@@ -1784,6 +1812,7 @@ private:
   simgear::props::Type _type;
   bool _tied;
   int _attr;
+  unsigned int _version;
 
   // The right kind of pointer...
   union {
@@ -1802,12 +1831,20 @@ private:
 
   std::vector<SGPropertyChangeListener *> * _listeners;
 
+  // Hash index of the children, built when a node has many of them
+  struct ChildIndex;
+  mutable ChildIndex * _child_index;
+
   // Pass name as a pair of iterators
   template<typename Itr>
   SGPropertyNode * getChildImpl (Itr begin, Itr end, int index = 0, bool create = false);
   // very internal method
   template<typename Itr>
   SGPropertyNode* getExistingChild (Itr begin, Itr end, int index);
+  // Locate a child by name and index, using the child index if any
+  template<typename Itr>
+  SGPropertyNode* findChild (Itr begin, Itr end, int index) const;
+  void appendChild (SGPropertyNode* node);
   // very internal path parsing function
   template<typename SplitItr>
   friend SGPropertyNode* find_node_aux(SGPropertyNode * current, SplitItr& itr,
@@ -0,0 +1,171 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       decode_log.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+ Purpose:      Compressed log -> CSV conversion tool
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+decode_log
+----------
+
+Input:
+
+A compressed log written by an output of type COMPRESSED.
+
+Output:
+
+The frames of the log in comma-separated value (CSV) format, with the same
+header as the CSV output of JSBSim, written to standard out. When a time span
+is given, only the chunks that overlap it are decoded thanks to the index of
+the log.
+
+Compiling:
+
+g++ decode_log.cpp ../input_output/FGCompressedLog.cpp -I ../ -O2 -o decode_log
+
+Usage:
+
+decode_log <filename.jsl> [--start=start_time] [--end=end_time]
+           [--precision=digits] [--index]
+
+--index lists the chunks of the log instead of decoding the frames.
+
+For example:
+
+./decode_log soak.jsl --start=3600 --end=3660 > minute.csv
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "input_output/FGCompressedLog.h"
+
+using namespace std;
+using namespace JSBSim;
+
+void Usage(void)
+{
+  cerr << "Usage: decode_log <filename.jsl> [--start=start_time]"
+       << " [--end=end_time] [--precision=digits] [--index]" << endl;
+}
+
+int main(int argc, char* argv[])
+{
+  string filename;
+  double start = -numeric_limits<double>::infinity();
+  double end = numeric_limits<double>::infinity();
+  int precision = 10;
+  bool index = false;
+
+  for (int i=1; i<argc; ++i) {
+    string arg = argv[i];
+    size_t eq = arg.find('=');
+    string keyword = arg.substr(0, eq);
+    string value = eq == string::npos ? string() : arg.substr(eq+1);
+
+    if (keyword == "--start" && !value.empty())
+      start = atof(value.c_str());
+    else if (keyword == "--end" && !value.empty())
+      end = atof(value.c_str());
+    else if (keyword == "--precision" && !value.empty())
+      precision = atoi(value.c_str());
+    else if (keyword == "--index")
+      index = true;
+    else if (arg[0] != '-' && filename.empty())
+      filename = arg;
+    else {
+      Usage();
+      return 1;
+    }
+  }
+
+  if (filename.empty()) {
+    Usage();
+    return 1;
+  }
+
+  ifstream infile(filename.c_str(), ios::binary);
+  FGCompressedLogReader log;
+  if (!infile || !log.Open(infile)) {
+    cerr << "Could not read the compressed log: " << filename << endl;
+    return 1;
+  }
+
+  const vector<FGCompressedLogReader::Chunk>& chunks = log.GetChunks();
+
+  if (index) {
+    cout << "Columns: " << log.GetNames().size() << endl;
+    cout << "Chunks: " << chunks.size()
+         << (log.IsFinished() ? "" : " (rebuilt, the log is not finished)")
+         << endl;
+    for (size_t i=0; i<chunks.size(); ++i)
+      cout << i << ": offset " << chunks[i].Offset << ", " << chunks[i].Frames
+           << " frames from " << chunks[i].StartTime << " to "
+           << chunks[i].EndTime << endl;
+    return 0;
+  }
+
+  const vector<string>& names = log.GetNames();
+  for (size_t i=0; i<names.size(); ++i) {
+    if (i > 0) cout << ',';
+    cout << names[i];
+  }
+  cout << endl;
+
+  if (chunks.empty() || names.empty()) return 0;
+
+  cout.precision(precision);
+  vector<double> values;
+  size_t num_columns = names.size();
+
+  for (size_t i=log.FindChunk(start); i<chunks.size(); ++i) {
+    if (chunks[i].StartTime > end) break;
+
+    if (!log.ReadChunk(i, values)) {
+      cerr << "Could not decode the chunk " << i << " of " << filename << endl;
+      return 1;
+    }
+
+    for (size_t frame=0; frame<values.size(); frame += num_columns) {
+      double time = values[frame];
+      if (time < start || time > end) continue;
+
+      for (size_t j=0; j<num_columns; ++j) {
+        if (j > 0) cout << ',';
+        cout << values[frame+j];
+      }
+      cout << '\n';
+    }
+  }
+
+  return 0;
+}
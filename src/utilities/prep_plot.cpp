@@ -36,6 +36,10 @@ A data file in comma-separated value (CSV) format, with time in the first
 column. The data file is expected to be all numeric. That is, NaN will
 mess it up, I think.
 
+A binary data file written by an output of type BINARY can be used as well.
+The names of the columns are then read from the header of the file and gnuplot
+is instructed to read the values in the binary format.
+
 Multiple files (currently up to 10) can be input to prep_plot provided
 the names of the files are all the same except for a digit. The digit
 is substituted for on the command line to prep_plot using the "#" character.
@@ -98,6 +102,8 @@ INCLUDES
 #include <cstdlib>
 #include <cstdio>
 #include <cmath>
+#include <cstring>
+#include <map>
 #include "input_output/string_utilities.h"
 #include "plotXMLVisitor.h"
 
@@ -112,6 +118,11 @@ typedef vector <string_array> multi_string_array;
 multi_string_array NamesArray;
 bool multiplot=false;
 
+// The gnuplot specifications of the binary data files, indexed by file name.
+map <string, string> BinaryFormats;
+
+string_array ReadNames(const string&);
+string DataSource(const string&);
 string HaveTerm(const vector <string>&, const string); 
 int GetTermIndex(const vector <string>&, const string);
 void EmitComparisonPlot(const vector <string>&, const int, const string);
@@ -183,9 +194,8 @@ int main(int argc, char **argv)
       if (!infile2.is_open()) {
         break;
       } else {
-        getline(infile2, in_string, '\n');
-        NamesArray.push_back(split(in_string, ','));
         infile2.close();
+        NamesArray.push_back(ReadNames(new_filename));
         files.push_back(new_filename);
         file_ctr++;
       }
@@ -200,8 +210,8 @@ int main(int argc, char **argv)
     cerr << "Could not open file: " << files[0] << endl;
     exit(-1);
   }
-  getline(infile, in_string, '\n');
-  string_array names = split(in_string, ',');
+  infile.close();
+  string_array names = ReadNames(files[0]);
   unsigned int num_names=names.size();
   
   // Read command line args
@@ -621,28 +631,28 @@ bool MakeArbitraryPlot(
         newPlot << "set y2tics font \"" << TICS_FONT << "\"" << endl;
       }
 
-      newPlot << "plot " << time_range << " \"" << files[0] << "\" using " << GetTermIndex(names, XAxisName)
+      newPlot << "plot " << time_range << " " << DataSource(files[0]) << " using " << GetTermIndex(names, XAxisName)
            << ":" << GetTermIndex(names, LeftYAxisNames[0]) << " with " << plotType << " title \""
            << LeftYAxisNames[0] << "\"";
       if (numLeftYAxisNames > 1) {
         newPlot << ", \\" << endl;
         for (i=1; i<numLeftYAxisNames-1; i++) {
-          newPlot << "     \"" << files[0] << "\" using " << GetTermIndex(names, XAxisName)
+          newPlot << "     " << DataSource(files[0]) << " using " << GetTermIndex(names, XAxisName)
                << ":" << GetTermIndex(names, LeftYAxisNames[i]) << " with " << plotType << " title \"" 
                << LeftYAxisNames[i] << "\", \\" << endl;
         }
-        newPlot << "     \"" << files[0] << "\" using " << GetTermIndex(names, XAxisName)<< ":" 
+        newPlot << "     " << DataSource(files[0]) << " using " << GetTermIndex(names, XAxisName)<< ":" 
              << GetTermIndex(names, LeftYAxisNames[numLeftYAxisNames-1]) << " with " << plotType << " title \"" 
              << LeftYAxisNames[numLeftYAxisNames-1] << "\"";
       }
       if (numRightYAxisNames > 0) {
         newPlot << ", \\" << endl;
         for (i=0; i<numRightYAxisNames-1; i++) {
-          newPlot << "     \"" << files[0] << "\" using " << GetTermIndex(names, XAxisName)
+          newPlot << "     " << DataSource(files[0]) << " using " << GetTermIndex(names, XAxisName)
                << ":" << GetTermIndex(names, RightYAxisNames[i]) << " with " << plotType << " axes x1y2 title \""
                << RightYAxisNames[i] << "\", \\" << endl;
         }
-        newPlot << "     \"" << files[0] << "\" using " << GetTermIndex(names, XAxisName)
+        newPlot << "     " << DataSource(files[0]) << " using " << GetTermIndex(names, XAxisName)
              << ":" << GetTermIndex(names, RightYAxisNames[numRightYAxisNames-1]) << " with " << plotType << " axes x1y2 title \""
              << RightYAxisNames[numRightYAxisNames-1] << "\"";
       }
@@ -679,28 +689,28 @@ bool MakeArbitraryPlot(
           newPlot << "     ";
         }
 
-        newPlot << "\"" << files[f] << "\" using " << GetTermIndex(NamesArray[f], XAxisName)
+        newPlot << DataSource(files[f]) << " using " << GetTermIndex(NamesArray[f], XAxisName)
              << ":" << GetTermIndex(NamesArray[f], LeftYAxisNames[0]) << " with " << plotType << " title \""
              << LeftYAxisNames[0] << ": " << f << "\"";
         if (numLeftYAxisNames > 1) {
           newPlot << ", \\" << endl;
           for (i=1; i<numLeftYAxisNames-1; i++) {
-            newPlot << "     \"" << files[f] << "\" using " << GetTermIndex(NamesArray[f], XAxisName)
+            newPlot << "     " << DataSource(files[f]) << " using " << GetTermIndex(NamesArray[f], XAxisName)
                  << ":" << GetTermIndex(NamesArray[f], LeftYAxisNames[i]) << " with " << plotType << " title \"" 
                  << LeftYAxisNames[i] << ": " << f << "\", \\" << endl;
           }
-          newPlot << "     \"" << files[f] << "\" using " << GetTermIndex(NamesArray[f], XAxisName)<< ":" 
+          newPlot << "     " << DataSource(files[f]) << " using " << GetTermIndex(NamesArray[f], XAxisName)<< ":" 
                << GetTermIndex(NamesArray[f], LeftYAxisNames[numLeftYAxisNames-1]) << " with " << plotType << " title \"" 
                << LeftYAxisNames[numLeftYAxisNames-1] << ": " << f << "\"";
         }
         if (numRightYAxisNames > 0) {
           newPlot << ", \\" << endl;
           for (i=0; i<numRightYAxisNames-2; i++) {
-            newPlot << "     \"" << files[f] << "\" using " << GetTermIndex(NamesArray[f], XAxisName)
+            newPlot << "     " << DataSource(files[f]) << " using " << GetTermIndex(NamesArray[f], XAxisName)
                  << ":" << GetTermIndex(NamesArray[f], RightYAxisNames[i]) << " with " << plotType << " axes x1y2 title \""
                  << RightYAxisNames[i] << ": " << f << "\", \\" << endl;
           }
-          newPlot << "     \"" << files[f] << "\" using " << GetTermIndex(NamesArray[f], XAxisName)
+          newPlot << "     " << DataSource(files[f]) << " using " << GetTermIndex(NamesArray[f], XAxisName)
                << ":" << GetTermIndex(NamesArray[f], RightYAxisNames[numRightYAxisNames-1]) << " with " << plotType << " axes x1y2 title \""
                << RightYAxisNames[numRightYAxisNames-1] << ": " << f << "\"";
         }
@@ -716,12 +726,72 @@ bool MakeArbitraryPlot(
   return have_all_terms;
 }
 
+// ############################################################################
+// Returns the names of the columns of a data file. For a binary file, the names
+// are read from its header and the gnuplot specification of its format is
+// stored in BinaryFormats.
+
+string_array ReadNames(const string& filename)
+{
+  string_array names;
+  ifstream infile(filename.c_str(), ios::binary);
+  char magic[8];
+
+  if (!infile.read(magic, sizeof(magic)) || memcmp(magic, "JSBSIMBF", 8) != 0) {
+    string in_string;
+    infile.clear();
+    infile.seekg(0);
+    getline(infile, in_string, '\n');
+    return split(in_string, ',');
+  }
+
+  // The integers are little-endian (see FGOutputBinaryFile).
+  unsigned char buffer[24];
+  infile.read((char*)buffer, sizeof(buffer));
+  unsigned int header_size = buffer[0] | buffer[1] << 8 | buffer[2] << 16 | buffer[3] << 24;
+  unsigned int value_size = buffer[8] | buffer[9] << 8 | buffer[10] << 16 | buffer[11] << 24;
+  unsigned int num_columns = buffer[12] | buffer[13] << 8 | buffer[14] << 16 | buffer[15] << 24;
+
+  for (unsigned int i=0; i<2*num_columns && infile; i++) {
+    unsigned char length[2];
+    infile.read((char*)length, sizeof(length));
+    string text(length[0] | length[1] << 8, ' ');
+    if (!text.empty()) infile.read(&text[0], text.size());
+    if (i % 2 == 0) names.push_back(text); // Skip the units
+  }
+
+  if (!infile) {
+    cerr << "Could not read the header of the binary file: " << filename << endl;
+    exit(-1);
+  }
+
+  stringstream format;
+  format << " binary skip=" << header_size << " format=\"%" << num_columns
+         << (value_size == 4 ? "float32" : "float64") << "\" endian=little";
+  BinaryFormats[filename] = format.str();
+
+  return names;
+}
+
+// ############################################################################
+// Returns the data file specification of a plot command.
+
+string DataSource(const string& filename)
+{
+  string source = "\"" + filename + "\"";
+  map <string, string>::const_iterator format = BinaryFormats.find(filename);
+
+  if (format != BinaryFormats.end()) source += format->second;
+
+  return source;
+}
+
 // ############################################################################
 
 void EmitSinglePlot(const string filename, const int index, const string linetitle )
 {
   cout << "print \"Processing parameter plot: " << linetitle << "\"" << endl;
-  cout << "plot " << plot_range << " \"" << filename << "\" using 1:" << index << " with lines title \"" << linetitle << "\"" << endl;
+  cout << "plot " << plot_range << " " << DataSource(filename) << " using 1:" << index << " with lines title \"" << linetitle << "\"" << endl;
 }
 
 // ############################################################################
@@ -742,11 +812,11 @@ void EmitComparisonPlot(const vector <string>& filenames, const int index, const
   cout << "##" << endl << "##" << endl;
   cout << "print \"Processing parameter plot: " << linetitle << "\"" << endl;
   cout << "##" << endl << "##" << endl;
-    cout << "plot " << plot_range <<  " \"" << filenames[0] << "\" using 1:" << GetTermIndex(NamesArray[0],varname) << " with lines title \"" << linetitle << ": 1" << "\", \\" << endl;
+    cout << "plot " << plot_range <<  " " << DataSource(filenames[0]) << " using 1:" << GetTermIndex(NamesArray[0],varname) << " with lines title \"" << linetitle << ": 1" << "\", \\" << endl;
   for (unsigned int f=1;f<filenames.size()-1;f++){
-      cout << "\"" << filenames[f] << "\" using 1:" << GetTermIndex(NamesArray[f],varname) << " with lines title \"" << linetitle << ": " << f+1 << "\", \\" << endl;
+      cout << DataSource(filenames[f]) << " using 1:" << GetTermIndex(NamesArray[f],varname) << " with lines title \"" << linetitle << ": " << f+1 << "\", \\" << endl;
   }
-    cout << "\"" << filenames[filenames.size()-1] << "\" using 1:" << GetTermIndex(NamesArray[filenames.size()-1],varname) << " with lines title \"" << linetitle << ": " << filenames.size() << "\"" << endl;
+    cout << DataSource(filenames[filenames.size()-1]) << " using 1:" << GetTermIndex(NamesArray[filenames.size()-1],varname) << " with lines title \"" << linetitle << ": " << filenames.size() << "\"" << endl;
   }
 
 }
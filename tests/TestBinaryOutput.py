@@ -0,0 +1,73 @@
+# TestBinaryOutput.py
+#
+# Check that the binary output contains the same data as the CSV output.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import xml.etree.ElementTree as et
+import numpy as np
+import pandas as pd
+from JSBSim_utils import JSBSimTestCase, CreateFDM, RunTest, jsbsim
+
+
+class TestBinaryOutput(JSBSimTestCase):
+    def run_with_binary_output(self, precision):
+        output_path = self.sandbox.path_to_jsbsim_file('tests', 'output.xml')
+        tree = et.parse(output_path)
+        output_tag = tree.getroot()
+        output_tag.attrib['name'] = 'output.bin'
+        output_tag.attrib['type'] = 'BINARY'
+        output_tag.attrib['precision'] = precision
+        tree.write('binary.xml')
+
+        fdm = CreateFDM(self.sandbox)
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         'c1722.xml'))
+        fdm.set_output_directive(output_path)
+        fdm.set_output_directive('binary.xml')
+        fdm.run_ic()
+
+        while fdm.run():
+            pass
+
+        del fdm
+
+        return jsbsim.read_binary_output('output.bin')
+
+    def check_data(self, names, data, tol):
+        ref = pd.read_csv('output.csv')
+        self.assertEqual([c.strip() for c in ref.columns], names)
+        self.assertEqual(len(ref), data.shape[0])
+        delta = np.abs(ref.values - data) / np.maximum(np.abs(ref.values), 1.0)
+        self.assertLess(np.nanmax(delta), tol)
+
+    def test_double(self):
+        names, units, rate, data = self.run_with_binary_output('double')
+        self.assertEqual(data.dtype, np.dtype('<f8'))
+        self.assertAlmostEqual(rate, 20.0, delta=1E-4)
+        self.assertEqual(names[0], 'Time')
+        self.assertEqual(units[names.index('Altitude ASL (ft)')], 'ft')
+        self.assertEqual(units[names.index('/fdm/jsbsim/velocities/vc-kts')],
+                         '')
+        self.check_data(names, data, 1E-8)
+
+    def test_single(self):
+        names, units, rate, data = self.run_with_binary_output('single')
+        self.assertEqual(data.dtype, np.dtype('<f4'))
+        self.check_data(names, data, 1E-6)
+
+RunTest(TestBinaryOutput)
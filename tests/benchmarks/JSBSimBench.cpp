@@ -0,0 +1,316 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       JSBSimBench.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+ Purpose:      Runs the benchmark cases and reports their timings
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+COMMENTS, REFERENCES,  and NOTES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Usage: jsbsim_bench [--filter=<text>] [--json=<file>] [--min-time=<seconds>]
+                    [--repetitions=<n>] [--root=<directory>] [--list]
+
+Each case whose name contains the filter text is calibrated, then run several
+times. The reported time per iteration is the median of the repetitions. The
+JSON file records the same results along with the JSBSim version so that the
+runs of different releases can be compared. The results are only meaningful
+for an optimized build (CMAKE_BUILD_TYPE=Release). The benchmarks are only
+built when CMake is run with -DBUILD_BENCHMARKS=ON.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "JSBSimBench.h"
+#include "FGJSBBase.h"
+
+using namespace std;
+
+namespace JSBSimBench {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// The cases are sorted by name so that the reports do not depend on the order
+// of the static initializations.
+static map<string, Factory>& GetRegistry(void)
+{
+  static map<string, Factory> registry;
+  return registry;
+}
+
+static SGPath RootDir(JSBSIM_BENCH_ROOT_DIR);
+static double Sink = 0.0;
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Registrar::Registrar(const string& name, const Factory& factory)
+{
+  GetRegistry()[name] = factory;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+const SGPath& GetRootDir(void) { return RootDir; }
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void Consume(double value) { Sink += value; }
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+struct Result {
+  string name;
+  string unit;
+  size_t iterations;
+  double median, min, mean, stddev; // nanoseconds per iteration
+};
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+static double Time(Case& c, size_t iterations)
+{
+  c.SetUp();
+  auto start = chrono::steady_clock::now();
+  c.Run(iterations);
+  chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The number of iterations is increased until a single repetition lasts at
+// least minTime. The growth is limited to a factor 10 per step since the first
+// timings are dominated by the cache misses.
+
+static size_t Calibrate(Case& c, double minTime)
+{
+  size_t iterations = 1;
+
+  while (true) {
+    double elapsed = Time(c, iterations);
+    if (elapsed >= minTime) break;
+
+    double factor = elapsed > 0.0 ? 1.2*minTime/elapsed : 10.0;
+    factor = min(max(factor, 2.0), 10.0);
+    iterations = static_cast<size_t>(ceil(iterations*factor));
+  }
+
+  return iterations;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+static Result Measure(const string& name, Case& c, double minTime,
+                      unsigned int repetitions)
+{
+  Result result;
+  result.name = name;
+  result.unit = c.GetUnit();
+  result.iterations = Calibrate(c, minTime);
+
+  vector<double> times;
+  for (unsigned int i=0; i<repetitions; i++)
+    times.push_back(1E9*Time(c, result.iterations)/result.iterations);
+
+  sort(times.begin(), times.end());
+  size_t n = times.size();
+  result.min = times[0];
+  result.median = n % 2 ? times[n/2] : 0.5*(times[n/2-1]+times[n/2]);
+
+  double sum = 0.0, sum2 = 0.0;
+  for (double t: times) {
+    sum += t;
+    sum2 += t*t;
+  }
+  result.mean = sum/n;
+  result.stddev = n > 1 ? sqrt(max(sum2 - n*result.mean*result.mean, 0.0)/(n-1))
+                        : 0.0;
+
+  return result;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+static string Escape(const string& s)
+{
+  string escaped;
+
+  for (char c: s) {
+    if (c == '"' || c == '\\') escaped += '\\';
+    escaped += c;
+  }
+
+  return escaped;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The layout is modelled on the JSON output of Google Benchmark. The times are
+// wall clock times.
+
+static bool WriteJSON(const string& fileName, const vector<Result>& results,
+                      unsigned int repetitions)
+{
+  ofstream json(fileName.c_str());
+  if (!json.is_open()) return false;
+
+  time_t now = time(nullptr);
+  char date[32];
+  strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+  json << "{" << endl
+       << "  \"context\": {" << endl
+       << "    \"date\": \"" << date << "\"," << endl
+       << "    \"jsbsim_version\": \""
+       << Escape(JSBSim::FGJSBBase().GetVersion()) << "\"," << endl
+       << "    \"library_build_type\": \"" << JSBSIM_BENCH_BUILD_TYPE << "\","
+       << endl
+       << "    \"repetitions\": " << repetitions << endl
+       << "  }," << endl
+       << "  \"benchmarks\": [";
+
+  json << setprecision(6) << fixed;
+  for (unsigned int i=0; i<results.size(); i++) {
+    const Result& r = results[i];
+    json << (i ? "," : "") << endl
+         << "    {" << endl
+         << "      \"name\": \"" << Escape(r.name) << "\"," << endl
+         << "      \"iterations\": " << r.iterations << "," << endl
+         << "      \"real_time\": " << r.median << "," << endl
+         << "      \"min_time\": " << r.min << "," << endl
+         << "      \"mean_time\": " << r.mean << "," << endl
+         << "      \"stddev_time\": " << r.stddev << "," << endl
+         << "      \"time_unit\": \"ns\"," << endl
+         << "      \"iteration_unit\": \"" << Escape(r.unit) << "\"" << endl
+         << "    }";
+  }
+  json << endl << "  ]" << endl << "}" << endl;
+
+  return json.good();
+}
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+using namespace JSBSimBench;
+
+static void PrintHelp(void)
+{
+  cout << "Usage: jsbsim_bench [options]" << endl << endl
+       << "  --filter=<text>       only runs the cases which name contains text"
+       << endl
+       << "  --json=<file>         writes the results to a JSON file" << endl
+       << "  --min-time=<seconds>  minimum duration of a repetition (0.1)"
+       << endl
+       << "  --repetitions=<n>     number of timed repetitions (5)" << endl
+       << "  --root=<directory>    JSBSim root directory of the aircraft"
+       << endl
+       << "  --list                lists the cases and exits" << endl;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int main(int argc, char* argv[])
+{
+  string filter, jsonFile;
+  double minTime = 0.1;
+  unsigned int repetitions = 5;
+  bool list = false;
+
+  for (int i=1; i<argc; i++) {
+    string arg(argv[i]);
+    string value = arg.substr(arg.find('=')+1);
+
+    if (arg.compare(0, 9, "--filter=") == 0)
+      filter = value;
+    else if (arg.compare(0, 7, "--json=") == 0)
+      jsonFile = value;
+    else if (arg.compare(0, 11, "--min-time=") == 0)
+      minTime = atof(value.c_str());
+    else if (arg.compare(0, 14, "--repetitions=") == 0)
+      repetitions = max(atoi(value.c_str()), 1);
+    else if (arg.compare(0, 7, "--root=") == 0)
+      RootDir = SGPath(value);
+    else if (arg == "--list")
+      list = true;
+    else {
+      PrintHelp();
+      return arg == "--help" ? 0 : 1;
+    }
+  }
+
+  vector<Result> results;
+
+  if (!list)
+    cout << left << setw(36) << "Benchmark" << right << setw(14) << "Time"
+         << setw(12) << "Min" << setw(9) << "StdDev" << setw(12)
+         << "Iterations" << endl << string(83, '-') << endl;
+
+  for (auto& entry: GetRegistry()) {
+    const string& name = entry.first;
+    if (name.find(filter) == string::npos) continue;
+
+    if (list) {
+      cout << name << endl;
+      continue;
+    }
+
+    try {
+      unique_ptr<Case> c(entry.second());
+      results.push_back(Measure(name, *c, minTime, repetitions));
+    }
+    catch (const string& msg) {
+      cerr << name << ": " << msg << endl;
+      return 1;
+    }
+
+    const Result& r = results.back();
+    cout << left << setw(36) << name << right << fixed << setprecision(1)
+         << setw(11) << r.median << " ns" << setw(9) << r.min << " ns"
+         << setw(8) << 100.0*r.stddev/r.mean << "%" << setw(12)
+         << r.iterations << "  /" << r.unit << endl;
+  }
+
+  if (!jsonFile.empty() && !WriteJSON(jsonFile, results, repetitions)) {
+    cerr << "Could not write " << jsonFile << endl;
+    return 1;
+  }
+
+  // Prevents the compiler from discarding the computations.
+  if (std::isnan(Sink)) cout << "NaN" << endl;
+
+  return 0;
+}
@@ -0,0 +1,277 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       MathBench.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+ Purpose:      Benchmark cases for the math classes
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+COMMENTS, REFERENCES,  and NOTES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+The inputs are cycled through a small set of precomputed values so that each
+iteration does the full computation: the caches of FGLocation and FGQuaternion
+are invalidated and the memoization of FGFunction never hits.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+#include "JSBSimBench.h"
+#include "FGFDMExec.h"
+#include "math/FGFunction.h"
+#include "math/FGLocation.h"
+#include "math/FGQuaternion.h"
+#include "math/FGTable.h"
+#include "input_output/FGXMLParse.h"
+
+using namespace std;
+using namespace JSBSim;
+using namespace JSBSimBench;
+
+namespace {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+const size_t nKeys = 1024; // A power of 2
+
+// Keys between -1 and 51, sorted (a sweep) or scattered.
+vector<double> MakeKeys(bool sorted)
+{
+  vector<double> keys(nKeys);
+
+  for (size_t i=0; i<nKeys; i++)
+    keys[i] = sorted ? -1.0 + 52.0*i/nKeys : fmod(i*7.919, 52.0) - 1.0;
+
+  return keys;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// A 1D table with 100 breakpoints (like a thrust table) and a 2D table with
+// 100x20 breakpoints (like an aerodynamic coefficient).
+
+class TableCase : public Case
+{
+public:
+  TableCase(bool sorted, bool twoD, bool batch)
+    : t1(100), t2(100, 20), keys(MakeKeys(sorted)), values(nKeys), TwoD(twoD),
+      Batch(batch)
+  {
+    for (unsigned int r=0; r<100; r++)
+      t1 << 0.5*r << sin(0.05*r);
+
+    for (unsigned int c=0; c<20; c++)
+      t2 << 0.1*c;
+    for (unsigned int r=0; r<100; r++) {
+      t2 << 0.5*r;
+      for (unsigned int c=0; c<20; c++)
+        t2 << sin(0.05*r)*cos(0.3*c);
+    }
+
+    for (size_t i=0; i<nKeys; i++)
+      columns.push_back(fmod(i*0.137, 2.2) - 0.1);
+  }
+
+  void Run(size_t iterations) override {
+    if (Batch) {
+      // Each iteration is one key: the keys are evaluated by blocks.
+      size_t done = 0;
+      while (done < iterations) {
+        size_t n = min(nKeys, iterations - done);
+        if (TwoD)
+          t2.GetValues(keys.data(), columns.data(), values.data(), n);
+        else
+          t1.GetValues(keys.data(), values.data(), n);
+        Consume(values[n-1]);
+        done += n;
+      }
+    }
+    else {
+      double sum = 0.0;
+      for (size_t i=0; i<iterations; i++) {
+        size_t k = i & (nKeys-1);
+        sum += TwoD ? t2.GetValue(keys[k], columns[k]) : t1.GetValue(keys[k]);
+      }
+      Consume(sum);
+    }
+  }
+
+  string GetUnit(void) const override { return "key"; }
+
+private:
+  FGTable t1, t2;
+  vector<double> keys, columns, values;
+  bool TwoD, Batch;
+};
+
+Registrar r1("FGTable/1D/GetValue/sweep",
+             []() { return new TableCase(true, false, false); });
+Registrar r2("FGTable/1D/GetValues/sweep",
+             []() { return new TableCase(true, false, true); });
+Registrar r3("FGTable/1D/GetValue/scattered",
+             []() { return new TableCase(false, false, false); });
+Registrar r4("FGTable/1D/GetValues/scattered",
+             []() { return new TableCase(false, false, true); });
+Registrar r5("FGTable/2D/GetValue/sweep",
+             []() { return new TableCase(true, true, false); });
+Registrar r6("FGTable/2D/GetValues/sweep",
+             []() { return new TableCase(true, true, true); });
+Registrar r7("FGTable/2D/GetValue/scattered",
+             []() { return new TableCase(false, true, false); });
+Registrar r8("FGTable/2D/GetValues/scattered",
+             []() { return new TableCase(false, true, true); });
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// A typical aerodynamic coefficient: the dynamic pressure times the wing area
+// times a coefficient interpolated in a table of alpha and corrected by the
+// elevator deflection.
+
+class FunctionCase : public Case
+{
+public:
+  explicit FunctionCase(bool compiled) : keys(MakeKeys(false)) {
+    fdmex.SetDebugLevel(0);
+    fdmex.SetCompileFunctions(compiled);
+    auto pm = fdmex.GetPropertyManager();
+    alpha = pm->GetNode("aero/alpha-deg", true);
+    qbar = pm->GetNode("aero/qbar-psf", true);
+    pm->GetNode("metrics/Sw-sqft", true)->setDoubleValue(174.0);
+    pm->GetNode("fcs/elevator-pos-rad", true)->setDoubleValue(0.05);
+
+    istringstream xml("<function><product>"
+                      "<p>aero/qbar-psf</p><p>metrics/Sw-sqft</p>"
+                      "<sum><table>"
+                      "<independentVar>aero/alpha-deg</independentVar>"
+                      "<tableData>-5 -0.2\n0 0.25\n5 0.7\n10 1.1\n15 1.4\n"
+                      "20 1.2\n25 0.9\n30 0.8\n35 0.75\n40 0.7\n45 0.7\n"
+                      "50 0.65</tableData></table>"
+                      "<product><v>0.43</v><p>fcs/elevator-pos-rad</p>"
+                      "<cos><toradians><p>aero/alpha-deg</p></toradians>"
+                      "</cos></product>"
+                      "</sum></product></function>");
+    FGXMLParse parser;
+    readXML(xml, parser);
+    function = new FGFunction(&fdmex, parser.GetDocument());
+  }
+
+  void Run(size_t iterations) override {
+    double sum = 0.0;
+
+    for (size_t i=0; i<iterations; i++) {
+      size_t k = i & (nKeys-1);
+      alpha->setDoubleValue(keys[k]);
+      qbar->setDoubleValue(50.0 + keys[k]);
+      sum += function->GetValue();
+    }
+
+    Consume(sum);
+  }
+
+private:
+  FGFDMExec fdmex;
+  FGPropertyNode_ptr alpha, qbar;
+  SGSharedPtr<FGFunction> function;
+  vector<double> keys;
+};
+
+Registrar r9("FGFunction/GetValue/compiled",
+             []() { return new FunctionCase(true); });
+Registrar r10("FGFunction/GetValue/interpreted",
+             []() { return new FunctionCase(false); });
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Assigning the ECEF coordinates invalidates the cache of the location, which
+// is then computed again by FGLocation::ComputeDerived() when the geodetic
+// altitude is requested.
+
+class LocationCase : public Case
+{
+public:
+  LocationCase(void) {
+    location.SetEllipse(20925646.32546, 20855486.5951);
+
+    for (size_t i=0; i<nKeys; i++) {
+      double lon = fmod(i*0.731, 2.0*M_PI) - M_PI;
+      double lat = fmod(i*0.419, M_PI) - 0.5*M_PI;
+      double radius = 20925646.32546 + 100.0*i;
+      positions.push_back(FGColumnVector3(radius*cos(lat)*cos(lon),
+                                          radius*cos(lat)*sin(lon),
+                                          radius*sin(lat)));
+    }
+  }
+
+  void Run(size_t iterations) override {
+    double sum = 0.0;
+
+    for (size_t i=0; i<iterations; i++) {
+      location = positions[i & (nKeys-1)];
+      sum += location.GetGeodAltitude();
+    }
+
+    Consume(sum);
+  }
+
+private:
+  FGLocation location;
+  vector<FGColumnVector3> positions;
+};
+
+Registrar r11("FGLocation/ComputeDerived",
+             []() { return new LocationCase; });
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The quaternions are stored without their cache: a copy is made at each
+// iteration and its transformation matrix is computed by GetT().
+
+class QuaternionCase : public Case
+{
+public:
+  QuaternionCase(void) {
+    for (size_t i=0; i<nKeys; i++)
+      attitudes.push_back(FGQuaternion(fmod(i*0.731, 2.0*M_PI) - M_PI,
+                                       fmod(i*0.419, M_PI) - 0.5*M_PI,
+                                       fmod(i*0.293, 2.0*M_PI)));
+  }
+
+  void Run(size_t iterations) override {
+    double sum = 0.0;
+
+    for (size_t i=0; i<iterations; i++) {
+      FGQuaternion q(attitudes[i & (nKeys-1)]);
+      sum += q.GetT()(1,3);
+    }
+
+    Consume(sum);
+  }
+
+private:
+  vector<FGQuaternion> attitudes;
+};
+
+Registrar r12("FGQuaternion/GetT", []() { return new QuaternionCase; });
+}
@@ -0,0 +1,234 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       ModelBench.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+ Purpose:      Benchmark cases for the models and the simulation frame
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+COMMENTS, REFERENCES,  and NOTES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+The aircraft are loaded from the JSBSim root directory once per case. Before
+each repetition the initial conditions are run again so that the repetitions
+start from the same state.
+
+The state cases save and restore the state of the c172x after 1000 steps, and
+reset it to its initial conditions for comparison. The clone case copies the
+whole simulation, to be compared with the loading cases of PropertyBench.cpp.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <memory>
+
+#include "JSBSimBench.h"
+#include "FGFDMExec.h"
+#include "initialization/FGInitialCondition.h"
+#include "models/FGGroundReactions.h"
+#include "models/FGLGear.h"
+#include "models/FGPropagate.h"
+
+using namespace std;
+using namespace JSBSim;
+using namespace JSBSimBench;
+
+namespace {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class AircraftCase : public Case
+{
+public:
+  AircraftCase(const string& aircraft, const string& init) {
+    fdmex.SetDebugLevel(0);
+    fdmex.SetRootDir(GetRootDir());
+    fdmex.SetAircraftPath(SGPath("aircraft"));
+    fdmex.SetEnginePath(SGPath("engine"));
+    fdmex.SetSystemsPath(SGPath("systems"));
+
+    if (!fdmex.LoadModel(aircraft))
+      throw string("Aircraft " + aircraft + " was not successfully loaded");
+    SGPath initFile = SGPath::fromLocal8Bit(init.c_str());
+    if (!fdmex.GetIC()->Load(initFile))
+      throw string("Initialization file " + init
+                   + " was not successfully loaded");
+
+    fdmex.DisableOutput();
+    fdmex.RunIC();
+  }
+
+  void SetUp(void) override { fdmex.ResetToInitialConditions(0); }
+
+protected:
+  FGFDMExec fdmex;
+};
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// A complete time step: all the models, the flight control system and the
+// integration of the equations of motion.
+
+class FrameCase : public AircraftCase
+{
+public:
+  FrameCase(const string& aircraft, const string& init)
+    : AircraftCase(aircraft, init) {}
+
+  void Run(size_t iterations) override {
+    for (size_t i=0; i<iterations; i++)
+      fdmex.Run();
+
+    Consume(fdmex.GetPropagate()->GetAltitudeASL());
+  }
+
+  string GetUnit(void) const override { return "frame"; }
+};
+
+Registrar r1("FGFDMExec/Run/c172x",
+             []() { return new FrameCase("c172x", "reset01"); });
+Registrar r2("FGFDMExec/Run/737",
+             []() { return new FrameCase("737", "cruise_init"); });
+Registrar r3("FGFDMExec/Run/f16",
+             []() { return new FrameCase("f16", "reset00"); });
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The integration alone: the accelerations are frozen, so the state is
+// restored regularly to keep it from drifting away from realistic values. The
+// cost of the restoration is spread over 1000 steps.
+
+class PropagateCase : public AircraftCase
+{
+public:
+  PropagateCase(void) : AircraftCase("c172x", "reset01") {}
+
+  void SetUp(void) override {
+    AircraftCase::SetUp();
+    state = fdmex.GetPropagate()->GetVState();
+  }
+
+  void Run(size_t iterations) override {
+    FGPropagate* propagate = fdmex.GetPropagate();
+
+    for (size_t i=0; i<iterations; i++) {
+      if (i % 1000 == 999) propagate->SetVState(state);
+      propagate->Run(false);
+    }
+
+    Consume(propagate->GetAltitudeASL());
+  }
+
+private:
+  FGPropagate::VehicleState state;
+};
+
+Registrar r4("FGPropagate/Run", []() { return new PropagateCase; });
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The forces of all the contact points of an aircraft at rest on the ground.
+// One iteration computes the forces of all the gear units.
+
+class GearCase : public AircraftCase
+{
+public:
+  GearCase(void) : AircraftCase("c172x", "reset_at_rest") {}
+
+  void Run(size_t iterations) override {
+    FGGroundReactions* ground = fdmex.GetGroundReactions();
+    int nGears = ground->GetNumGearUnits();
+    double sum = 0.0;
+
+    for (size_t i=0; i<iterations; i++) {
+      for (int g=0; g<nGears; g++)
+        sum += ground->GetGearUnit(g)->GetBodyForces()(FGJSBBase::eZ);
+    }
+
+    Consume(sum);
+  }
+
+  string GetUnit(void) const override { return "aircraft"; }
+};
+
+Registrar r5("FGLGear/GetBodyForces", []() { return new GearCase; });
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The snapshot of the state of a simulation in flight and its restoration,
+// compared with a reset to the initial conditions which initializes all the
+// models again.
+
+class StateCase : public AircraftCase
+{
+public:
+  enum Operation {opSave, opRestore, opReset, opClone};
+
+  explicit StateCase(Operation _operation)
+    : AircraftCase("c172x", "reset01"), operation(_operation)
+  {
+    for (int i=0; i<1000; i++)
+      fdmex.Run();
+    blob = fdmex.SaveState();
+  }
+
+  void SetUp(void) override {}
+
+  void Run(size_t iterations) override {
+    for (size_t i=0; i<iterations; i++) {
+      switch (operation) {
+      case opSave:
+        Consume(fdmex.SaveState().size());
+        break;
+      case opRestore:
+        fdmex.RestoreState(blob);
+        break;
+      case opReset:
+        fdmex.ResetToInitialConditions(0);
+        break;
+      case opClone:
+        {
+          unique_ptr<FGFDMExec> clone(fdmex.Clone());
+          Consume(clone->GetSimTime());
+        }
+        break;
+      }
+    }
+
+    Consume(fdmex.GetSimTime());
+  }
+
+  string GetUnit(void) const override { return "state"; }
+
+private:
+  Operation operation;
+  string blob;
+};
+
+Registrar r6("FGFDMExec/SaveState/c172x",
+             []() { return new StateCase(StateCase::opSave); });
+Registrar r7("FGFDMExec/RestoreState/c172x",
+             []() { return new StateCase(StateCase::opRestore); });
+Registrar r8("FGFDMExec/ResetToInitialConditions/c172x",
+             []() { return new StateCase(StateCase::opReset); });
+Registrar r9("FGFDMExec/Clone/c172x",
+             []() { return new StateCase(StateCase::opClone); });
+}
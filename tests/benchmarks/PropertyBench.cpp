@@ -0,0 +1,263 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       PropertyBench.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/2026
+ Purpose:      Benchmark cases for the property tree and the aircraft loading
+
+ ------------- Copyright (C) 2026  The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+COMMENTS, REFERENCES,  and NOTES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+The loading cases measure the whole loading of an aircraft, from the parsing
+of its files to the binding of the properties; f22 is the largest aircraft of
+the repository. The cached loading cases read the aircraft files from a binary
+cache file (see FGXMLDocumentCache) instead of parsing them. The shared loading
+cases keep an instance alive, so that the loaded instances find the documents
+in the cache shared by the process. The lookup case resolves, one after the other, the paths of
+all the properties of a loaded aircraft, as the late bound properties and the
+scripts do.
+
+The property value cases read a property through FGPropertyValue as the
+functions and the conditions do, for a property tied to a double variable and
+for a property that holds its own value.
+
+The unit conversion case reads values given in various units, as the models do
+for most of the numeric elements of an aircraft file.
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "JSBSimBench.h"
+#include "FGFDMExec.h"
+#include "input_output/FGXMLDocumentCache.h"
+#include "input_output/FGXMLElement.h"
+#include "math/FGPropertyValue.h"
+
+using namespace std;
+using namespace JSBSim;
+using namespace JSBSimBench;
+
+namespace {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+void LoadAircraft(FGFDMExec& fdmex, const string& aircraft)
+{
+  fdmex.SetDebugLevel(0);
+  fdmex.SetRootDir(GetRootDir());
+  fdmex.SetAircraftPath(SGPath("aircraft"));
+  fdmex.SetEnginePath(SGPath("engine"));
+  fdmex.SetSystemsPath(SGPath("systems"));
+
+  if (!fdmex.LoadModel(aircraft))
+    throw string("Aircraft " + aircraft + " was not successfully loaded");
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void CollectPaths(const SGPropertyNode* node, const string& prefix,
+                  vector<string>& paths)
+{
+  for (int i=0; i<node->nChildren(); i++) {
+    const SGPropertyNode* child = node->getChild(i);
+    string path = prefix + child->getDisplayName(true);
+    paths.push_back(path);
+    CollectPaths(child, path + "/", paths);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+class LoadCase : public Case
+{
+public:
+  enum Mode {lmParse, lmCacheFile, lmShared};
+
+  LoadCase(const string& _aircraft, Mode mode)
+    : aircraft(_aircraft)
+  {
+    if (mode == lmShared) {
+      keeper.reset(new FGFDMExec);
+      LoadAircraft(*keeper, aircraft);
+    }
+    else if (mode == lmCacheFile) {
+      cacheFile = "jsbsim_bench_" + aircraft + ".cache";
+      FGFDMExec fdmex;
+      LoadAircraft(fdmex, aircraft);
+      if (!fdmex.GetDocumentCache()->WriteFile(SGPath(cacheFile)))
+        throw string("The cache file " + cacheFile + " cannot be written");
+    }
+  }
+
+  ~LoadCase() {
+    if (!cacheFile.empty()) remove(cacheFile.c_str());
+  }
+
+  void Run(size_t iterations) override {
+    for (size_t i=0; i<iterations; i++) {
+      FGFDMExec fdmex;
+      if (!cacheFile.empty())
+        fdmex.GetDocumentCache()->ReadFile(SGPath(cacheFile));
+      LoadAircraft(fdmex, aircraft);
+      Consume(fdmex.GetPropertyManager()->GetNode()->nChildren());
+    }
+  }
+
+  string GetUnit(void) const override { return "load"; }
+
+private:
+  string aircraft;
+  string cacheFile;
+  unique_ptr<FGFDMExec> keeper;
+};
+
+Registrar r1("FGFDMExec/LoadModel/c172x",
+             []() { return new LoadCase("c172x", LoadCase::lmParse); });
+Registrar r2("FGFDMExec/LoadModel/f22",
+             []() { return new LoadCase("f22", LoadCase::lmParse); });
+Registrar r6("FGFDMExec/LoadModel/c172x-cached",
+             []() { return new LoadCase("c172x", LoadCase::lmCacheFile); });
+Registrar r7("FGFDMExec/LoadModel/f22-cached",
+             []() { return new LoadCase("f22", LoadCase::lmCacheFile); });
+Registrar r8("FGFDMExec/LoadModel/c172x-shared",
+             []() { return new LoadCase("c172x", LoadCase::lmShared); });
+Registrar r9("FGFDMExec/LoadModel/f22-shared",
+             []() { return new LoadCase("f22", LoadCase::lmShared); });
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+class LookupCase : public Case
+{
+public:
+  LookupCase(void) {
+    LoadAircraft(fdmex, "f22");
+    CollectPaths(fdmex.GetPropertyManager()->GetNode(), "", paths);
+  }
+
+  void Run(size_t iterations) override {
+    FGPropertyNode* root = fdmex.GetPropertyManager()->GetNode();
+    size_t n = paths.size();
+    double sum = 0.0;
+
+    for (size_t i=0; i<iterations; i++)
+      sum += root->getNode(paths[i % n].c_str())->getIndex();
+
+    Consume(sum);
+  }
+
+  string GetUnit(void) const override { return "lookup"; }
+
+private:
+  FGFDMExec fdmex;
+  vector<string> paths;
+};
+
+Registrar r3("SGPropertyNode/getNode/f22", []() { return new LookupCase; });
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+class PropertyValueCase : public Case
+{
+public:
+  explicit PropertyValueCase(bool tied) : x(0.5) {
+    if (tied)
+      pm.Tie("fcs/x", &x);
+    else
+      pm.GetNode("fcs/x", true)->setDoubleValue(x);
+    value = new FGPropertyValue("fcs/x", &pm);
+  }
+
+  void Run(size_t iterations) override {
+    double sum = 0.0;
+    for (size_t i=0; i<iterations; i++)
+      sum += value->GetValue();
+    Consume(sum);
+  }
+
+  string GetUnit(void) const override { return "read"; }
+
+private:
+  double x;
+  FGPropertyManager pm;
+  FGPropertyValue_ptr value;
+};
+
+Registrar r4("FGPropertyValue/GetValue/tied",
+             []() { return new PropertyValueCase(true); });
+Registrar r5("FGPropertyValue/GetValue/local",
+             []() { return new PropertyValueCase(false); });
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+class UnitConversionCase : public Case
+{
+public:
+  UnitConversionCase(void) : root(new Element("root")) {
+    const char* units[][3] = {{"length", "IN", "FT"},
+                              {"area", "M2", "FT2"},
+                              {"weight", "KG", "LBS"},
+                              {"ixx", "SLUG*FT2", "SLUG*FT2"},
+                              {"angle", "DEG", "RAD"},
+                              {"spring_coeff", "N/M", "LBS/FT"},
+                              {"pressure", "PA", "LBS/FT2"},
+                              {"velocity", "KTS", "FT/SEC"}};
+
+    for (auto& unit: units) {
+      Element* child = new Element(unit[0]);
+      child->AddAttribute("unit", unit[1]);
+      child->AddData("12.5");
+      child->SetParent(root);
+      root->AddChildElement(child);
+      conversions.push_back(make_pair(string(unit[0]), string(unit[2])));
+    }
+  }
+
+  void Run(size_t iterations) override {
+    size_t n = conversions.size();
+    double sum = 0.0;
+
+    for (size_t i=0; i<iterations; i++) {
+      const pair<string, string>& c = conversions[i % n];
+      sum += root->FindElementValueAsNumberConvertTo(c.first, c.second);
+    }
+
+    Consume(sum);
+  }
+
+  string GetUnit(void) const override { return "conversion"; }
+
+private:
+  Element_ptr root;
+  vector<pair<string, string> > conversions;
+};
+
+Registrar r10("Element/FindElementValueAsNumberConvertTo",
+              []() { return new UnitConversionCase; });
+}
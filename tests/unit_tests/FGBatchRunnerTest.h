@@ -0,0 +1,167 @@
+#include <string>
+#include <cxxtest/TestSuite.h>
+#include <FGBatchRunner.h>
+#include <FGFDMExec.h>
+
+using namespace JSBSim;
+
+class FGBatchRunnerTest : public CxxTest::TestSuite
+{
+public:
+  void testEmptyBatch() {
+    FGBatchRunner batch(SGPath(JSBSIM_TEST_ROOT_DIR));
+    TS_ASSERT_EQUALS(batch.GetNumCases(), 0);
+    TS_ASSERT(batch.Run().empty());
+  }
+
+  // The results must not depend on the number of threads nor on the runs
+  // previously executed by the same FGFDMExec instance.
+  void testThreadCountIndependence() {
+    std::vector<FGBatchRunner::Result> reference;
+
+    for (unsigned int nthreads=1; nthreads<=4; nthreads*=2) {
+      FGBatchRunner batch(SGPath(JSBSIM_TEST_ROOT_DIR));
+      SetupBallBatch(batch);
+      batch.SetNumThreads(nthreads);
+      const std::vector<FGBatchRunner::Result>& results = batch.Run();
+
+      TS_ASSERT_EQUALS(results.size(), 6);
+      if (reference.empty()) {
+        reference = results;
+        continue;
+      }
+
+      for (unsigned int i=0; i<results.size(); i++) {
+        TS_ASSERT(results[i].success);
+        TS_ASSERT_EQUALS(results[i].sim_time, reference[i].sim_time);
+        TS_ASSERT_EQUALS(results[i].values.size(), 2);
+        TS_ASSERT_EQUALS(results[i].values[0], reference[i].values[0]);
+        TS_ASSERT_EQUALS(results[i].values[1], reference[i].values[1]);
+      }
+    }
+
+    // Higher initial altitudes must end higher.
+    for (unsigned int i=1; i<reference.size(); i++)
+      TS_ASSERT_LESS_THAN(reference[i-1].values[0], reference[i].values[0]);
+  }
+
+  // The properties set by the script events and the systems must not leak
+  // from one run to the next one executed by the same FGFDMExec instance:
+  // c1722.xml engages the attitude hold autopilot at 5 seconds.
+  void testScriptEventsDoNotLeak() {
+    std::vector<FGBatchRunner::Result> reference;
+
+    // Each case alone in its own batch.
+    for (unsigned int i=0; i<4; i++) {
+      FGBatchRunner batch(SGPath(JSBSIM_TEST_ROOT_DIR));
+      SetupC172Batch(batch, i, i+1);
+      const std::vector<FGBatchRunner::Result>& results = batch.Run();
+      TS_ASSERT(results[0].success);
+      reference.push_back(results[0]);
+    }
+
+    for (unsigned int nthreads=1; nthreads<=2; nthreads++) {
+      FGBatchRunner batch(SGPath(JSBSIM_TEST_ROOT_DIR));
+      SetupC172Batch(batch, 0, 4);
+      batch.SetNumThreads(nthreads);
+      const std::vector<FGBatchRunner::Result>& results = batch.Run();
+
+      TS_ASSERT_EQUALS(results.size(), 4);
+      for (unsigned int i=0; i<results.size(); i++) {
+        TS_ASSERT(results[i].success);
+        TS_ASSERT_EQUALS(results[i].sim_time, reference[i].sim_time);
+        TS_ASSERT(results[i].values == reference[i].values);
+      }
+    }
+  }
+
+  void testFailures() {
+    FGBatchRunner batch(SGPath(JSBSIM_TEST_ROOT_DIR));
+    FGBatchRunner::Case run;
+
+    batch.SetScript(SGPath("scripts/ball.xml"));
+    batch.SetEndTime(1.0);
+    batch.AddCase(run);
+    run.properties.push_back(std::make_pair("does/not/exist", 1.0));
+    batch.AddCase(run);
+    batch.SetNumThreads(1);
+
+    const std::vector<FGBatchRunner::Result>& results = batch.Run();
+    TS_ASSERT(results[0].success);
+    TS_ASSERT(!results[1].success);
+    TS_ASSERT(!results[1].error.empty());
+
+    batch.SetScript(SGPath("scripts/no_such_script.xml"));
+    TS_ASSERT(!batch.Run()[0].success);
+  }
+
+  void testCallback() {
+    FGBatchRunner batch(SGPath(JSBSIM_TEST_ROOT_DIR));
+    std::vector<double> frames(6, 0.0);
+
+    SetupBallBatch(batch);
+    batch.SetRunCallback([&frames](unsigned int index, FGFDMExec& fdmex) {
+        frames[index] = fdmex.GetFrame();
+      });
+    batch.Run();
+
+    for (unsigned int i=0; i<frames.size(); i++)
+      TS_ASSERT_DIFFERS(frames[i], 0.0);
+  }
+
+  // The random sequences of a run only depend on the seed and the run index.
+  void testRandomSequences() {
+    std::vector<double> reference;
+
+    for (unsigned int nthreads=1; nthreads<=3; nthreads+=2) {
+      FGBatchRunner batch(SGPath(JSBSIM_TEST_ROOT_DIR));
+      std::vector<double> draws(6, 0.0);
+      std::vector<int> indices(6, -1);
+
+      SetupBallBatch(batch);
+      batch.SetNumThreads(nthreads);
+      batch.SetRunCallback([&](unsigned int index, FGFDMExec& fdmex) {
+          indices[index] = fdmex.GetRunIndex();
+          draws[index] = fdmex.GetRandomGenerator()->GetNormalRandomNumber();
+        });
+      batch.Run();
+
+      if (reference.empty()) reference = draws;
+      for (unsigned int i=0; i<draws.size(); i++) {
+        TS_ASSERT_EQUALS(indices[i], i);
+        TS_ASSERT_EQUALS(draws[i], reference[i]);
+        if (i > 0) TS_ASSERT_DIFFERS(draws[i], draws[i-1]);
+      }
+    }
+  }
+
+private:
+  void SetupC172Batch(FGBatchRunner& batch, unsigned int first,
+                      unsigned int last) {
+    batch.SetScript(SGPath("scripts/c1722.xml"));
+    batch.SetEndTime(6.0);
+    batch.AddOutputProperty("ap/attitude_hold");
+    batch.AddOutputProperty("position/h-sl-ft");
+    batch.AddOutputProperty("attitude/phi-rad");
+
+    for (unsigned int i=first; i<last; i++) {
+      FGBatchRunner::Case run;
+      run.properties.push_back(std::make_pair("ic/vc-kts", 90.0 + 5.0*i));
+      batch.AddCase(run);
+    }
+  }
+
+  void SetupBallBatch(FGBatchRunner& batch) {
+    batch.SetScript(SGPath("scripts/ball.xml"));
+    batch.SetEndTime(5.0);
+    batch.AddOutputProperty("position/h-sl-ft");
+    batch.AddOutputProperty("velocities/v-down-fps");
+
+    for (unsigned int i=0; i<6; i++) {
+      FGBatchRunner::Case run;
+      run.properties.push_back(std::make_pair("ic/h-sl-ft", 1000.0*(i+1)));
+      run.properties.push_back(std::make_pair("ic/vd-fps", 10.0));
+      batch.AddCase(run);
+    }
+  }
+};
@@ -0,0 +1,116 @@
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+#include <input_output/FGCompressedLog.h>
+
+using namespace JSBSim;
+
+class FGCompressedLogTest : public CxxTest::TestSuite
+{
+public:
+  // Writes 10 frames of 3 columns in chunks of 4 frames.
+  std::string WriteLog(bool finish, std::vector<double>& values) {
+    std::ostringstream out;
+    FGCompressedLogWriter log;
+    std::vector<std::string> names = {"Time", "x", "y"};
+
+    log.Start(out, names, 4);
+    TS_ASSERT(log.IsStarted());
+    for (int i=0; i<10; ++i) {
+      double frame[3] = {0.5*i, std::sin(0.1*i), i < 5 ? 1.0 : -1e300};
+      if (i == 7) frame[1] = std::numeric_limits<double>::quiet_NaN();
+      log.AddFrame(frame);
+      values.insert(values.end(), frame, frame+3);
+    }
+    if (finish) {
+      log.Finish();
+      TS_ASSERT(!log.IsStarted());
+    }
+    else
+      out.flush();
+
+    return out.str();
+  }
+
+  bool SameValues(const std::vector<double>& a, const std::vector<double>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i=0; i<a.size(); ++i) {
+      if (std::isnan(a[i]) && std::isnan(b[i])) continue;
+      if (a[i] != b[i]) return false;
+    }
+    return true;
+  }
+
+  void testRoundTrip() {
+    std::vector<double> expected;
+    std::istringstream in(WriteLog(true, expected));
+    FGCompressedLogReader log;
+
+    TS_ASSERT(log.Open(in));
+    TS_ASSERT(log.IsFinished());
+    std::vector<std::string> names = {"Time", "x", "y"};
+    TS_ASSERT(log.GetNames() == names);
+
+    const std::vector<FGCompressedLogReader::Chunk>& chunks = log.GetChunks();
+    TS_ASSERT_EQUALS(chunks.size(), 3);
+    TS_ASSERT_EQUALS(chunks[0].Frames, 4);
+    TS_ASSERT_EQUALS(chunks[2].Frames, 2);
+    TS_ASSERT_EQUALS(chunks[1].StartTime, 2.0);
+    TS_ASSERT_EQUALS(chunks[1].EndTime, 3.5);
+
+    std::vector<double> values, all;
+    for (size_t i=0; i<chunks.size(); ++i) {
+      TS_ASSERT(log.ReadChunk(i, values));
+      all.insert(all.end(), values.begin(), values.end());
+    }
+    TS_ASSERT(SameValues(all, expected));
+    TS_ASSERT(!log.ReadChunk(3, values));
+  }
+
+  void testSeek() {
+    std::vector<double> expected;
+    std::istringstream in(WriteLog(true, expected));
+    FGCompressedLogReader log;
+
+    TS_ASSERT(log.Open(in));
+    TS_ASSERT_EQUALS(log.FindChunk(-1.0), 0);
+    TS_ASSERT_EQUALS(log.FindChunk(0.0), 0);
+    TS_ASSERT_EQUALS(log.FindChunk(1.9), 0);
+    TS_ASSERT_EQUALS(log.FindChunk(2.0), 1);
+    TS_ASSERT_EQUALS(log.FindChunk(100.0), 2);
+
+    // The chunks can be read in any order.
+    std::vector<double> values;
+    TS_ASSERT(log.ReadChunk(2, values));
+    TS_ASSERT(SameValues(values,
+                         std::vector<double>(expected.begin()+24, expected.end())));
+    TS_ASSERT(log.ReadChunk(1, values));
+    TS_ASSERT(SameValues(values,
+                         std::vector<double>(expected.begin()+12, expected.begin()+24)));
+  }
+
+  void testUnfinished() {
+    std::vector<double> expected;
+    std::istringstream in(WriteLog(false, expected));
+    FGCompressedLogReader log;
+
+    // Only the full chunks have been written, their index is rebuilt.
+    TS_ASSERT(log.Open(in));
+    TS_ASSERT(!log.IsFinished());
+    TS_ASSERT_EQUALS(log.GetChunks().size(), 2);
+
+    std::vector<double> values;
+    TS_ASSERT(log.ReadChunk(1, values));
+    TS_ASSERT(SameValues(values,
+                         std::vector<double>(expected.begin()+12, expected.begin()+24)));
+  }
+
+  void testNotALog() {
+    std::istringstream in("JSBSim is not a log");
+    FGCompressedLogReader log;
+    TS_ASSERT(!log.Open(in));
+  }
+};
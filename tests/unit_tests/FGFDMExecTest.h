@@ -0,0 +1,337 @@
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <sstream>
+#include <set>
+#include <vector>
+#include <thread>
+#include <cxxtest/TestSuite.h>
+#include <FGFDMExec.h>
+#include <input_output/FGXMLDocumentCache.h>
+
+class FGFDMExecTest : public CxxTest::TestSuite, public JSBSim::FGJSBBase
+{
+public:
+  void testMessages() {
+    JSBSim::FGFDMExec fdmex;
+    const std::string myMessage = "My message";
+    std::set<int> mesId;
+    // Check that the message queue is empty
+    TS_ASSERT(!fdmex.SomeMessages());
+    TS_ASSERT(!fdmex.ProcessNextMessage());
+    fdmex.ProcessMessage();
+    // Process one text message
+    fdmex.PutMessage(myMessage);
+    TS_ASSERT(fdmex.SomeMessages());
+    Message* message = fdmex.ProcessNextMessage();
+    TS_ASSERT(message);
+    mesId.insert(message->messageId);
+    TS_ASSERT_EQUALS(message->type, Message::eText);
+    TS_ASSERT_EQUALS(message->text, myMessage);
+    TS_ASSERT(!fdmex.SomeMessages());
+    // Check that the message queue is empty again
+    TS_ASSERT(!fdmex.SomeMessages());
+    TS_ASSERT(!fdmex.ProcessNextMessage());
+    fdmex.ProcessMessage();
+    // Process several messages
+    fdmex.PutMessage(CreateIndexedPropertyName(myMessage,0), true);
+    fdmex.PutMessage(CreateIndexedPropertyName(myMessage,1), -1);
+    fdmex.PutMessage(CreateIndexedPropertyName(myMessage,2), 3.14159);
+    for (int i=0; i<3; i++) {
+      std::ostringstream os;
+      TS_ASSERT(fdmex.SomeMessages());
+      message = fdmex.ProcessNextMessage();
+      TS_ASSERT(message);
+      // Check the ID is a unique number
+      TS_ASSERT(!mesId.count(message->messageId));
+      mesId.insert(message->messageId);
+      os << myMessage << "[" << i << "]";
+      TS_ASSERT_EQUALS(message->text, os.str());
+      switch(i) {
+      case 0:
+        TS_ASSERT_EQUALS(message->type, Message::eBool);
+        TS_ASSERT(message->bVal);
+        break;
+      case 1:
+        TS_ASSERT_EQUALS(message->type, Message::eInteger);
+        TS_ASSERT_EQUALS(message->iVal, -1);
+        break;
+      case 2:
+        TS_ASSERT_EQUALS(message->type, Message::eDouble);
+        TS_ASSERT_EQUALS(message->dVal, 3.14159);
+        break;
+      }
+    }
+    // Check that the message queue is empty again
+    TS_ASSERT(!fdmex.SomeMessages());
+    TS_ASSERT(!fdmex.ProcessNextMessage());
+    fdmex.ProcessMessage();
+    // Re-insert the last message in the queue
+    Message backup = *message;
+    fdmex.PutMessage(*message);
+    TS_ASSERT(fdmex.SomeMessages());
+    message = fdmex.ProcessNextMessage();
+    TS_ASSERT(message);
+    TS_ASSERT_EQUALS(message->text, backup.text);
+    // Check that the message ID has not been altered
+    TS_ASSERT_EQUALS(message->messageId, backup.messageId);
+    TS_ASSERT(mesId.count(message->messageId));
+    TS_ASSERT_EQUALS(message->subsystem, backup.subsystem);
+    TS_ASSERT_EQUALS(message->type, Message::eDouble);
+    TS_ASSERT_EQUALS(message->dVal, 3.14159);
+    // Check that the message queue is empty again
+    TS_ASSERT(!fdmex.SomeMessages());
+    TS_ASSERT(!fdmex.ProcessNextMessage());
+    fdmex.ProcessMessage();
+    // Process several messages
+    fdmex.PutMessage(myMessage);
+    fdmex.PutMessage(CreateIndexedPropertyName(myMessage,0), true);
+    fdmex.PutMessage(CreateIndexedPropertyName(myMessage,1), -1);
+    fdmex.PutMessage(CreateIndexedPropertyName(myMessage,2), 3.14159);
+    // Ugly hack to generate a malformed message
+    unsigned char* _type = (unsigned char*)(&backup.type);
+    *_type = 0xff;
+    fdmex.PutMessage(backup);
+    TS_ASSERT(fdmex.SomeMessages());
+    fdmex.ProcessMessage();
+    // Check that the message queue is empty again
+    TS_ASSERT(!fdmex.SomeMessages());
+    TS_ASSERT(!fdmex.ProcessNextMessage());
+    fdmex.ProcessMessage();
+  }
+
+  void testMessageQueuesAreIndependent() {
+    JSBSim::FGFDMExec fdm1, fdm2;
+    fdm1.PutMessage("fdm1");
+    TS_ASSERT(fdm1.SomeMessages());
+    TS_ASSERT(!fdm2.SomeMessages());
+    TS_ASSERT(!fdm2.ProcessNextMessage());
+    TS_ASSERT(fdm1.ProcessNextMessage());
+  }
+
+  // Each executive queries its own ground callback, even when several of them
+  // are used from the same thread.
+  void testGroundCallbacksAreIndependent() {
+    std::unique_ptr<JSBSim::FGFDMExec> fdm1(new JSBSim::FGFDMExec);
+    std::unique_ptr<JSBSim::FGFDMExec> fdm2(new JSBSim::FGFDMExec);
+    TS_ASSERT(LoadScript(*fdm1, "scripts/ball.xml"));
+    TS_ASSERT(LoadScript(*fdm2, "scripts/ball.xml"));
+
+    double altitude = fdm1->GetPropertyValue("position/h-sl-ft");
+    double agl = fdm1->GetPropertyValue("position/h-agl-ft");
+    fdm2->SetPropertyValue("position/terrain-elevation-asl-ft",
+                           altitude + 1000.0);
+    TS_ASSERT_DELTA(fdm2->GetPropertyValue("position/h-agl-ft"), -1000.0,
+                    1E-6);
+    TS_ASSERT_EQUALS(fdm1->GetPropertyValue("position/h-agl-ft"), agl);
+
+    fdm2.reset();
+    TS_ASSERT_EQUALS(fdm1->GetPropertyValue("position/h-agl-ft"), agl);
+    TS_ASSERT(fdm1->Run());
+  }
+
+  void testRunIndex() {
+    JSBSim::FGFDMExec fdmex;
+    auto generator = fdmex.GetRandomGenerator();
+    std::vector<double> sequence;
+
+    TS_ASSERT_EQUALS(fdmex.GetRunIndex(), 0);
+    fdmex.SetRunIndex(3);
+    TS_ASSERT_EQUALS(fdmex.GetPropertyValue("simulation/run-index"), 3.0);
+    for (int i=0; i<10; i++)
+      sequence.push_back(generator->GetNormalRandomNumber());
+
+    // The sequence only depends on the seed and the run index
+    fdmex.SetPropertyValue("simulation/run-index", 4.0);
+    TS_ASSERT_DIFFERS(generator->GetNormalRandomNumber(), sequence[0]);
+    fdmex.SetRunIndex(3);
+    for (int i=0; i<10; i++)
+      TS_ASSERT_EQUALS(generator->GetNormalRandomNumber(), sequence[i]);
+
+    JSBSim::FGFDMExec other;
+    other.SetRunIndex(3);
+    TS_ASSERT_EQUALS(other.GetRandomGenerator()->GetNormalRandomNumber(),
+                     sequence[0]);
+    other.SetPropertyValue("simulation/randomseed", 1.0);
+    TS_ASSERT_DIFFERS(other.GetRandomGenerator()->GetNormalRandomNumber(),
+                      sequence[0]);
+  }
+
+  // Running the initial conditions again without starting a new output
+  // carries on writing in the same file.
+  void testResetKeepsOutputFile() {
+    const std::string csvName = "FGFDMExecTest_reset.csv";
+
+    auto countLines = [&](bool reset) {
+      {
+        JSBSim::FGFDMExec fdmex;
+        SetPaths(fdmex);
+        // The ball writes its output once per second.
+        if (!fdmex.LoadScript(SGPath(JSBSIM_TEST_ROOT_DIR)/"scripts/ball.xml"))
+          return 0u;
+        if (!fdmex.SetOutputFileName(0, csvName)) return 0u;
+        fdmex.RunIC();
+        while (fdmex.GetSimTime() < 2.0) fdmex.Run();
+        if (reset) {
+          fdmex.ResetToInitialConditions(0);
+          while (fdmex.GetSimTime() < 2.0) fdmex.Run();
+        }
+      }
+
+      std::ifstream csv(csvName);
+      std::string line;
+      unsigned int lines = 0;
+      while (std::getline(csv, line)) lines++;
+      csv.close();
+      std::remove(csvName.c_str());
+      return lines;
+    };
+
+    unsigned int lines = countLines(false);
+    TS_ASSERT(lines > 1);
+    // The header is written once, followed by the records of both runs.
+    TS_ASSERT_EQUALS(countLines(true), 2*lines - 1);
+  }
+
+  // Each thread runs its own FGFDMExec instance: the results must be the same
+  // as when the instances are run one after the other.
+  void testMultipleThreads() {
+    const unsigned int nthreads = 4;
+    const unsigned int nsteps = 2000;
+    std::vector<double> altitude(nthreads, 0.0);
+    std::vector<double> latitude(nthreads, 0.0);
+    std::vector<double> reference(2, 0.0);
+    std::vector<std::thread> threads;
+
+    RunBall(nsteps, reference[0], reference[1]);
+    TS_ASSERT_DIFFERS(reference[0], 0.0);
+
+    for (unsigned int i=0; i<nthreads; i++)
+      threads.push_back(std::thread(&FGFDMExecTest::RunBall, this, nsteps,
+                                    std::ref(altitude[i]),
+                                    std::ref(latitude[i])));
+    for (auto& thread: threads)
+      thread.join();
+
+    for (unsigned int i=0; i<nthreads; i++) {
+      TS_ASSERT_EQUALS(altitude[i], reference[0]);
+      TS_ASSERT_EQUALS(latitude[i], reference[1]);
+    }
+  }
+
+  // The simulation continues from a restored state exactly as it did after
+  // the state was saved, in the same instance and in another one.
+  void testSaveRestoreState() {
+    const std::vector<std::string> names = {"position/h-sl-ft",
+                                            "attitude/phi-rad",
+                                            "aero/coefficient/CLalpha",
+                                            "fcs/aileron-cmd-norm",
+                                            "propulsion/engine/thrust-lbs",
+                                            "simulation/sim-time-sec"};
+    JSBSim::FGFDMExec fdmex;
+    TS_ASSERT(LoadScript(fdmex, "scripts/c1722.xml"));
+    for (unsigned int i=0; i<1000; i++)
+      fdmex.Run();
+
+    std::string blob = fdmex.SaveState();
+    double time = fdmex.GetSimTime();
+    std::vector<double> reference = RunAndRecord(fdmex, names, 500);
+    TS_ASSERT_DIFFERS(reference[0], fdmex.GetPropertyValue(names[0]));
+
+    fdmex.RestoreState(blob);
+    TS_ASSERT_EQUALS(fdmex.GetSimTime(), time);
+    TS_ASSERT(RunAndRecord(fdmex, names, 500) == reference);
+
+    JSBSim::FGFDMExec other;
+    TS_ASSERT(LoadScript(other, "scripts/c1722.xml"));
+    other.RestoreState(blob);
+    TS_ASSERT(RunAndRecord(other, names, 500) == reference);
+
+    // The blob must match the simulation.
+    TS_ASSERT_THROWS(fdmex.RestoreState(blob.substr(0, blob.size()/2)),
+                     std::string);
+    TS_ASSERT_THROWS(fdmex.RestoreState(blob + '\0'), std::string);
+    JSBSim::FGFDMExec ball;
+    TS_ASSERT(LoadScript(ball, "scripts/ball.xml"));
+    TS_ASSERT_THROWS(ball.RestoreState(blob), std::string);
+  }
+
+  void testClone() {
+    const std::vector<std::string> names = {"position/h-sl-ft",
+                                            "attitude/phi-rad",
+                                            "fcs/aileron-cmd-norm",
+                                            "propulsion/engine/thrust-lbs",
+                                            "simulation/sim-time-sec",
+                                            "test/value"};
+    JSBSim::FGFDMExec empty;
+    TS_ASSERT_THROWS(empty.Clone(), std::string);
+
+    JSBSim::FGFDMExec fdmex;
+    TS_ASSERT(LoadScript(fdmex, "scripts/c1722.xml"));
+    for (unsigned int i=0; i<1000; i++)
+      fdmex.Run();
+    fdmex.SetPropertyValue("test/value", 2.5);
+
+    size_t ndocuments = fdmex.GetDocumentCache()->GetNumDocuments();
+    TS_ASSERT(ndocuments > 1);
+
+    // All the simulations share the same documents.
+    JSBSim::FGFDMExec other;
+    TS_ASSERT_EQUALS(other.GetDocumentCache(), fdmex.GetDocumentCache());
+
+    // The clone does not read any file.
+    std::unique_ptr<JSBSim::FGFDMExec> clone(fdmex.Clone());
+    TS_ASSERT_EQUALS(clone->GetDocumentCache(), fdmex.GetDocumentCache());
+    TS_ASSERT_EQUALS(fdmex.GetDocumentCache()->GetNumDocuments(), ndocuments);
+    TS_ASSERT_EQUALS(clone->GetSimTime(), fdmex.GetSimTime());
+    TS_ASSERT_EQUALS(clone->GetPropertyValue("test/value"), 2.5);
+
+    // Both simulations continue identically and independently.
+    std::vector<double> reference = RunAndRecord(fdmex, names, 500);
+    TS_ASSERT(RunAndRecord(*clone, names, 500) == reference);
+    clone->SetPropertyValue("fcs/aileron-cmd-norm", 0.5);
+    TS_ASSERT_DIFFERS(fdmex.GetPropertyValue("fcs/aileron-cmd-norm"), 0.5);
+  }
+
+private:
+  // The output files are relative to the root directory. The root directory
+  // is therefore the current directory so that the outputs of the scripts are
+  // not written in the source tree; the models are read from the source tree.
+  void SetPaths(JSBSim::FGFDMExec& fdmex) {
+    const SGPath sourceDir(JSBSIM_TEST_ROOT_DIR);
+    fdmex.SetDebugLevel(0);
+    fdmex.SetRootDir(SGPath("."));
+    fdmex.SetAircraftPath(sourceDir/"aircraft");
+    fdmex.SetEnginePath(sourceDir/"engine");
+    fdmex.SetSystemsPath(sourceDir/"systems");
+  }
+
+  bool LoadScript(JSBSim::FGFDMExec& fdmex, const std::string& script) {
+    SetPaths(fdmex);
+    if (!fdmex.LoadScript(SGPath(JSBSIM_TEST_ROOT_DIR)/script)) return false;
+    fdmex.DisableOutput();
+    return fdmex.RunIC();
+  }
+
+  std::vector<double> RunAndRecord(JSBSim::FGFDMExec& fdmex,
+                                   const std::vector<std::string>& names,
+                                   unsigned int nsteps) {
+    std::vector<double> values;
+    for (unsigned int i=0; i<nsteps; i++) {
+      fdmex.Run();
+      for (auto& name: names)
+        values.push_back(fdmex.GetPropertyValue(name));
+    }
+    return values;
+  }
+
+  void RunBall(unsigned int nsteps, double& altitude, double& latitude) {
+    JSBSim::FGFDMExec fdmex;
+    if (!LoadScript(fdmex, "scripts/ball.xml")) return;
+    for (unsigned int i=0; i<nsteps; i++)
+      fdmex.Run();
+    altitude = fdmex.GetPropertyValue("position/h-sl-ft");
+    latitude = fdmex.GetPropertyValue("position/lat-geod-deg");
+  }
+};
@@ -0,0 +1,219 @@
+#include <string>
+#include <sstream>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+#include <FGFDMExec.h>
+#include <math/FGFunction.h>
+#include <input_output/FGXMLParse.h>
+#include <input_output/FGXMLElement.h>
+
+using namespace JSBSim;
+
+// Parses an XML string and returns its root element.
+static Element_ptr ReadXML(const std::string& XML)
+{
+  std::istringstream data(XML);
+  FGXMLParse parser;
+  readXML(data, parser);
+  return parser.GetDocument();
+}
+
+class FGFunctionTest : public CxxTest::TestSuite
+{
+public:
+  FGFunctionTest() {
+    functions = {
+      "<sum><p>test/x</p><v>1.5</v><p>test/y</p></sum>",
+      "<product><p>test/x</p><v>-2.0</v><p>test/y</p><pi/></product>",
+      "<difference><p>test/x</p><p>test/y</p><v>0.25</v></difference>",
+      "<avg><p>test/x</p><p>test/y</p><v>3.0</v></avg>",
+      "<min><p>test/x</p><p>test/y</p><v>0.5</v></min>",
+      "<max><p>test/x</p><p>test/y</p><v>0.5</v></max>",
+      "<quotient><p>test/x</p><p>test/y</p></quotient>",
+      "<fmod><p>test/x</p><p>test/y</p></fmod>",
+      "<pow><abs><p>test/x</p></abs><p>test/y</p></pow>",
+      "<atan2><p>test/x</p><p>test/y</p></atan2>",
+      "<mod><p>test/x</p><v>3</v></mod>",
+      "<sqrt><p>test/x</p></sqrt>",
+      "<ln><p>test/x</p></ln>",
+      "<log2><p>test/x</p></log2>",
+      "<log10><p>test/x</p></log10>",
+      "<sign><p>test/y</p></sign>",
+      "<sin><toradians><p>test/x</p></toradians></sin>",
+      "<todegrees><acos><cos><p>test/y</p></cos></acos></todegrees>",
+      "<integer><p>test/x</p></integer>",
+      "<fraction><p>test/x</p></fraction>",
+      "<ifthen><lt><p>test/x</p><p>test/y</p></lt><p>test/x</p><p>test/y</p></ifthen>",
+      "<and><ge><p>test/x</p><v>0</v></ge><nq><p>test/y</p><v>0</v></nq></and>",
+      "<or><le><p>test/x</p><v>0</v></le><eq><p>test/y</p><v>0</v></eq></or>",
+      "<not><gt><p>test/x</p><p>test/y</p></gt></not>",
+      "<switch><p>test/i</p><p>test/x</p><p>test/y</p><v>7</v></switch>",
+      "<interpolate1d><p>test/x</p><v>-1</v><v>0</v><v>1</v><v>5</v><v>2</v><v>3</v></interpolate1d>",
+      "<table><independentVar>test/x</independentVar><tableData>-1 1\n 2 -3</tableData></table>",
+      "<sum><product><v>2</v><sum><v>1</v><v>3</v></sum></product><p>test/x</p></sum>",
+      "<sum><random/><urandom/><quotient><random/><p>test/y</p></quotient></sum>"
+    };
+  }
+
+  // Checks that the compiled functions and the tree interpreter return the
+  // same values.
+  void testCompiledVsInterpreted() {
+    FGFDMExec fdmCompiled, fdmInterpreted;
+    fdmInterpreted.SetCompileFunctions(false);
+    std::vector<SGSharedPtr<FGFunction> > compiled, interpreted;
+
+    for (auto fdm: {&fdmCompiled, &fdmInterpreted}) {
+      auto pm = fdm->GetPropertyManager();
+      pm->GetNode("test/x", true);
+      pm->GetNode("test/y", true);
+      pm->GetNode("test/i", true);
+    }
+
+    for (auto& f: functions) {
+      Element_ptr el = ReadXML("<function>"+f+"</function>");
+      compiled.push_back(new FGFunction(&fdmCompiled, el));
+      interpreted.push_back(new FGFunction(&fdmInterpreted, el));
+      TS_ASSERT(compiled.back()->IsCompiled());
+      TS_ASSERT(!interpreted.back()->IsCompiled());
+    }
+
+    const double values[] = {-2.5, -1.0, 0.0, 0.3, 1.0, 4.75};
+    for (double x: values) {
+      for (double y: values) {
+        for (auto fdm: {&fdmCompiled, &fdmInterpreted}) {
+          auto pm = fdm->GetPropertyManager();
+          pm->GetNode("test/x")->setDoubleValue(x);
+          pm->GetNode("test/y")->setDoubleValue(y);
+          pm->GetNode("test/i")->setDoubleValue(x > 0.0 ? 2 : 1);
+        }
+
+        for (unsigned int i=0; i < functions.size(); ++i) {
+          double expected = interpreted[i]->GetValue();
+          double value = compiled[i]->GetValue();
+          if (std::isnan(expected))
+            TS_ASSERT(std::isnan(value));
+          else
+            TS_ASSERT_EQUALS(value, expected);
+        }
+      }
+    }
+  }
+
+  // Checks that the constant operations are evaluated by the compiler.
+  void testConstantFolding() {
+    FGFDMExec fdmex;
+    Element_ptr el = ReadXML("<function><product><v>2</v><sum><v>1</v>"
+                             "<pi/></sum><cos><v>0</v></cos></product>"
+                             "</function>");
+    FGFunction f(&fdmex, el);
+    TS_ASSERT(f.IsCompiled());
+    TS_ASSERT_EQUALS(f.GetValue(), 2.0*(1.0+M_PI));
+  }
+
+  // Checks the simplification of the functions at load time.
+  void testSimplification() {
+    FGFDMExec fdmex;
+    auto pm = fdmex.GetPropertyManager();
+    auto x = pm->GetNode("test/x", true);
+    auto c = pm->GetNode("test/c", true);
+    c->setDoubleValue(3.0);
+    c->setAttribute(SGPropertyNode::CONSTANT, true);
+    x->setDoubleValue(2.0);
+
+    // test/c is folded while test/x is not.
+    Element_ptr el = ReadXML("<function><product><p>test/c</p><p>test/x</p>"
+                             "</product></function>");
+    FGFunction f1(&fdmex, el);
+    FGFDMExec::FunctionStatistics& stats = fdmex.GetFunctionStatistics();
+    TS_ASSERT_EQUALS(stats.nodes, 3);
+    TS_ASSERT_EQUALS(stats.folded, 1);
+    TS_ASSERT_EQUALS(stats.eliminated, 0);
+    TS_ASSERT_EQUALS(f1.GetValue(), 6.0);
+    c->setAttribute(SGPropertyNode::CONSTANT, false);
+    c->setDoubleValue(4.0);
+    TS_ASSERT_EQUALS(f1.GetValue(), 6.0);
+    x->setDoubleValue(1.0);
+    TS_ASSERT_EQUALS(f1.GetValue(), 3.0);
+
+    // The branch that is not selected by a constant condition is removed.
+    c->setAttribute(SGPropertyNode::CONSTANT, true);
+    stats = FGFDMExec::FunctionStatistics();
+    el = ReadXML("<function><ifthen><gt><p>test/c</p><v>0</v></gt>"
+                 "<p>test/x</p><sum><p>test/x</p><v>1</v></sum></ifthen>"
+                 "</function>");
+    FGFunction f2(&fdmex, el);
+    TS_ASSERT_EQUALS(stats.nodes, 8);
+    TS_ASSERT_EQUALS(stats.folded, 2);
+    TS_ASSERT_EQUALS(stats.eliminated, 7);
+    TS_ASSERT_EQUALS(f2.GetValue(), 1.0);
+
+    // Named functions are tied to a property and are never removed.
+    stats = FGFDMExec::FunctionStatistics();
+    el = ReadXML("<function><sum name=\"test/y\"><v>1</v><v>2</v></sum>"
+                 "</function>");
+    FGFunction f3(&fdmex, el);
+    TS_ASSERT_EQUALS(stats.folded, 0);
+    TS_ASSERT_EQUALS(f3.GetValue(), 3.0);
+    TS_ASSERT_EQUALS(pm->GetNode("test/y")->getDoubleValue(), 3.0);
+    pm->Untie("test/y");
+  }
+
+  // Checks that the functions are only evaluated again when their inputs have
+  // changed.
+  void testMemoization() {
+    FGFDMExec fdmex;
+    auto pm = fdmex.GetPropertyManager();
+    auto x = pm->GetNode("test/x", true);
+    double t = 1.0;
+    pm->Tie("test/t", &t);
+    x->setDoubleValue(2.0);
+
+    Element_ptr el = ReadXML("<function><product><p>test/x</p><table>"
+                             "<independentVar>test/t</independentVar>"
+                             "<tableData>0 1\n 2 3</tableData></table>"
+                             "</product></function>");
+    FGFunction f(&fdmex, el);
+    TS_ASSERT(!f.IsMemoized());
+    TS_ASSERT_EQUALS(f.GetValue(), 4.0);
+    TS_ASSERT(f.IsMemoized());
+    TS_ASSERT_EQUALS(f.GetValue(), 4.0);
+
+    // Untied property
+    unsigned int version = x->getVersion();
+    x->setDoubleValue(3.0);
+    TS_ASSERT(x->getVersion() != version);
+    TS_ASSERT_EQUALS(f.GetValue(), 6.0);
+
+    // Tied property modified behind the back of the property tree.
+    t = 2.0;
+    TS_ASSERT_EQUALS(f.GetValue(), 9.0);
+    t = 0.0;
+    TS_ASSERT_EQUALS(f.GetValue(), 3.0);
+
+    // The random numbers are never memoized.
+    el = ReadXML("<function><sum><p>test/x</p><random/></sum></function>");
+    FGFunction r(&fdmex, el);
+    double value = r.GetValue();
+    TS_ASSERT(!r.IsMemoized());
+    TS_ASSERT_DIFFERS(r.GetValue(), value);
+    pm->Untie("test/t");
+  }
+
+  // Checks that the malformed conditions are still reported.
+  void testMalformedCondition() {
+    FGFDMExec fdmex;
+    auto x = fdmex.GetPropertyManager()->GetNode("test/x", true);
+    Element_ptr el = ReadXML("<function><ifthen><p>test/x</p><v>1</v>"
+                             "<v>2</v></ifthen></function>");
+    FGFunction f(&fdmex, el);
+    x->setDoubleValue(1.0);
+    TS_ASSERT_EQUALS(f.GetValue(), 1.0);
+    x->setDoubleValue(0.0);
+    TS_ASSERT_EQUALS(f.GetValue(), 2.0);
+    x->setDoubleValue(2.0);
+    TS_ASSERT_THROWS(f.GetValue(), const char*);
+  }
+
+private:
+  std::vector<std::string> functions;
+};
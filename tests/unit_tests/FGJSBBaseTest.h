@@ -1,98 +1,12 @@
 #include <string>
 #include <limits>
+#include <vector>
 #include <cxxtest/TestSuite.h>
 #include <FGJSBBase.h>
 
 class FGJSBBaseTest : public CxxTest::TestSuite, public JSBSim::FGJSBBase
 {
 public:
-  void testMessages() {
-    const std::string myMessage = "My message";
-    std::set<int> mesId;
-    // Check that the message queue is empty
-    TS_ASSERT(!SomeMessages());
-    TS_ASSERT(!ProcessNextMessage());
-    ProcessMessage();
-    // Process one text message
-    PutMessage(myMessage);
-    TS_ASSERT(SomeMessages());
-    Message* message = ProcessNextMessage();
-    TS_ASSERT(message);
-    mesId.insert(message->messageId);
-    TS_ASSERT_EQUALS(message->type, Message::eText);
-    TS_ASSERT_EQUALS(message->text, myMessage);
-    TS_ASSERT(!SomeMessages());
-    // Check that the message queue is empty again
-    TS_ASSERT(!SomeMessages());
-    TS_ASSERT(!ProcessNextMessage());
-    ProcessMessage();
-    // Process several messages
-    PutMessage(CreateIndexedPropertyName(myMessage,0), true);
-    PutMessage(CreateIndexedPropertyName(myMessage,1), -1);
-    PutMessage(CreateIndexedPropertyName(myMessage,2), 3.14159);
-    for (int i=0; i<3; i++) {
-      std::ostringstream os;
-      TS_ASSERT(SomeMessages());
-      message = ProcessNextMessage();
-      TS_ASSERT(message);
-      // Check the ID is a unique number
-      TS_ASSERT(!mesId.count(message->messageId));
-      mesId.insert(message->messageId);
-      os << myMessage << "[" << i << "]";
-      TS_ASSERT_EQUALS(message->text, os.str());
-      switch(i) {
-      case 0:
-        TS_ASSERT_EQUALS(message->type, Message::eBool);
-        TS_ASSERT(message->bVal);
-        break;
-      case 1:
-        TS_ASSERT_EQUALS(message->type, Message::eInteger);
-        TS_ASSERT_EQUALS(message->iVal, -1);
-        break;
-      case 2:
-        TS_ASSERT_EQUALS(message->type, Message::eDouble);
-        TS_ASSERT_EQUALS(message->dVal, 3.14159);
-        break;
-      }
-    }
-    // Check that the message queue is empty again
-    TS_ASSERT(!SomeMessages());
-    TS_ASSERT(!ProcessNextMessage());
-    ProcessMessage();
-    // Re-insert the last message in the queue
-    Message backup = *message;
-    PutMessage(*message);
-    TS_ASSERT(SomeMessages());
-    message = ProcessNextMessage();
-    TS_ASSERT(message);
-    TS_ASSERT_EQUALS(message->text, backup.text);
-    // Check that the message ID has not been altered
-    TS_ASSERT_EQUALS(message->messageId, backup.messageId);
-    TS_ASSERT(mesId.count(message->messageId));
-    TS_ASSERT_EQUALS(message->subsystem, backup.subsystem);
-    TS_ASSERT_EQUALS(message->type, Message::eDouble);
-    TS_ASSERT_EQUALS(message->dVal, 3.14159);
-    // Check that the message queue is empty again
-    TS_ASSERT(!SomeMessages());
-    TS_ASSERT(!ProcessNextMessage());
-    ProcessMessage();
-    // Process several messages
-    PutMessage(myMessage);
-    PutMessage(CreateIndexedPropertyName(myMessage,0), true);
-    PutMessage(CreateIndexedPropertyName(myMessage,1), -1);
-    PutMessage(CreateIndexedPropertyName(myMessage,2), 3.14159);
-    // Ugly hack to generate a malformed message
-    unsigned char* _type = (unsigned char*)(&backup.type);
-    *_type = 0xff;
-    PutMessage(backup);
-    TS_ASSERT(SomeMessages());
-    ProcessMessage();
-    // Check that the message queue is empty again
-    TS_ASSERT(!SomeMessages());
-    TS_ASSERT(!ProcessNextMessage());
-    ProcessMessage();
-  }
-
   void testCASConversion() {
     double p = 2116.228;
     TS_ASSERT_EQUALS(VcalibratedFromMach(-0.1, p), 0.0);
@@ -124,10 +38,62 @@ public:
     Filter f0;
     Filter f(1.0, 1E-5);
     double x = f.execute(3.0);
-    // Called twice for 100% coverage
-    // Need to test that the numbers follow a Gaussian law ?
-    double ran0 = GaussianRandomNumber();
-    double ran1 = GaussianRandomNumber();
+  }
+
+  void testRandomNumberGenerator() {
+    JSBSim::RandomNumberGenerator generator(17);
+    JSBSim::RandomNumberGenerator same(17);
+    // Two generators with the same seed must deliver the same sequence
+    for (int i=0; i<100; i++) {
+      double x = generator.GetUniformRandomNumber();
+      TS_ASSERT(x >= -1.0 && x <= 1.0);
+      TS_ASSERT_EQUALS(x, same.GetUniformRandomNumber());
+      TS_ASSERT_EQUALS(generator.GetNormalRandomNumber(),
+                       same.GetNormalRandomNumber());
+    }
+    // Re-seeding restarts the sequence
+    generator.seed(17);
+    same.seed(17);
+    TS_ASSERT_EQUALS(generator.GetUniformRandomNumber(),
+                     same.GetUniformRandomNumber());
+  }
+
+  void testRandomNumberStreams() {
+    JSBSim::RandomNumberGenerator generator(17, 0);
+    JSBSim::RandomNumberGenerator stream1(17, 1);
+    JSBSim::RandomNumberGenerator seed18(18, 0);
+    std::vector<double> sequence;
+
+    for (int i=0; i<10; i++)
+      sequence.push_back(generator.GetUniformRandomNumber());
+    TS_ASSERT_EQUALS(generator.GetCounter(), 10);
+
+    // Other streams and seeds deliver other sequences
+    for (int i=0; i<10; i++) {
+      TS_ASSERT_DIFFERS(stream1.GetUniformRandomNumber(), sequence[i]);
+      TS_ASSERT_DIFFERS(seed18.GetUniformRandomNumber(), sequence[i]);
+    }
+
+    // Any draw can be reproduced without replaying the sequence
+    JSBSim::RandomNumberGenerator replay(17, 0);
+    replay.SetCounter(7);
+    TS_ASSERT_EQUALS(replay.GetUniformRandomNumber(), sequence[7]);
+    generator.seed(17, 0);
+    TS_ASSERT_EQUALS(generator.GetCounter(), 0);
+    TS_ASSERT_EQUALS(generator.GetUniformRandomNumber(), sequence[0]);
+
+    // Check the moments of the distributions
+    double sum = 0.0, sum2 = 0.0, usum = 0.0;
+    const int n = 100000;
+    for (int i=0; i<n; i++) {
+      double x = generator.GetNormalRandomNumber();
+      sum += x;
+      sum2 += x*x;
+      usum += generator.GetUniformRandomNumber();
+    }
+    TS_ASSERT_DELTA(sum/n, 0.0, 0.02);
+    TS_ASSERT_DELTA(sum2/n, 1.0, 0.02);
+    TS_ASSERT_DELTA(usum/n, 0.0, 0.01);
   }
 
   void testTemperatureConversion() {
@@ -117,9 +117,6 @@ class  FGLocationTest : public CxxTest::TestSuite
 {
 public:
   void testConstructors() {
-    TS_ASSERT_EQUALS(static_cast<JSBSim::FGGroundCallback*>(0),
-                     JSBSim::FGLocation::GetGroundCallback());
-
     JSBSim::FGLocation l0;
     TS_ASSERT_EQUALS(1.0, l0(1));
     TS_ASSERT_EQUALS(0.0, l0(2));
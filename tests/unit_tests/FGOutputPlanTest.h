@@ -0,0 +1,76 @@
+#include <string>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+#include <input_output/FGOutputPlan.h>
+
+using namespace JSBSim;
+
+class FGOutputPlanTest : public CxxTest::TestSuite
+{
+public:
+  void testValues() {
+    FGOutputPlan plan;
+    FGColumnVector3 v(1.0, 2.0, 3.0);
+    double x = 5.0;
+
+    plan.AddValue("x", [&x]{ return x; }, 18);
+    plan.AddVector({"a", "b", "c"}, v, 2.0);
+    TS_ASSERT_EQUALS(plan.GetColumns().size(), 4);
+    TS_ASSERT_EQUALS(plan.GetNumValues(), 4);
+    TS_ASSERT_EQUALS(plan.GetValueColumn(0).Precision, 18);
+    TS_ASSERT_EQUALS(plan.GetValueColumn(1).Precision, 16);
+
+    // The values are read when they are collected.
+    x = 6.0;
+    v(2) = -1.0;
+    FGOutputRecord record;
+    plan.Collect(record);
+    TS_ASSERT(record.values == std::vector<double>({6.0, 2.0, -2.0, 6.0}));
+    TS_ASSERT(record.texts.empty());
+
+    std::vector<std::string> names = {"x", "a", "b", "c"};
+    TS_ASSERT(plan.GetNames() == names);
+
+    plan.Clear();
+    TS_ASSERT(plan.GetColumns().empty());
+    TS_ASSERT_EQUALS(plan.GetNumValues(), 0);
+  }
+
+  void testTexts() {
+    FGOutputPlan plan;
+    std::string text = "1.5\t2.5\tfoo";
+
+    plan.AddValue("t", []{ return 0.5; });
+    std::vector<double> values = {1.5, 2.5, 3.5};
+    plan.AddText("u\t v \tw", [&text]{ return text; },
+                 [&values](std::vector<double>& v)
+                 { v.insert(v.end(), values.begin(), values.end()); }, "\t");
+    plan.AddText("", []{ return std::string(); }, [](std::vector<double>&){});
+    plan.AddValue("z", []{ return 3.0; });
+    TS_ASSERT_EQUALS(plan.GetNumValues(), 2);
+    TS_ASSERT_EQUALS(plan.GetValueColumn(1).Caption, "z");
+
+    FGOutputRecord record;
+    plan.Collect(record);
+    TS_ASSERT(record.values == std::vector<double>({0.5, 3.0}));
+    TS_ASSERT_EQUALS(record.texts.size(), 2);
+    TS_ASSERT_EQUALS(record.texts[0], text);
+    TS_ASSERT_EQUALS(record.positions[0], 1);
+
+    // The values of the text columns are collected as numbers.
+    record.Clear();
+    TS_ASSERT(plan.CollectValues(record));
+    TS_ASSERT(record.values == std::vector<double>({0.5, 1.5, 2.5, 3.5, 3.0}));
+
+    std::vector<std::string> names = {"t", "u", "v", "w", "z"};
+    TS_ASSERT(plan.GetNames() == names);
+
+    // The values must match the captions.
+    values.pop_back();
+    record.Clear();
+    TS_ASSERT(!plan.CollectValues(record));
+    values = {1.5, 2.5, 3.5, 4.5};
+    record.Clear();
+    TS_ASSERT(!plan.CollectValues(record));
+  }
+};
@@ -0,0 +1,172 @@
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+#include <input_output/FGOutputWriter.h>
+
+using namespace JSBSim;
+
+// Records the first value of each record emitted. The emission can be held
+// until Release() is called so that the ring buffer can be filled.
+class Emitter
+{
+public:
+  Emitter(bool held=false) : held(held), busy(false) {}
+
+  void operator()(const FGOutputRecord& record) {
+    std::unique_lock<std::mutex> lock(mutex);
+    busy = true;
+    condition.notify_all();
+    condition.wait(lock, [this]{ return !held; });
+    values.push_back(record.values[0]);
+  }
+
+  void WaitUntilBusy(void) {
+    std::unique_lock<std::mutex> lock(mutex);
+    condition.wait(lock, [this]{ return busy; });
+  }
+
+  void Release(void) {
+    std::lock_guard<std::mutex> lock(mutex);
+    held = false;
+    condition.notify_all();
+  }
+
+  std::vector<double> values;
+
+private:
+  bool held;
+  bool busy;
+  std::mutex mutex;
+  std::condition_variable condition;
+};
+
+class FGOutputWriterTest : public CxxTest::TestSuite
+{
+public:
+  void Push(FGOutputWriter& writer, double value) {
+    FGOutputRecord record;
+    record.values.push_back(value);
+    writer.Push(record);
+  }
+
+  void testRecord() {
+    FGOutputRecord record;
+
+    record.values.push_back(1.0);
+    record.AddText("a,b");
+    record.values.push_back(2.0);
+    record.AddText("c");
+    TS_ASSERT_EQUALS(record.texts.size(), 2);
+    TS_ASSERT_EQUALS(record.positions[0], 1);
+    TS_ASSERT_EQUALS(record.positions[1], 2);
+
+    record.Clear();
+    TS_ASSERT(record.values.empty());
+    TS_ASSERT(record.texts.empty());
+    TS_ASSERT(record.positions.empty());
+  }
+
+  void testOverflowPolicyNames() {
+    FGOutputWriter::eOverflow policy = FGOutputWriter::ofBlock;
+
+    TS_ASSERT(FGOutputWriter::GetOverflowPolicy("drop-oldest", policy));
+    TS_ASSERT_EQUALS(policy, FGOutputWriter::ofDropOldest);
+    TS_ASSERT(FGOutputWriter::GetOverflowPolicy("drop-newest", policy));
+    TS_ASSERT_EQUALS(policy, FGOutputWriter::ofDropNewest);
+    TS_ASSERT(FGOutputWriter::GetOverflowPolicy("block", policy));
+    TS_ASSERT_EQUALS(policy, FGOutputWriter::ofBlock);
+    TS_ASSERT(!FGOutputWriter::GetOverflowPolicy("wait", policy));
+    TS_ASSERT_EQUALS(policy, FGOutputWriter::ofBlock);
+  }
+
+  void testCapacity() {
+    Emitter emitter;
+    auto emit = [&emitter](const FGOutputRecord& r) { emitter(r); };
+
+    FGOutputWriter writer1(emit, 1, FGOutputWriter::ofBlock);
+    TS_ASSERT_EQUALS(writer1.GetCapacity(), 2);
+    FGOutputWriter writer2(emit, 100, FGOutputWriter::ofDropOldest);
+    TS_ASSERT_EQUALS(writer2.GetCapacity(), 128);
+    TS_ASSERT_EQUALS(writer2.GetOverflowPolicy(), FGOutputWriter::ofDropOldest);
+  }
+
+  void testBlock() {
+    Emitter emitter;
+    FGOutputWriter writer([&emitter](const FGOutputRecord& r) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        emitter(r);
+      }, 2, FGOutputWriter::ofBlock);
+
+    for (int i=0; i<50; i++)
+      Push(writer, i);
+    writer.Flush();
+
+    TS_ASSERT_EQUALS(writer.GetPendingRecords(), 0);
+    TS_ASSERT_EQUALS(writer.GetDroppedRecords(), 0);
+    TS_ASSERT_EQUALS(emitter.values.size(), 50);
+    for (unsigned int i=0; i<emitter.values.size(); i++)
+      TS_ASSERT_EQUALS(emitter.values[i], i);
+  }
+
+  void testDropNewest() {
+    Emitter emitter(true);
+    FGOutputWriter writer([&emitter](const FGOutputRecord& r) { emitter(r); },
+                          2, FGOutputWriter::ofDropNewest);
+
+    // The first record is held by the writer thread, the next 2 fill the ring
+    // buffer and the last 2 are discarded.
+    Push(writer, 0.0);
+    emitter.WaitUntilBusy();
+    for (int i=1; i<5; i++)
+      Push(writer, i);
+
+    TS_ASSERT_EQUALS(writer.GetDroppedRecords(), 2);
+    TS_ASSERT_EQUALS(writer.GetPendingRecords(), 3);
+
+    emitter.Release();
+    writer.Flush();
+
+    TS_ASSERT_EQUALS(writer.GetPendingRecords(), 0);
+    TS_ASSERT_EQUALS(emitter.values.size(), 3);
+    TS_ASSERT_EQUALS(emitter.values[0], 0.0);
+    TS_ASSERT_EQUALS(emitter.values[1], 1.0);
+    TS_ASSERT_EQUALS(emitter.values[2], 2.0);
+  }
+
+  void testDropOldest() {
+    Emitter emitter(true);
+    FGOutputWriter writer([&emitter](const FGOutputRecord& r) { emitter(r); },
+                          2, FGOutputWriter::ofDropOldest);
+
+    Push(writer, 0.0);
+    emitter.WaitUntilBusy();
+    for (int i=1; i<5; i++)
+      Push(writer, i);
+
+    TS_ASSERT_EQUALS(writer.GetDroppedRecords(), 2);
+    TS_ASSERT_EQUALS(writer.GetPendingRecords(), 3);
+
+    emitter.Release();
+    writer.Flush();
+
+    TS_ASSERT_EQUALS(emitter.values.size(), 3);
+    TS_ASSERT_EQUALS(emitter.values[0], 0.0);
+    TS_ASSERT_EQUALS(emitter.values[1], 3.0);
+    TS_ASSERT_EQUALS(emitter.values[2], 4.0);
+  }
+
+  void testDestructorEmitsPendingRecords() {
+    Emitter emitter(true);
+    {
+      FGOutputWriter writer([&emitter](const FGOutputRecord& r) { emitter(r); },
+                            16, FGOutputWriter::ofBlock);
+      for (int i=0; i<10; i++)
+        Push(writer, i);
+      emitter.Release();
+    }
+    TS_ASSERT_EQUALS(emitter.values.size(), 10);
+  }
+};
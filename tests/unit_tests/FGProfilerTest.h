@@ -0,0 +1,121 @@
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <cxxtest/TestSuite.h>
+#include <FGFDMExec.h>
+#include <FGProfiler.h>
+#include <input_output/FGXMLParse.h>
+#include <input_output/FGXMLElement.h>
+#include <models/FGFCS.h>
+
+using namespace JSBSim;
+
+class FGProfilerTest : public CxxTest::TestSuite
+{
+public:
+  void testStatistics() {
+    FGPropertyManager pm;
+    FGProfiler profiler(&pm);
+    unsigned int timer = profiler.AddTimer("test");
+
+    TS_ASSERT_EQUALS(profiler.AddTimer("test"), timer);
+    TS_ASSERT_EQUALS(profiler.GetNumTimers(), 1);
+    TS_ASSERT_EQUALS(profiler.GetTimerName(timer), "test");
+    TS_ASSERT(!profiler.GetEnabled());
+
+    // Samples of 1, 2, ..., 100 microseconds.
+    for (int i=1; i<=100; i++)
+      profiler.Record(timer, std::chrono::microseconds(i));
+
+    TS_ASSERT_EQUALS(profiler.GetCount(timer), 100);
+    TS_ASSERT_DELTA(profiler.GetLast(timer), 100.0, 1E-9);
+    TS_ASSERT_DELTA(profiler.GetMean(timer), 50.5, 1E-9);
+    TS_ASSERT_DELTA(profiler.GetP99(timer), 99.0, 1E-9);
+    TS_ASSERT_DELTA(pm.GetNode("profile/test/mean-us")->getDoubleValue(), 50.5,
+                    1E-9);
+    TS_ASSERT_DELTA(pm.GetNode("profile/test/p99-us")->getDoubleValue(), 99.0,
+                    1E-9);
+
+    // Only the last 1024 samples are kept in the window.
+    for (int i=0; i<1024; i++)
+      profiler.Record(timer, std::chrono::microseconds(10));
+
+    TS_ASSERT_EQUALS(profiler.GetCount(timer), 1124);
+    TS_ASSERT_DELTA(profiler.GetMean(timer), 10.0, 1E-9);
+    TS_ASSERT_DELTA(profiler.GetP99(timer), 10.0, 1E-9);
+
+    // Enabling the profiler clears the statistics.
+    pm.GetNode("profile/enabled")->setBoolValue(true);
+    TS_ASSERT(profiler.GetEnabled());
+    TS_ASSERT_EQUALS(profiler.GetCount(timer), 0);
+    TS_ASSERT_EQUALS(profiler.GetMean(timer), 0.0);
+    pm.Unbind();
+  }
+
+  void testSample() {
+    FGPropertyManager pm;
+    FGProfiler profiler(&pm);
+    unsigned int timer = profiler.AddTimer("test");
+
+    { FGProfiler::Sample sample(profiler, timer); }
+    TS_ASSERT_EQUALS(profiler.GetCount(timer), 0);
+
+    profiler.SetEnabled(true);
+    { FGProfiler::Sample sample(profiler, timer); }
+    TS_ASSERT_EQUALS(profiler.GetCount(timer), 1);
+    TS_ASSERT(profiler.GetLast(timer) >= 0.0);
+    pm.Unbind();
+  }
+
+  void testFrame() {
+    FGFDMExec fdmex;
+    fdmex.SetRootDir(SGPath(JSBSIM_TEST_ROOT_DIR));
+    fdmex.SetAircraftPath(SGPath("aircraft"));
+    fdmex.SetEnginePath(SGPath("engine"));
+    fdmex.SetSystemsPath(SGPath("systems"));
+    fdmex.SetDebugLevel(0);
+    TS_ASSERT(fdmex.LoadModel("c172x"));
+    fdmex.RunIC();
+
+    FGProfiler& profiler = fdmex.GetProfiler();
+    fdmex.SetProfiling(true);
+    for (int i=0; i<10; i++) fdmex.Run();
+
+    unsigned int frame = profiler.AddTimer("frame");
+    unsigned int aero = profiler.AddTimer("models/aerodynamics");
+    unsigned int engine = profiler.AddTimer("propulsion/engine[0]");
+    TS_ASSERT_EQUALS(profiler.GetCount(frame), 10);
+    TS_ASSERT_EQUALS(profiler.GetCount(aero), 10);
+    TS_ASSERT_EQUALS(profiler.GetCount(engine), 10);
+    TS_ASSERT(profiler.GetMean(aero) <= profiler.GetMean(frame));
+    TS_ASSERT(fdmex.GetPropertyValue("profile/frame/mean-us") > 0.0);
+    TS_ASSERT(fdmex.GetPropertyManager()->HasNode("profile/fcs/pitch/p99-us"));
+
+    std::ostringstream summary;
+    profiler.PrintSummary(summary);
+    TS_ASSERT(summary.str().find("models/ground-reactions") != std::string::npos);
+  }
+
+  // The names "Pitch Trim" and "pitch/trim" are both turned into pitch-trim:
+  // their channels must be timed separately.
+  void testChannelNames() {
+    FGFDMExec fdmex;
+    fdmex.SetDebugLevel(0);
+    std::istringstream XML("<system name=\"test\">"
+                           "  <channel name=\"Pitch Trim\"/>"
+                           "  <channel name=\"pitch/trim\"/>"
+                           "  <channel name=\"3rd\"/>"
+                           "</system>");
+    FGXMLParse parser;
+    readXML(XML, parser);
+    Element_ptr el = parser.GetDocument();
+    TS_ASSERT(fdmex.GetFCS()->Load(el));
+
+    FGProfiler& profiler = fdmex.GetProfiler();
+    size_t count = profiler.GetNumTimers();
+    TS_ASSERT_EQUALS(profiler.AddTimer("fcs/pitch-trim"), count-3);
+    TS_ASSERT_EQUALS(profiler.AddTimer("fcs/pitch-trim[1]"), count-2);
+    TS_ASSERT_EQUALS(profiler.AddTimer("fcs/_3rd"), count-1);
+    TS_ASSERT_EQUALS(profiler.GetNumTimers(), count);
+  }
+};
@@ -0,0 +1,182 @@
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+#include <input_output/FGPropertyManager.h>
+#include <math/FGPropertyValue.h>
+
+using namespace JSBSim;
+
+class FGPropertyManagerTest : public CxxTest::TestSuite
+{
+public:
+  void testHandles() {
+    FGPropertyManager pm;
+    double x = 1.0;
+    pm.Tie("fcs/x", &x);
+    pm.GetNode("fcs/y", true)->setDoubleValue(2.0);
+
+    int hx = pm.GetHandle("fcs/x");
+    int hy = pm.GetHandle("fcs/y");
+    TS_ASSERT_EQUALS(hx, 0);
+    TS_ASSERT_EQUALS(hy, 1);
+    TS_ASSERT_EQUALS(pm.GetNumHandles(), 2);
+    TS_ASSERT_EQUALS(pm.GetHandleNode(hx), pm.GetNode("fcs/x"));
+
+    // The same node always gets the same handle.
+    TS_ASSERT_EQUALS(pm.GetHandle("fcs/x"), hx);
+    TS_ASSERT_EQUALS(pm.GetHandle("fcs/x[0]"), hx);
+    TS_ASSERT_EQUALS(pm.GetHandle("/fcs/y"), hy);
+    TS_ASSERT_EQUALS(pm.GetNumHandles(), 2);
+
+    // The values are read and written through the tied variable.
+    TS_ASSERT_EQUALS(pm.GetValue(hx), 1.0);
+    pm.SetValue(hx, -3.0);
+    TS_ASSERT_EQUALS(x, -3.0);
+    x = 4.0;
+    TS_ASSERT_EQUALS(pm.GetValue(hx), 4.0);
+    pm.Untie("fcs/x");
+  }
+
+  void testMissingProperty() {
+    FGPropertyManager pm;
+    TS_ASSERT_EQUALS(pm.GetHandle("fcs/z"), -1);
+    TS_ASSERT_EQUALS(pm.GetNumHandles(), 0);
+
+    int hz = pm.GetHandle("fcs/z", true);
+    TS_ASSERT_EQUALS(hz, 0);
+    TS_ASSERT(pm.HasNode("fcs/z"));
+    TS_ASSERT_EQUALS(pm.GetHandle("fcs/z"), hz);
+  }
+
+  void testBulkAccess() {
+    FGPropertyManager pm;
+    std::vector<int> handles = {pm.GetHandle("a", true),
+                                pm.GetHandle("b", true),
+                                pm.GetHandle("c", true)};
+    std::vector<double> values = {1.0, 2.0, 3.0};
+    pm.SetValues(handles, values);
+
+    std::vector<double> result;
+    pm.GetValues({handles[2], handles[0]}, result);
+    TS_ASSERT(result == std::vector<double>({3.0, 1.0}));
+
+    // No value is modified when a handle is not valid.
+    TS_ASSERT_THROWS(pm.SetValues({handles[0], 3}, {5.0, 6.0}), std::string);
+    TS_ASSERT_EQUALS(pm.GetValue(handles[0]), 1.0);
+    TS_ASSERT_THROWS(pm.SetValues(handles, {5.0}), std::string);
+    TS_ASSERT_THROWS(pm.GetValues({-1}, result), std::string);
+  }
+
+  void testManyChildren() {
+    // Enough children for the nodes to be looked up through their index.
+    FGPropertyManager pm;
+    for (int i=0; i<40; i++) {
+      pm.GetNode("engine", i, true)->setIntValue(i);
+      pm.GetNode("aero/c" + std::to_string(i), true)->setIntValue(i);
+    }
+
+    FGPropertyNode* root = pm.GetNode();
+    FGPropertyNode* aero = pm.GetNode("aero");
+    TS_ASSERT_EQUALS(root->nChildren(), 41);
+    TS_ASSERT_EQUALS(root->getChild("engine", 27)->getIntValue(), 27);
+    TS_ASSERT_EQUALS(pm.GetNode("engine[33]")->getIntValue(), 33);
+    TS_ASSERT_EQUALS(pm.GetNode("aero/c12")->getIntValue(), 12);
+    TS_ASSERT(!root->getChild("engine", 40));
+    TS_ASSERT(!aero->getChild("c", 12));
+
+    // The index follows the children that are added and removed.
+    TS_ASSERT(aero->removeChild("c12", 0));
+    TS_ASSERT(!pm.HasNode("aero/c12"));
+    TS_ASSERT_EQUALS(pm.GetNode("aero/c13")->getIntValue(), 13);
+    TS_ASSERT(root->removeChild(root->getChild("engine", 5)));
+    TS_ASSERT(!root->getChild("engine", 5));
+    pm.GetNode("engine[5]", true)->setIntValue(-5);
+    TS_ASSERT_EQUALS(root->getChild("engine", 5)->getIntValue(), -5);
+    TS_ASSERT_EQUALS(root->addChild("engine")->getIndex(), 40);
+    TS_ASSERT(root->getChild("engine", 40));
+
+    aero->removeAllChildren();
+    TS_ASSERT(!aero->getChild("c1", 0));
+    aero->getChild("c1", 0, true);
+    TS_ASSERT(pm.HasNode("aero/c1"));
+  }
+
+  void testTiedDoubleValue() {
+    FGPropertyManager pm;
+    double x = 1.0;
+    int i = 2;
+    pm.Tie("fcs/x", &x);
+    pm.Tie("fcs/i", &i);
+    pm.GetNode("fcs/y", true)->setDoubleValue(3.0);
+
+    TS_ASSERT_EQUALS(pm.GetNode("fcs/x")->getTiedDoublePointer(), &x);
+    TS_ASSERT(!pm.GetNode("fcs/i")->getTiedDoublePointer());
+    TS_ASSERT(!pm.GetNode("fcs/y")->getTiedDoublePointer());
+
+    FGPropertyValue_ptr vx = new FGPropertyValue("-fcs/x", &pm);
+    FGPropertyValue_ptr vi = new FGPropertyValue("fcs/i", &pm);
+    TS_ASSERT_EQUALS(vx->GetValue(), -1.0);
+    TS_ASSERT_EQUALS(vi->GetValue(), 2.0);
+    x = 4.0;
+    i = 5;
+    TS_ASSERT_EQUALS(vx->GetValue(), -4.0);
+    TS_ASSERT_EQUALS(vi->GetValue(), 5.0);
+
+    vx->SetNode(pm.GetNode("fcs/y"));
+    TS_ASSERT_EQUALS(vx->GetValue(), -3.0);
+
+    pm.Untie("fcs/x");
+    TS_ASSERT(!pm.GetNode("fcs/x")->getTiedDoublePointer());
+    pm.Untie("fcs/i");
+  }
+
+  void testJournal() {
+    FGPropertyManager pm;
+    double x = 1.0, y = 2.0;
+    pm.Tie("fcs/x", &x);
+    pm.Tie("fcs/y", &y);
+    int hx = pm.GetHandle("fcs/x");
+    int hy = pm.GetHandle("fcs/y");
+    int hz = pm.GetHandle("fcs/z", true);
+
+    pm.Watch(hy);
+    pm.Watch(hx);
+    pm.Watch(hx);
+    TS_ASSERT_EQUALS(pm.GetNumWatched(), 2);
+    TS_ASSERT_THROWS(pm.Watch(hz+1), std::string);
+
+    // The changes of the tied variables are detected.
+    x = 3.0;
+    y = 4.0;
+    pm.UpdateJournal();
+    TS_ASSERT(pm.GetChanges() == std::vector<int>({hx, hy}));
+    TS_ASSERT(pm.HasChanged(hx));
+    TS_ASSERT_EQUALS(pm.GetJournalFrame(), 1);
+
+    // Only the changes since the previous update are reported.
+    y = 5.0;
+    pm.SetValue(hz, 1.0);
+    pm.UpdateJournal();
+    TS_ASSERT(pm.GetChanges() == std::vector<int>({hy}));
+    TS_ASSERT(!pm.HasChanged(hx));
+    TS_ASSERT(!pm.HasChanged(hz));
+
+    // A value that is set back to its previous value did not change.
+    x = 0.0;
+    x = 3.0;
+    y = NAN;
+    pm.UpdateJournal();
+    TS_ASSERT(pm.GetChanges() == std::vector<int>({hy}));
+    pm.UpdateJournal();
+    TS_ASSERT(pm.GetChanges().empty());
+
+    y = 6.0;
+    pm.UpdateJournal();
+    pm.Unwatch(hy);
+    TS_ASSERT(!pm.HasChanged(hy));
+    TS_ASSERT(pm.GetChanges().empty());
+    TS_ASSERT_EQUALS(pm.GetNumWatched(), 1);
+    pm.Unbind();
+  }
+};
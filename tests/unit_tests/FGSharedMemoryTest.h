@@ -0,0 +1,128 @@
+#include <string>
+#include <sstream>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+#include <FGFDMExec.h>
+#include <models/FGInput.h>
+#include <models/FGOutput.h>
+#include <input_output/FGSharedMemory.h>
+#include <input_output/FGXMLParse.h>
+#include <input_output/FGXMLElement.h>
+
+using namespace JSBSim;
+
+// Parses an XML string and returns its root element.
+static Element_ptr ReadXML(const std::string& XML)
+{
+  std::istringstream data(XML);
+  FGXMLParse parser;
+  readXML(data, parser);
+  return parser.GetDocument();
+}
+
+class FGSharedMemoryTest : public CxxTest::TestSuite
+{
+public:
+  void testCreateAndAttach() {
+    std::vector<std::string> names = {"x", "velocities/vc-kts", "y"};
+    FGSharedMemory writer, reader;
+    double values[3] = {1.0, 2.0, 3.0};
+    double read[3];
+    uint64_t sequence;
+
+    TS_ASSERT(writer.Create("jsbsim-unit-test", names));
+    TS_ASSERT(writer.IsOpen());
+    TS_ASSERT_EQUALS(writer.GetNumValues(), 3);
+    TS_ASSERT_EQUALS(writer.GetSequence(), 0);
+
+    TS_ASSERT(reader.Attach("jsbsim-unit-test"));
+    TS_ASSERT_EQUALS(reader.GetNumValues(), 3);
+    TS_ASSERT(reader.GetNames() == names);
+
+    // Nothing can be read before the first frame is written.
+    TS_ASSERT(!reader.Read(read, sequence));
+
+    writer.Write(values);
+    TS_ASSERT(reader.Read(read, sequence));
+    TS_ASSERT_EQUALS(sequence, 2);
+    TS_ASSERT_EQUALS(read[0], 1.0);
+    TS_ASSERT_EQUALS(read[1], 2.0);
+    TS_ASSERT_EQUALS(read[2], 3.0);
+
+    values[1] = -5.0;
+    writer.Write(values);
+    TS_ASSERT_EQUALS(reader.GetSequence(), 4);
+    TS_ASSERT(reader.Read(read, sequence));
+    TS_ASSERT_EQUALS(sequence, 4);
+    TS_ASSERT_EQUALS(read[1], -5.0);
+
+    // The segment is removed when its creator closes it.
+    writer.Close();
+    TS_ASSERT(!writer.IsOpen());
+    FGSharedMemory other;
+    TS_ASSERT(!other.Attach("jsbsim-unit-test"));
+  }
+
+  void testEmptySegment() {
+    FGSharedMemory writer, reader;
+
+    TS_ASSERT(writer.Create("jsbsim-unit-test", std::vector<std::string>()));
+    TS_ASSERT(reader.Attach("jsbsim-unit-test"));
+    TS_ASSERT_EQUALS(reader.GetNumValues(), 0);
+    TS_ASSERT(reader.GetNames().empty());
+  }
+
+  void testOutputAndInput() {
+    FGFDMExec fdmex;
+    fdmex.SetRootDir(SGPath(JSBSIM_TEST_ROOT_DIR));
+    fdmex.SetAircraftPath(SGPath("aircraft"));
+    fdmex.SetEnginePath(SGPath("engine"));
+    fdmex.SetSystemsPath(SGPath("systems"));
+    fdmex.SetDebugLevel(0);
+    TS_ASSERT(fdmex.LoadModel("c172x"));
+
+    Element_ptr output = ReadXML("<output name=\"jsbsim-unit-test-out\""
+                                 " type=\"SHARED_MEMORY\" rate=\"120\">"
+                                 "<property>position/h-sl-ft</property>"
+                                 "<property caption=\"vc\">"
+                                 "velocities/vc-kts</property></output>");
+    TS_ASSERT(fdmex.GetOutput()->Load(output, SGPath()));
+    Element_ptr input = ReadXML("<input name=\"jsbsim-unit-test-in\""
+                                " type=\"SHARED_MEMORY\">"
+                                "<property>fcs/elevator-cmd-norm</property>"
+                                "</input>");
+    TS_ASSERT(fdmex.GetInput()->Load(input));
+
+    fdmex.RunIC();
+    fdmex.Run();
+
+    FGSharedMemory state;
+    double values[3];
+    uint64_t sequence;
+    TS_ASSERT(state.Attach("jsbsim-unit-test-out"));
+    TS_ASSERT_EQUALS(state.GetNumValues(), 3);
+    TS_ASSERT_EQUALS(state.GetNames()[0], "Time");
+    TS_ASSERT_EQUALS(state.GetNames()[1], "/fdm/jsbsim/position/h-sl-ft");
+    TS_ASSERT_EQUALS(state.GetNames()[2], "vc");
+    TS_ASSERT(state.Read(values, sequence));
+    TS_ASSERT_EQUALS(values[0], fdmex.GetSimTime());
+    TS_ASSERT_EQUALS(values[1], fdmex.GetPropertyValue("position/h-sl-ft"));
+    TS_ASSERT_EQUALS(values[2], fdmex.GetPropertyValue("velocities/vc-kts"));
+
+    FGSharedMemory controls;
+    TS_ASSERT(controls.Attach("jsbsim-unit-test-in"));
+    TS_ASSERT_EQUALS(controls.GetNames()[0],
+                     "/fdm/jsbsim/fcs/elevator-cmd-norm");
+    double elevator = 0.25;
+    controls.Write(&elevator);
+    fdmex.Run();
+    TS_ASSERT_EQUALS(fdmex.GetPropertyValue("fcs/elevator-cmd-norm"), 0.25);
+    TS_ASSERT_EQUALS(fdmex.GetPropertyValue("simulation/input[0]/frames"), 1);
+
+    // The properties are not overwritten when no new frame is published.
+    fdmex.SetPropertyValue("fcs/elevator-cmd-norm", 0.0);
+    fdmex.Run();
+    TS_ASSERT_EQUALS(fdmex.GetPropertyValue("fcs/elevator-cmd-norm"), 0.0);
+    TS_ASSERT_EQUALS(fdmex.GetPropertyValue("simulation/input[0]/frames"), 1);
+  }
+};
@@ -0,0 +1,109 @@
+#include <string>
+#include <cxxtest/TestSuite.h>
+#include <input_output/FGSocketMessage.h>
+
+using namespace JSBSim;
+
+class FGSocketMessageTest : public CxxTest::TestSuite
+{
+public:
+  void testRoundTrip() {
+    FGSocketMessageWriter writer;
+    writer.Start(FGSocketMessage::mtSet);
+    writer.PutShort(3);
+    writer.PutInt(7);
+    writer.PutValue(FGSocketMessage::vtDouble, 0.1);
+    writer.PutInt(8);
+    writer.PutValue(FGSocketMessage::vtInt, -3.7);
+    writer.PutInt(9);
+    writer.PutValue(FGSocketMessage::vtBool, 2.0);
+    std::string stream = writer.Finish();
+
+    // Little-endian length of the type and the content.
+    TS_ASSERT_EQUALS(stream.size(), 4+1+2+3*4+9+5+2);
+    TS_ASSERT_EQUALS(stream[0], char(stream.size()-4));
+    TS_ASSERT_EQUALS(stream[1], '\0');
+
+    writer.Start(FGSocketMessage::mtRegister);
+    writer.PutString("fcs/elevator-cmd-norm");
+    writer.PutDouble(-1.5);
+    stream += writer.Finish();
+
+    FGSocketMessageReader reader;
+    FGSocketMessage::ValueType type;
+    size_t pos = 0;
+
+    TS_ASSERT(reader.Next(stream, pos));
+    TS_ASSERT_EQUALS(reader.GetType(), FGSocketMessage::mtSet);
+    TS_ASSERT_EQUALS(reader.GetShort(), 3);
+    TS_ASSERT_EQUALS(reader.GetInt(), 7);
+    TS_ASSERT_EQUALS(reader.GetValue(type), 0.1);
+    TS_ASSERT_EQUALS(type, FGSocketMessage::vtDouble);
+    TS_ASSERT_EQUALS(reader.GetInt(), 8);
+    TS_ASSERT_EQUALS(reader.GetValue(type), -3.0);
+    TS_ASSERT_EQUALS(type, FGSocketMessage::vtInt);
+    TS_ASSERT_EQUALS(reader.GetInt(), 9);
+    TS_ASSERT_EQUALS(reader.GetValue(type), 1.0);
+    TS_ASSERT_EQUALS(type, FGSocketMessage::vtBool);
+    TS_ASSERT(!reader.HasFailed());
+
+    TS_ASSERT(reader.Next(stream, pos));
+    TS_ASSERT_EQUALS(reader.GetType(), FGSocketMessage::mtRegister);
+    TS_ASSERT_EQUALS(reader.GetString(), "fcs/elevator-cmd-norm");
+    TS_ASSERT_EQUALS(reader.GetDouble(), -1.5);
+    TS_ASSERT(!reader.HasFailed());
+
+    TS_ASSERT_EQUALS(pos, stream.size());
+    TS_ASSERT(!reader.Next(stream, pos));
+    TS_ASSERT(!reader.IsInvalid());
+  }
+
+  void testIncompleteMessage() {
+    FGSocketMessageWriter writer;
+    writer.Start(FGSocketMessage::mtIterate);
+    writer.PutInt(10);
+    std::string message = writer.Finish();
+
+    // The message is only read when all its bytes have been received.
+    FGSocketMessageReader reader;
+    for (size_t size=0; size<message.size(); ++size) {
+      size_t pos = 0;
+      TS_ASSERT(!reader.Next(message.substr(0, size), pos));
+      TS_ASSERT_EQUALS(pos, 0);
+      TS_ASSERT(!reader.IsInvalid());
+    }
+
+    size_t pos = 0;
+    TS_ASSERT(reader.Next(message, pos));
+    TS_ASSERT_EQUALS(reader.GetInt(), 10);
+  }
+
+  void testTruncatedContent() {
+    FGSocketMessageWriter writer;
+    writer.Start(FGSocketMessage::mtGet);
+    writer.PutShort(2);
+    writer.PutInt(1);
+    std::string stream = writer.Finish();
+
+    FGSocketMessageReader reader;
+    size_t pos = 0;
+    TS_ASSERT(reader.Next(stream, pos));
+    TS_ASSERT_EQUALS(reader.GetShort(), 2);
+    TS_ASSERT_EQUALS(reader.GetInt(), 1);
+    TS_ASSERT(!reader.HasFailed());
+    TS_ASSERT_EQUALS(reader.GetInt(), 0);
+    TS_ASSERT(reader.HasFailed());
+  }
+
+  void testInvalidLength() {
+    std::string stream("\xff\xff\xff\xff\x01", 5);
+    FGSocketMessageReader reader;
+    size_t pos = 0;
+    TS_ASSERT(!reader.Next(stream, pos));
+    TS_ASSERT(reader.IsInvalid());
+
+    stream.assign(5, '\0');
+    TS_ASSERT(!reader.Next(stream, pos));
+    TS_ASSERT(reader.IsInvalid());
+  }
+};
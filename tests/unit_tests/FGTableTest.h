@@ -0,0 +1,174 @@
+#include <limits>
+#include <sstream>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+#include <math/FGTable.h>
+#include <input_output/FGXMLParse.h>
+#include <input_output/FGXMLElement.h>
+
+using namespace JSBSim;
+
+const double epsilon = 100. * std::numeric_limits<double>::epsilon();
+
+class FGTableTest : public CxxTest::TestSuite
+{
+public:
+  // y = x*x sampled at x = -10, -9, ..., 10
+  static void Fill1D(FGTable& t) {
+    for (int i=-10; i<=10; i++)
+      t << static_cast<double>(i) << static_cast<double>(i*i);
+  }
+
+  // Linear interpolation of y = x*x between the integers.
+  static double Expected1D(double x) {
+    if (x <= -10.0) return 100.0;
+    if (x >= 10.0) return 100.0;
+    double x0 = floor(x);
+    return x0*x0 + (x-x0)*(2.0*x0+1.0);
+  }
+
+  void test1DLookup() {
+    FGTable t(21);
+    Fill1D(t);
+
+    // Keys that are close to each other (warm lookups) and far apart (cold
+    // lookups), off the table and on the breakpoints.
+    const double keys[] = {0.5, 0.7, 1.2, 2.9, -7.3, 9.99, -9.5, 3.0, -3.0,
+                           -15.0, 15.0, 10.0, -10.0, 4.25, 4.0, 5.0, -0.1};
+    for (double x: keys)
+      TS_ASSERT_DELTA(t.GetValue(x), Expected1D(x), epsilon*100.0);
+  }
+
+  void testGetValues() {
+    FGTable t(21);
+    Fill1D(t);
+    FGTable ref(t);
+
+    std::vector<double> keys;
+    for (int i=0; i<300; i++)
+      keys.push_back(-12.0 + 0.08*i);      // Sorted keys
+    for (int i=0; i<200; i++)
+      keys.push_back(fmod(i*7.31, 24.0) - 12.0); // Scattered keys
+    keys.push_back(-10.0);
+    keys.push_back(10.0);
+    keys.push_back(2.0);
+
+    std::vector<double> values(keys.size());
+    t.GetValues(keys.data(), values.data(), keys.size());
+
+    for (unsigned int i=0; i<keys.size(); i++)
+      TS_ASSERT_EQUALS(values[i], ref.GetValue(keys[i]));
+
+    // The tables must have ended on the same interval.
+    TS_ASSERT_EQUALS(t.GetValue(3.5), ref.GetValue(3.5));
+  }
+
+  // z = 2*row + 3*col
+  static void Fill2D(FGTable& t) {
+    t << 0.0 << 1.0 << 2.0;
+    for (int r=0; r<4; r++) {
+      t << 10.0*r;
+      for (int c=0; c<3; c++)
+        t << 2.0*10.0*r + 3.0*c;
+    }
+  }
+
+  static Element_ptr Read3D(void) {
+    std::istringstream data("<table>"
+                            "<independentVar lookup=\"row\">x</independentVar>"
+                            "<independentVar lookup=\"column\">y</independentVar>"
+                            "<independentVar lookup=\"table\">z</independentVar>"
+                            "<tableData breakPoint=\"0\"> 0 1\n0 0 1\n1 2 3"
+                            "</tableData>"
+                            "<tableData breakPoint=\"10\"> 0 1\n0 10 11\n1 12 13"
+                            "</tableData>"
+                            "<tableData breakPoint=\"20\"> 0 1\n0 20 21\n1 22 23"
+                            "</tableData></table>");
+    FGXMLParse parser;
+    readXML(data, parser);
+    return parser.GetDocument();
+  }
+
+  void test2DLookup() {
+    FGTable t(4, 3);
+    Fill2D(t);
+
+    TS_ASSERT_EQUALS(t.GetNumRows(), 4);
+    TS_ASSERT_EQUALS(t(2,0), 10.0);
+    TS_ASSERT_EQUALS(t(0,3), 2.0);
+    TS_ASSERT_EQUALS(t(3,2), 43.0);
+
+    const double rows[] = {5.0, 25.0, 0.0, 30.0, 12.5, -5.0, 40.0};
+    const double cols[] = {0.5, 1.5, 0.0, 2.0, 0.25, -1.0, 3.0};
+    for (double r: rows) {
+      for (double c: cols) {
+        double rc = r < 0.0 ? 0.0 : (r > 30.0 ? 30.0 : r);
+        double cc = c < 0.0 ? 0.0 : (c > 2.0 ? 2.0 : c);
+        TS_ASSERT_DELTA(t.GetValue(r, c), 2.0*rc + 3.0*cc, epsilon*100.0);
+      }
+    }
+  }
+
+  void test3DLookup() {
+    FGPropertyManager pm;
+    pm.GetNode("x", true);
+    pm.GetNode("y", true);
+    pm.GetNode("z", true);
+
+    FGTable t(&pm, Read3D());
+
+    const double keys[] = {0.0, 5.0, 20.0, 12.5, -3.0, 25.0, 10.0, 0.5};
+    for (double z: keys) {
+      double zc = z < 0.0 ? 0.0 : (z > 20.0 ? 20.0 : z);
+      TS_ASSERT_DELTA(t.GetValue(0.5, 0.5, z), zc + 1.5, epsilon*100.0);
+      pm.GetNode("x")->setDoubleValue(1.0);
+      pm.GetNode("y")->setDoubleValue(0.0);
+      pm.GetNode("z")->setDoubleValue(z);
+      TS_ASSERT_DELTA(t.GetValue(), zc + 2.0, epsilon*100.0);
+    }
+  }
+
+  void testGetValues2D() {
+    FGTable t(4, 3), ref(4, 3);
+    Fill2D(t);
+    Fill2D(ref);
+
+    std::vector<double> rows, cols;
+    for (int i=0; i<150; i++) {
+      rows.push_back(fmod(i*3.7, 40.0) - 5.0);
+      cols.push_back(0.02*i - 0.5);
+    }
+    rows.push_back(10.0);
+    cols.push_back(1.0);
+
+    std::vector<double> values(rows.size());
+    t.GetValues(rows.data(), cols.data(), values.data(), rows.size());
+
+    for (unsigned int i=0; i<rows.size(); i++)
+      TS_ASSERT_EQUALS(values[i], ref.GetValue(rows[i], cols[i]));
+  }
+
+  void testGetValues3D() {
+    FGPropertyManager pm;
+    pm.GetNode("x", true);
+    pm.GetNode("y", true);
+    pm.GetNode("z", true);
+    Element_ptr el = Read3D();
+    FGTable t(&pm, el), ref(&pm, el);
+
+    std::vector<double> rows, cols, tables;
+    for (int i=0; i<100; i++) {
+      rows.push_back(0.013*i - 0.2);
+      cols.push_back(fmod(i*0.37, 1.4) - 0.2);
+      tables.push_back(fmod(i*4.3, 26.0) - 3.0);
+    }
+    tables[10] = 10.0;
+
+    std::vector<double> values(rows.size());
+    t.GetValues(rows.data(), cols.data(), tables.data(), values.data(),
+                rows.size());
+
+    for (unsigned int i=0; i<rows.size(); i++)
+      TS_ASSERT_EQUALS(values[i], ref.GetValue(rows[i], cols[i], tables[i]));
+  }
+};
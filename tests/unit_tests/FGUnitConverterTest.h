@@ -0,0 +1,119 @@
+#include <cmath>
+#include <string>
+#include <cxxtest/TestSuite.h>
+#include <input_output/FGUnitConverter.h>
+#include <input_output/FGXMLElement.h>
+
+using namespace JSBSim;
+
+class FGUnitConverterTest : public CxxTest::TestSuite
+{
+public:
+  void testParse() {
+    TS_ASSERT_EQUALS(FGUnitConverter::GetUnit("ATM"), FGUnitConverter::uATM);
+    TS_ASSERT_EQUALS(FGUnitConverter::GetUnit("FT"), FGUnitConverter::uFT);
+    TS_ASSERT_EQUALS(FGUnitConverter::GetUnit("FT*LBS"),
+                     FGUnitConverter::uFTxLBS);
+    TS_ASSERT_EQUALS(FGUnitConverter::GetUnit("FT4*SEC/SLUG"),
+                     FGUnitConverter::uFT4xSEC_SLUG);
+    TS_ASSERT_EQUALS(FGUnitConverter::GetUnit("LBS/FT2/SEC2"),
+                     FGUnitConverter::uLBS_FT2_SEC2);
+    TS_ASSERT_EQUALS(FGUnitConverter::GetUnit("WATTS"), FGUnitConverter::uWATTS);
+
+    for (int i=0; i<FGUnitConverter::NumUnits; i++) {
+      FGUnitConverter::Unit unit = static_cast<FGUnitConverter::Unit>(i);
+      TS_ASSERT_EQUALS(FGUnitConverter::GetUnit(FGUnitConverter::GetName(unit)),
+                       unit);
+      TS_ASSERT(FGUnitConverter::GetDimensions(unit) != 0);
+    }
+
+    // The names are case sensitive and must match exactly.
+    TS_ASSERT_EQUALS(FGUnitConverter::GetUnit(""), FGUnitConverter::uUnknown);
+    TS_ASSERT_EQUALS(FGUnitConverter::GetUnit("ft"), FGUnitConverter::uUnknown);
+    TS_ASSERT_EQUALS(FGUnitConverter::GetUnit("F"), FGUnitConverter::uUnknown);
+    TS_ASSERT_EQUALS(FGUnitConverter::GetUnit("FT "), FGUnitConverter::uUnknown);
+    TS_ASSERT_EQUALS(FGUnitConverter::GetUnit(std::string("FT\0X", 4)),
+                     FGUnitConverter::uUnknown);
+    TS_ASSERT_EQUALS(FGUnitConverter::GetUnit("LBS/FT2/SEC2/SEC2/M"),
+                     FGUnitConverter::uUnknown);
+    TS_ASSERT_EQUALS(FGUnitConverter::GetName(FGUnitConverter::uUnknown),
+                     std::string());
+  }
+
+  void testFactors() {
+    double factor = 0.0;
+    TS_ASSERT(FGUnitConverter::GetFactor(FGUnitConverter::uM,
+                                         FGUnitConverter::uFT, factor));
+    TS_ASSERT_EQUALS(factor, 3.2808399);
+    TS_ASSERT(FGUnitConverter::GetFactor(FGUnitConverter::uFT,
+                                         FGUnitConverter::uM, factor));
+    TS_ASSERT_EQUALS(factor, 1.0/3.2808399);
+    TS_ASSERT(FGUnitConverter::GetFactor(FGUnitConverter::uRAD,
+                                         FGUnitConverter::uDEG, factor));
+    TS_ASSERT_EQUALS(factor, 180.0/M_PI);
+    TS_ASSERT(FGUnitConverter::GetFactor(FGUnitConverter::uLBS,
+                                         FGUnitConverter::uN, factor));
+    TS_ASSERT_EQUALS(factor, 1.0/0.22482);
+
+    // Any unit converts into itself.
+    TS_ASSERT(FGUnitConverter::GetFactor(FGUnitConverter::uCM,
+                                         FGUnitConverter::uCM, factor));
+    TS_ASSERT_EQUALS(factor, 1.0);
+
+    // Not all the units of a dimension convert into each other.
+    TS_ASSERT(!FGUnitConverter::GetFactor(FGUnitConverter::uCM,
+                                          FGUnitConverter::uM, factor));
+    TS_ASSERT(!FGUnitConverter::GetFactor(FGUnitConverter::uKG,
+                                          FGUnitConverter::uFT, factor));
+    TS_ASSERT(!FGUnitConverter::GetFactor(FGUnitConverter::uFT,
+                                          FGUnitConverter::uUnknown, factor));
+    TS_ASSERT(!FGUnitConverter::GetFactor(FGUnitConverter::uUnknown,
+                                          FGUnitConverter::uUnknown, factor));
+  }
+
+  void testDimensions() {
+    TS_ASSERT_EQUALS(FGUnitConverter::GetDimensions(FGUnitConverter::uLBS),
+                     FGUnitConverter::dmMass | FGUnitConverter::dmForce);
+    TS_ASSERT_EQUALS(FGUnitConverter::GetDimensions(FGUnitConverter::uPA),
+                     FGUnitConverter::dmPressure);
+    TS_ASSERT_EQUALS(FGUnitConverter::GetDimensions(FGUnitConverter::uUnknown),
+                     0u);
+    TS_ASSERT_EQUALS(FGUnitConverter::GetDimensionNames(
+                       FGUnitConverter::GetDimensions(FGUnitConverter::uLBS)),
+                     "mass or force");
+    TS_ASSERT_EQUALS(FGUnitConverter::GetDimensionNames(
+                       FGUnitConverter::dmMomentOfInertia),
+                     "moment of inertia");
+  }
+
+  void testElement() {
+    Element_ptr root = new Element("root");
+    Element* length = new Element("length");
+    length->AddAttribute("unit", "IN");
+    length->AddData("24");
+    length->SetParent(root);
+    root->AddChildElement(length);
+    Element* location = new Element("location");
+    location->AddAttribute("unit", "M");
+    location->SetParent(root);
+    root->AddChildElement(location);
+    const char* axes[] = {"x", "y", "z"};
+    for (auto axis: axes) {
+      Element* item = new Element(axis);
+      item->AddData("2");
+      item->SetParent(location);
+      location->AddChildElement(item);
+    }
+
+    TS_ASSERT_EQUALS(root->FindElementValueAsNumberConvertTo("length", "FT"),
+                     24.0/12.0);
+    TS_ASSERT_EQUALS(root->FindElementValueAsNumberConvertTo("length", "IN"),
+                     24.0);
+    TS_ASSERT_EQUALS(root->FindElementValueAsNumberConvertFromTo("length", "FT",
+                                                                 "IN"),
+                     24.0*12.0);
+    FGColumnVector3 v = location->FindElementTripletConvertTo("FT");
+    TS_ASSERT_EQUALS(v(1), 2.0*3.2808399);
+    TS_ASSERT_EQUALS(v(3), 2.0*3.2808399);
+  }
+};
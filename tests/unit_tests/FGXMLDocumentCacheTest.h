@@ -0,0 +1,165 @@
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+#include <input_output/FGXMLDocumentCache.h>
+
+using namespace JSBSim;
+
+const std::string document_name = "FGXMLDocumentCacheTest.xml";
+const std::string cache_name = "FGXMLDocumentCacheTest.bin";
+
+class FGXMLDocumentCacheTest : public CxxTest::TestSuite
+{
+public:
+  void tearDown() {
+    std::remove(document_name.c_str());
+    std::remove(cache_name.c_str());
+  }
+
+  void WriteFile(const std::string& name, const std::string& content) {
+    std::ofstream file(name, std::ios::binary);
+    file << content;
+  }
+
+  void WriteDocument(double value) {
+    WriteFile(document_name,
+              "<?xml version=\"1.0\"?>\n"
+              "<system name=\"test\">\n"
+              "  <property value=\"1\">a</property>\n"
+              "  <fcs_function>\n"
+              "    <function><value>" + std::to_string(value) + "</value></function>\n"
+              "  </fcs_function>\n"
+              "</system>\n");
+  }
+
+  void CheckDocument(Element* root, double value) {
+    TS_ASSERT_EQUALS(root->GetName(), "system");
+    TS_ASSERT_EQUALS(root->GetAttributeValue("name"), "test");
+    TS_ASSERT_EQUALS(root->GetNumElements(), 2);
+    Element* property = root->FindElement("property");
+    TS_ASSERT_EQUALS(property->GetParent(), root);
+    TS_ASSERT_EQUALS(property->GetAttributeValueAsNumber("value"), 1.0);
+    TS_ASSERT_EQUALS(property->GetDataLine(), "a");
+    TS_ASSERT_EQUALS(property->GetLineNumber(), 3);
+    TS_ASSERT_EQUALS(root->FindElement("fcs_function")->FindElement("function")
+                     ->FindElementValueAsNumber("value"), value);
+  }
+
+  void testLoad() {
+    WriteDocument(2.0);
+    FGXMLDocumentCache cache;
+
+    Element_ptr first = cache.Load(SGPath(document_name));
+    CheckDocument(first, 2.0);
+    TS_ASSERT_EQUALS(cache.GetNumDocuments(), 1);
+    TS_ASSERT_EQUALS(cache.GetNumParsed(), 1);
+
+    // The documents are copies, which are not affected by the changes made
+    // to the other copies.
+    first->FindElement("property")->SetAttributeValue("value", "5");
+    Element_ptr second = cache.Load(SGPath("FGXMLDocumentCacheTest"));
+    TS_ASSERT_DIFFERS(first, second);
+    CheckDocument(second, 2.0);
+    TS_ASSERT_EQUALS(cache.GetNumParsed(), 1);
+
+    // The files which changed are read again.
+    WriteDocument(30.0);
+    CheckDocument(cache.Load(SGPath(document_name)), 30.0);
+    TS_ASSERT_EQUALS(cache.GetNumDocuments(), 1);
+    TS_ASSERT_EQUALS(cache.GetNumParsed(), 2);
+
+    TS_ASSERT(!cache.Load(SGPath("missing.xml"), false));
+    cache.Clear();
+    TS_ASSERT_EQUALS(cache.GetNumDocuments(), 0);
+  }
+
+  void testShared() {
+    std::shared_ptr<FGXMLDocumentCache> shared = FGXMLDocumentCache::GetShared();
+    TS_ASSERT_EQUALS(FGXMLDocumentCache::GetShared(), shared);
+
+    // The shared cache is released with its last user.
+    WriteDocument(2.0);
+    shared->Load(SGPath(document_name));
+    std::weak_ptr<FGXMLDocumentCache> released = shared;
+    shared.reset();
+    TS_ASSERT(released.expired());
+    TS_ASSERT_EQUALS(FGXMLDocumentCache::GetShared()->GetNumDocuments(), 0);
+  }
+
+  void testCacheFile() {
+    WriteDocument(2.0);
+    FGXMLDocumentCache cache;
+    cache.Load(SGPath(document_name));
+    TS_ASSERT(cache.WriteFile(SGPath(cache_name)));
+
+    // The unchanged files are not parsed again.
+    FGXMLDocumentCache other;
+    TS_ASSERT(other.ReadFile(SGPath(cache_name)));
+    CheckDocument(other.Load(SGPath(document_name)), 2.0);
+    TS_ASSERT_EQUALS(other.GetNumParsed(), 0);
+
+    // The files which changed are parsed again.
+    WriteDocument(3.0);
+    FGXMLDocumentCache changed;
+    TS_ASSERT(changed.ReadFile(SGPath(cache_name)));
+    CheckDocument(changed.Load(SGPath(document_name)), 3.0);
+    TS_ASSERT_EQUALS(changed.GetNumParsed(), 1);
+  }
+
+  // The threads share the document of the cache, either parsed or read from
+  // the cache file, while the cache is cleared and the cache file read again.
+  void testThreads() {
+    WriteDocument(2.0);
+    FGXMLDocumentCache cache;
+    cache.Load(SGPath(document_name));
+    TS_ASSERT(cache.WriteFile(SGPath(cache_name)));
+    cache.Clear();
+
+    std::atomic<int> failures(0);
+    std::vector<std::thread> threads;
+    for (int i=0; i<4; i++) {
+      threads.emplace_back([&]() {
+          for (int j=0; j<500; j++) {
+            Element_ptr root = cache.Load(SGPath(document_name));
+            if (!root || root->GetNumElements() != 2) failures++;
+          }
+        });
+    }
+    threads.emplace_back([&]() {
+        for (int j=0; j<100; j++) {
+          if (!cache.ReadFile(SGPath(cache_name))) failures++;
+          if (j % 2) cache.Clear();
+        }
+      });
+    for (auto& thread: threads) thread.join();
+
+    TS_ASSERT_EQUALS(failures, 0);
+    TS_ASSERT(cache.GetNumDocuments() <= 1);
+  }
+
+  void testInvalidCacheFile() {
+    WriteDocument(2.0);
+    FGXMLDocumentCache cache;
+    TS_ASSERT(!cache.ReadFile(SGPath(cache_name)));
+    cache.Load(SGPath(document_name));
+    TS_ASSERT(cache.WriteFile(SGPath(cache_name)));
+
+    std::ifstream file(cache_name, std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(file)),
+                        std::istreambuf_iterator<char>());
+    file.close();
+
+    WriteFile(cache_name, content.substr(0, content.size()-1));
+    TS_ASSERT(!cache.ReadFile(SGPath(cache_name)));
+    content[content.size()/2] ^= 1;
+    WriteFile(cache_name, content);
+    TS_ASSERT(!cache.ReadFile(SGPath(cache_name)));
+    WriteFile(cache_name, "<?xml version=\"1.0\"?>");
+    TS_ASSERT(!cache.ReadFile(SGPath(cache_name)));
+  }
+};